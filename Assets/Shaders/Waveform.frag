@@ -0,0 +1,9 @@
+#version 430 core
+
+in vec4 v_Color;
+out vec4 o_Color;
+
+void main()
+{
+    o_Color = v_Color;
+}
@@ -0,0 +1,29 @@
+#version 430 core
+
+// Envelopes of the visible channels, lane-normalized to [-1, 1] and laid out as line strips :
+// channel i owns u_VerticesPerChannel values from i * u_VerticesPerChannel, one instance per channel
+layout(std430, binding = 0) readonly buffer Envelopes {
+    float b_Values[];
+};
+
+uniform int u_VerticesPerChannel;
+uniform int u_NumLanes;
+uniform float u_Gain;
+uniform vec4 u_LineColor;
+
+out vec4 v_Color;
+
+void main()
+{
+    int column = gl_VertexID / 2;
+    int columns = u_VerticesPerChannel / 2;
+    float value = b_Values[gl_InstanceID * u_VerticesPerChannel + gl_VertexID];
+
+    float lane = 2.0 / float(u_NumLanes);
+    float x = -1.0 + 2.0 * (float(column) + 0.5) / float(columns);
+    float y = 1.0 - lane * (float(gl_InstanceID) + 0.5) + 0.45 * lane * u_Gain * value;
+    gl_Position = vec4(x, y, 0.0, 1.0);
+
+    // Every other lane a little darker so neighbours stay apart
+    v_Color = (gl_InstanceID % 2 == 0) ? u_LineColor : vec4(u_LineColor.rgb * 0.7, u_LineColor.a);
+}
@@ -0,0 +1,57 @@
+#pragma once
+#include "Core/Base.h"
+
+#include <string>
+#include <vector>
+#include <filesystem>
+
+#include "NIRS/Snirf.h"
+
+struct BatchSpecification {
+	// Files and directories to process, directories contribute every .snirf file they contain
+	std::vector<std::filesystem::path> Inputs = {};
+	bool Recursive = false;
+
+	// Where the processed sidecars go, empty puts each one next to its recording
+	std::filesystem::path OutputDirectory = {};
+	NIRS::PreprocessingSpecification Preprocessing = {};
+	NIRS::SamplePrecision Precision = NIRS::SamplePrecision::Float32; // Of the samples in the sidecars
+
+	size_t NumThreads = 0; // 0 = one per hardware thread
+	bool Force = false;    // Reprocess files that already have an up to date sidecar
+};
+
+struct BatchFileResult {
+	std::filesystem::path Filepath = {};
+	bool Success = false;
+	bool Cached = false; // An up to date sidecar already existed
+	std::string Error = "";
+
+	uintmax_t FileSize = 0;
+	size_t NumChannels = 0; // Summed over all data blocks
+	size_t NumSamples = 0;
+
+	SNIRFLoadTimings Timings = {};
+	double Seconds = 0.0; // Whole file including the sidecar write
+};
+
+// Headless preprocessing of many recordings. Files are tasks on a work stealing pool and every file
+// splits its channels over the same pool, so a few large files keep all cores busy as well as many small ones
+class BatchProcessor {
+public:
+	BatchProcessor(const BatchSpecification& spec);
+
+	static std::vector<std::filesystem::path> CollectFiles(const std::vector<std::filesystem::path>& inputs, bool recursive);
+
+	// Results are in the order of the collected files
+	std::vector<BatchFileResult> Run();
+
+	double GetWallSeconds() const { return m_WallSeconds; }
+
+	static bool WriteTimings(const std::filesystem::path& csvPath, const std::vector<BatchFileResult>& results);
+private:
+	BatchFileResult ProcessFile(const std::filesystem::path& filepath, ThreadPool& pool);
+
+	BatchSpecification m_Specification;
+	double m_WallSeconds = 0.0;
+};
@@ -1,9 +1,12 @@
 #pragma once
 #include <QMainWindow.h>
 #include "Core/Base.h"
+#include "NIRS/NIRS.h"
 
 class ViewportWidget;
+class WaveformWidget;
 class CameraSettingsWidget;
+class SNIRF;
 
 struct ApplicationCommandLineArgs
 {
@@ -36,6 +39,9 @@ private:
 	void CreateMenus();
 	void CreateDocks();
 	void CreateCentralWidget(); // Method for viewport
+	void SubscribeToEvents();
+
+	void OpenSNIRFFile();
 
 public slots:
 
@@ -47,6 +53,12 @@ private:
 	ApplicationSpecification m_Specification;
 
 	ViewportWidget* m_ViewportWidget = nullptr;
+	WaveformWidget* m_WaveformWidget = nullptr;
 	CameraSettingsWidget* m_CameraSettingsWidget = nullptr;
+
+	Ref<SNIRF> m_SNIRF = nullptr;
+	uint64_t m_ActiveSNIRFLoad = 0;
+	NIRS::ChannelDataView m_ChannelDataView = NIRS::ChannelDataView::Processed;
+	QAction* m_ProcessedDataAction = nullptr;
 	// Setup Methods
 };
\ No newline at end of file
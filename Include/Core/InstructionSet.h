@@ -0,0 +1,12 @@
+#pragma once
+
+// The instruction set the core kernels were built for (NVIZ_SIMD in CMakeLists.txt) against what this CPU runs.
+// Executables call CheckInstructionSet once at startup, before anything is processed, so a CPU without AVX2 gets an
+// error message instead of an illegal instruction in the middle of a load
+namespace SIMD {
+
+	const char* GetBuildInstructionSet();
+
+	// False (and logged) when this CPU cannot run the kernels, always true for a Baseline build
+	bool CheckInstructionSet();
+}
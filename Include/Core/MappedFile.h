@@ -0,0 +1,32 @@
+#pragma once
+#include "Core/Base.h"
+
+#include <cstdint>
+#include <filesystem>
+
+// Read-only memory mapping of a whole file. Pages are faulted in by the OS on first access,
+// so opening is O(1) regardless of the file size
+class MappedFile
+{
+public:
+	MappedFile(const std::filesystem::path& filepath);
+	~MappedFile();
+
+	MappedFile(const MappedFile&) = delete;
+	MappedFile& operator=(const MappedFile&) = delete;
+
+	bool IsOpen() const { return m_Data != nullptr; }
+
+	const uint8_t* GetData() const { return m_Data; }
+	size_t GetSize() const { return m_Size; }
+private:
+	const uint8_t* m_Data = nullptr;
+	size_t m_Size = 0;
+
+#ifdef _WIN32
+	void* m_FileHandle = nullptr;
+	void* m_MappingHandle = nullptr;
+#else
+	int m_FileDescriptor = -1;
+#endif
+};
@@ -0,0 +1,223 @@
+#pragma once
+
+#include <cstddef>
+#include <cmath>
+
+// Thin wrapper over the widest double vector the including file is compiled for (see NVIZ_SIMD in CMakeLists.txt).
+// Kernels are written once against SIMD::DoubleVec and get AVX-512, AVX2, SSE2, NEON or plain scalar code.
+// Only some files are built for the wider sets, so everything here sits in an inline namespace named after the
+// instruction set : an SSE2 and an AVX2 DoubleVec are different types to the linker, not one inline function
+// with two bodies
+#if defined(__AVX512F__)
+	#include <immintrin.h>
+	#define NVIZ_SIMD_AVX512
+	#define NVIZ_SIMD_NAMESPACE AVX512
+#elif defined(__AVX2__)
+	#include <immintrin.h>
+	#define NVIZ_SIMD_AVX2
+	#define NVIZ_SIMD_NAMESPACE AVX2
+#elif defined(__SSE2__) || defined(_M_X64)
+	#include <emmintrin.h>
+	#define NVIZ_SIMD_SSE2
+	#define NVIZ_SIMD_NAMESPACE SSE2
+#elif defined(__ARM_NEON) && (defined(__aarch64__) || defined(_M_ARM64))
+	#include <arm_neon.h>
+	#define NVIZ_SIMD_NEON
+	#define NVIZ_SIMD_NAMESPACE NEON
+#else
+	#define NVIZ_SIMD_NAMESPACE Scalar
+#endif
+
+namespace SIMD {
+inline namespace NVIZ_SIMD_NAMESPACE {
+
+#if defined(NVIZ_SIMD_AVX512)
+	struct DoubleVec {
+		static constexpr size_t Width = 8;
+		__m512d V;
+
+		static DoubleVec Load(const double* p) { return { _mm512_loadu_pd(p) }; }
+		static DoubleVec Load(const float* p) { return { _mm512_cvtps_pd(_mm256_loadu_ps(p)) }; }
+		static DoubleVec Broadcast(double value) { return { _mm512_set1_pd(value) }; }
+		static DoubleVec Zero() { return { _mm512_setzero_pd() }; }
+		void Store(double* p) const { _mm512_storeu_pd(p, V); }
+		void Store(float* p) const { _mm256_storeu_ps(p, _mm512_cvtpd_ps(V)); }
+	};
+	inline DoubleVec operator+(DoubleVec a, DoubleVec b) { return { _mm512_add_pd(a.V, b.V) }; }
+	inline DoubleVec operator-(DoubleVec a, DoubleVec b) { return { _mm512_sub_pd(a.V, b.V) }; }
+	inline DoubleVec operator*(DoubleVec a, DoubleVec b) { return { _mm512_mul_pd(a.V, b.V) }; }
+	inline DoubleVec operator/(DoubleVec a, DoubleVec b) { return { _mm512_div_pd(a.V, b.V) }; }
+	inline DoubleVec MulAdd(DoubleVec a, DoubleVec b, DoubleVec c) { return { _mm512_fmadd_pd(a.V, b.V, c.V) }; }
+	inline DoubleVec NegMulAdd(DoubleVec a, DoubleVec b, DoubleVec c) { return { _mm512_fnmadd_pd(a.V, b.V, c.V) }; }
+	inline DoubleVec Max(DoubleVec a, DoubleVec b) { return { _mm512_max_pd(a.V, b.V) }; }
+	inline DoubleVec SelectGreater(DoubleVec a, DoubleVec b, DoubleVec t, DoubleVec f) { return { _mm512_mask_blend_pd(_mm512_cmp_pd_mask(a.V, b.V, _CMP_GT_OQ), f.V, t.V) }; }
+	inline DoubleVec SelectGreaterEqual(DoubleVec a, DoubleVec b, DoubleVec t, DoubleVec f) { return { _mm512_mask_blend_pd(_mm512_cmp_pd_mask(a.V, b.V, _CMP_GE_OQ), f.V, t.V) }; }
+	inline DoubleVec SplitExponent(DoubleVec x, DoubleVec& exponent)
+	{
+		exponent = { _mm512_getexp_pd(x.V) };
+		return { _mm512_getmant_pd(x.V, _MM_MANT_NORM_1_2, _MM_MANT_SIGN_src) };
+	}
+	static constexpr const char* InstructionSet = "AVX-512";
+
+#elif defined(NVIZ_SIMD_AVX2)
+	struct DoubleVec {
+		static constexpr size_t Width = 4;
+		__m256d V;
+
+		static DoubleVec Load(const double* p) { return { _mm256_loadu_pd(p) }; }
+		static DoubleVec Load(const float* p) { return { _mm256_cvtps_pd(_mm_loadu_ps(p)) }; }
+		static DoubleVec Broadcast(double value) { return { _mm256_set1_pd(value) }; }
+		static DoubleVec Zero() { return { _mm256_setzero_pd() }; }
+		void Store(double* p) const { _mm256_storeu_pd(p, V); }
+		void Store(float* p) const { _mm_storeu_ps(p, _mm256_cvtpd_ps(V)); }
+	};
+	inline DoubleVec operator+(DoubleVec a, DoubleVec b) { return { _mm256_add_pd(a.V, b.V) }; }
+	inline DoubleVec operator-(DoubleVec a, DoubleVec b) { return { _mm256_sub_pd(a.V, b.V) }; }
+	inline DoubleVec operator*(DoubleVec a, DoubleVec b) { return { _mm256_mul_pd(a.V, b.V) }; }
+	inline DoubleVec operator/(DoubleVec a, DoubleVec b) { return { _mm256_div_pd(a.V, b.V) }; }
+	inline DoubleVec MulAdd(DoubleVec a, DoubleVec b, DoubleVec c) { return { _mm256_fmadd_pd(a.V, b.V, c.V) }; }
+	inline DoubleVec NegMulAdd(DoubleVec a, DoubleVec b, DoubleVec c) { return { _mm256_fnmadd_pd(a.V, b.V, c.V) }; }
+	inline DoubleVec Max(DoubleVec a, DoubleVec b) { return { _mm256_max_pd(a.V, b.V) }; }
+	inline DoubleVec SelectGreater(DoubleVec a, DoubleVec b, DoubleVec t, DoubleVec f) { return { _mm256_blendv_pd(f.V, t.V, _mm256_cmp_pd(a.V, b.V, _CMP_GT_OQ)) }; }
+	inline DoubleVec SelectGreaterEqual(DoubleVec a, DoubleVec b, DoubleVec t, DoubleVec f) { return { _mm256_blendv_pd(f.V, t.V, _mm256_cmp_pd(a.V, b.V, _CMP_GE_OQ)) }; }
+	// The exponent field is moved into the mantissa of 2^52 and converted by subtracting it, AVX2 has no int64 -> double
+	inline DoubleVec SplitExponent(DoubleVec x, DoubleVec& exponent)
+	{
+		__m256i bits = _mm256_castpd_si256(x.V);
+		__m256i two52 = _mm256_set1_epi64x(0x4330000000000000ll);
+		exponent = { _mm256_sub_pd(_mm256_castsi256_pd(_mm256_or_si256(_mm256_srli_epi64(bits, 52), two52)), _mm256_set1_pd(4503599627370496.0 + 1023.0)) };
+		__m256i mantissa = _mm256_and_si256(bits, _mm256_set1_epi64x(0x000FFFFFFFFFFFFFll));
+		return { _mm256_castsi256_pd(_mm256_or_si256(mantissa, _mm256_set1_epi64x(0x3FF0000000000000ll))) };
+	}
+	static constexpr const char* InstructionSet = "AVX2";
+
+#elif defined(NVIZ_SIMD_SSE2)
+	// Baseline of every x86-64 build, no FMA
+	struct DoubleVec {
+		static constexpr size_t Width = 2;
+		__m128d V;
+
+		static DoubleVec Load(const double* p) { return { _mm_loadu_pd(p) }; }
+		static DoubleVec Load(const float* p) { return { _mm_cvtps_pd(_mm_castsi128_ps(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(p)))) }; }
+		static DoubleVec Broadcast(double value) { return { _mm_set1_pd(value) }; }
+		static DoubleVec Zero() { return { _mm_setzero_pd() }; }
+		void Store(double* p) const { _mm_storeu_pd(p, V); }
+		void Store(float* p) const { _mm_storel_epi64(reinterpret_cast<__m128i*>(p), _mm_castps_si128(_mm_cvtpd_ps(V))); }
+	};
+	inline DoubleVec operator+(DoubleVec a, DoubleVec b) { return { _mm_add_pd(a.V, b.V) }; }
+	inline DoubleVec operator-(DoubleVec a, DoubleVec b) { return { _mm_sub_pd(a.V, b.V) }; }
+	inline DoubleVec operator*(DoubleVec a, DoubleVec b) { return { _mm_mul_pd(a.V, b.V) }; }
+	inline DoubleVec operator/(DoubleVec a, DoubleVec b) { return { _mm_div_pd(a.V, b.V) }; }
+	inline DoubleVec MulAdd(DoubleVec a, DoubleVec b, DoubleVec c) { return a * b + c; }
+	inline DoubleVec NegMulAdd(DoubleVec a, DoubleVec b, DoubleVec c) { return c - a * b; }
+	inline DoubleVec Max(DoubleVec a, DoubleVec b) { return { _mm_max_pd(a.V, b.V) }; }
+	inline DoubleVec Select(__m128d mask, DoubleVec t, DoubleVec f) { return { _mm_or_pd(_mm_and_pd(mask, t.V), _mm_andnot_pd(mask, f.V)) }; }
+	inline DoubleVec SelectGreater(DoubleVec a, DoubleVec b, DoubleVec t, DoubleVec f) { return Select(_mm_cmpgt_pd(a.V, b.V), t, f); }
+	inline DoubleVec SelectGreaterEqual(DoubleVec a, DoubleVec b, DoubleVec t, DoubleVec f) { return Select(_mm_cmpge_pd(a.V, b.V), t, f); }
+	inline DoubleVec SplitExponent(DoubleVec x, DoubleVec& exponent)
+	{
+		__m128i bits = _mm_castpd_si128(x.V);
+		__m128i two52 = _mm_set1_epi64x(0x4330000000000000ll);
+		exponent = { _mm_sub_pd(_mm_castsi128_pd(_mm_or_si128(_mm_srli_epi64(bits, 52), two52)), _mm_set1_pd(4503599627370496.0 + 1023.0)) };
+		__m128i mantissa = _mm_and_si128(bits, _mm_set1_epi64x(0x000FFFFFFFFFFFFFll));
+		return { _mm_castsi128_pd(_mm_or_si128(mantissa, _mm_set1_epi64x(0x3FF0000000000000ll))) };
+	}
+	static constexpr const char* InstructionSet = "SSE2";
+
+#elif defined(NVIZ_SIMD_NEON)
+	struct DoubleVec {
+		static constexpr size_t Width = 2;
+		float64x2_t V;
+
+		static DoubleVec Load(const double* p) { return { vld1q_f64(p) }; }
+		static DoubleVec Load(const float* p) { return { vcvt_f64_f32(vld1_f32(p)) }; }
+		static DoubleVec Broadcast(double value) { return { vdupq_n_f64(value) }; }
+		static DoubleVec Zero() { return { vdupq_n_f64(0.0) }; }
+		void Store(double* p) const { vst1q_f64(p, V); }
+		void Store(float* p) const { vst1_f32(p, vcvt_f32_f64(V)); }
+	};
+	inline DoubleVec operator+(DoubleVec a, DoubleVec b) { return { vaddq_f64(a.V, b.V) }; }
+	inline DoubleVec operator-(DoubleVec a, DoubleVec b) { return { vsubq_f64(a.V, b.V) }; }
+	inline DoubleVec operator*(DoubleVec a, DoubleVec b) { return { vmulq_f64(a.V, b.V) }; }
+	inline DoubleVec operator/(DoubleVec a, DoubleVec b) { return { vdivq_f64(a.V, b.V) }; }
+	inline DoubleVec MulAdd(DoubleVec a, DoubleVec b, DoubleVec c) { return { vfmaq_f64(c.V, a.V, b.V) }; }
+	inline DoubleVec NegMulAdd(DoubleVec a, DoubleVec b, DoubleVec c) { return { vfmsq_f64(c.V, a.V, b.V) }; }
+	inline DoubleVec Max(DoubleVec a, DoubleVec b) { return { vmaxnmq_f64(a.V, b.V) }; }
+	inline DoubleVec SelectGreater(DoubleVec a, DoubleVec b, DoubleVec t, DoubleVec f) { return { vbslq_f64(vcgtq_f64(a.V, b.V), t.V, f.V) }; }
+	inline DoubleVec SelectGreaterEqual(DoubleVec a, DoubleVec b, DoubleVec t, DoubleVec f) { return { vbslq_f64(vcgeq_f64(a.V, b.V), t.V, f.V) }; }
+	inline DoubleVec SplitExponent(DoubleVec x, DoubleVec& exponent)
+	{
+		uint64x2_t bits = vreinterpretq_u64_f64(x.V);
+		exponent = { vsubq_f64(vcvtq_f64_u64(vshrq_n_u64(bits, 52)), vdupq_n_f64(1023.0)) };
+		uint64x2_t mantissa = vandq_u64(bits, vdupq_n_u64(0x000FFFFFFFFFFFFFull));
+		return { vreinterpretq_f64_u64(vorrq_u64(mantissa, vdupq_n_u64(0x3FF0000000000000ull))) };
+	}
+	static constexpr const char* InstructionSet = "NEON";
+
+#else
+	// Scalar fallback, one lane per vector so kernels degrade to plain loops over independent channels
+	struct DoubleVec {
+		static constexpr size_t Width = 1;
+		double V;
+
+		static DoubleVec Load(const double* p) { return { *p }; }
+		static DoubleVec Load(const float* p) { return { static_cast<double>(*p) }; }
+		static DoubleVec Broadcast(double value) { return { value }; }
+		static DoubleVec Zero() { return { 0.0 }; }
+		void Store(double* p) const { *p = V; }
+		void Store(float* p) const { *p = static_cast<float>(V); }
+	};
+	inline DoubleVec operator+(DoubleVec a, DoubleVec b) { return { a.V + b.V }; }
+	inline DoubleVec operator-(DoubleVec a, DoubleVec b) { return { a.V - b.V }; }
+	inline DoubleVec operator*(DoubleVec a, DoubleVec b) { return { a.V * b.V }; }
+	inline DoubleVec operator/(DoubleVec a, DoubleVec b) { return { a.V / b.V }; }
+	inline DoubleVec MulAdd(DoubleVec a, DoubleVec b, DoubleVec c) { return a * b + c; }
+	inline DoubleVec NegMulAdd(DoubleVec a, DoubleVec b, DoubleVec c) { return c - a * b; }
+	inline DoubleVec Max(DoubleVec a, DoubleVec b) { return { a.V > b.V ? a.V : b.V }; }
+	inline DoubleVec SelectGreater(DoubleVec a, DoubleVec b, DoubleVec t, DoubleVec f) { return a.V > b.V ? t : f; }
+	inline DoubleVec SelectGreaterEqual(DoubleVec a, DoubleVec b, DoubleVec t, DoubleVec f) { return a.V >= b.V ? t : f; }
+	inline DoubleVec SplitExponent(DoubleVec x, DoubleVec& exponent)
+	{
+		int e = 0;
+		double m = std::frexp(x.V, &e); // [0.5, 1)
+		exponent = { static_cast<double>(e - 1) };
+		return { m * 2.0 };
+	}
+	static constexpr const char* InstructionSet = "Scalar";
+#endif
+
+	// Max(a, b) returns b when a is NaN on every instruction set, so Max(x, floor) also clears NaN.
+	// SelectGreater(a, b, t, f) is a > b ? t : f per lane, false for NaN.
+	// SplitExponent returns the mantissa in [1, 2) and sets exponent so x = mantissa * 2^exponent, for positive normal x
+
+	// Natural log of positive normal values, fdlibm's __ieee754_log reduction and polynomial without the
+	// special cases. Stays within about 1 ulp of std::log and is branchless, so it runs at the full vector width
+	inline DoubleVec Log(DoubleVec x)
+	{
+		const DoubleVec one = DoubleVec::Broadcast(1.0);
+		const DoubleVec half = DoubleVec::Broadcast(0.5);
+		const DoubleVec sqrt2 = DoubleVec::Broadcast(1.4142135623730951);
+
+		DoubleVec k;
+		DoubleVec m = SplitExponent(x, k);
+		// Center the mantissa on 1, m in [sqrt(2) / 2, sqrt(2))
+		k = SelectGreater(m, sqrt2, k + one, k);
+		m = SelectGreater(m, sqrt2, m * half, m);
+
+		DoubleVec f = m - one;
+		DoubleVec s = f / (DoubleVec::Broadcast(2.0) + f);
+		DoubleVec z = s * s;
+		DoubleVec r = MulAdd(z, DoubleVec::Broadcast(1.479819860511658591e-01), DoubleVec::Broadcast(1.531383769920937332e-01));
+		r = MulAdd(z, r, DoubleVec::Broadcast(1.818357216161805012e-01));
+		r = MulAdd(z, r, DoubleVec::Broadcast(2.222219843214978396e-01));
+		r = MulAdd(z, r, DoubleVec::Broadcast(2.857142874366239149e-01));
+		r = MulAdd(z, r, DoubleVec::Broadcast(3.999999999940941908e-01));
+		r = MulAdd(z, r, DoubleVec::Broadcast(6.666666666666735130e-01));
+		r = z * r;
+
+		DoubleVec hfsq = half * f * f;
+		DoubleVec low = MulAdd(s, hfsq + r, k * DoubleVec::Broadcast(1.90821492927058770002e-10));
+		return k * DoubleVec::Broadcast(6.93147180369123816490e-01) - ((hfsq - low) - f);
+	}
+}
+}
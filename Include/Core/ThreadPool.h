@@ -0,0 +1,126 @@
+#pragma once
+#include "Core/Base.h"
+
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <atomic>
+#include <exception>
+#include <algorithm>
+
+// Work stealing pool. Every worker owns a deque, tasks submitted from a worker go to its own deque
+// (run LIFO, cache warm), tasks from other threads are spread round robin. Idle workers steal the
+// oldest task of another worker before going to sleep
+class ThreadPool
+{
+public:
+	ThreadPool(size_t numThreads = 0); // 0 = one per hardware thread, minus the main thread
+	~ThreadPool();
+
+	ThreadPool(const ThreadPool&) = delete;
+	ThreadPool& operator=(const ThreadPool&) = delete;
+
+	template<typename F>
+	auto Submit(F&& task) -> std::future<decltype(task())>
+	{
+		using Result = decltype(task());
+		auto packaged = std::make_shared<std::packaged_task<Result()>>(std::forward<F>(task));
+		std::future<Result> future = packaged->get_future();
+		Enqueue([packaged]() { (*packaged)(); });
+		return future;
+	}
+
+	// Calls body(i) for every i in [begin, end), grainSize indices per task. The calling thread works
+	// on the range as well, then sleeps until the chunks already running elsewhere are done. It never runs
+	// other queued tasks while it waits, so a call from inside a pool task (e.g. channels of a file that is
+	// itself a task) cannot pick up another file and keep its own buffers alive meanwhile. The first
+	// exception thrown by body is rethrown here once the whole range is done
+	template<typename F>
+	void ParallelFor(size_t begin, size_t end, size_t grainSize, F&& body)
+	{
+		if (begin >= end) {
+			return;
+		}
+		grainSize = std::max<size_t>(grainSize, 1);
+		size_t num_chunks = (end - begin + grainSize - 1) / grainSize;
+		if (num_chunks == 1 || m_Workers.empty()) {
+			for (size_t i = begin; i < end; i++) {
+				body(i);
+			}
+			return;
+		}
+
+		struct State {
+			std::atomic<size_t> NextChunk = 0;
+			size_t DoneChunks = 0;
+			std::mutex Mutex; // Guards DoneChunks and Error
+			std::condition_variable Done;
+			std::exception_ptr Error = nullptr;
+		};
+		auto state = std::make_shared<State>();
+
+		// Helpers that start after the range is drained claim nothing and never touch body
+		auto run = [state, begin, end, grainSize, num_chunks, &body]() {
+			size_t chunk;
+			while ((chunk = state->NextChunk.fetch_add(1)) < num_chunks) {
+				size_t first = begin + chunk * grainSize;
+				size_t last = std::min(first + grainSize, end);
+				std::exception_ptr error = nullptr;
+				try {
+					for (size_t i = first; i < last; i++) {
+						body(i);
+					}
+				}
+				catch (...) {
+					error = std::current_exception();
+				}
+
+				std::lock_guard<std::mutex> lock(state->Mutex);
+				if (error && !state->Error) state->Error = error;
+				if (++state->DoneChunks == num_chunks) state->Done.notify_all();
+			}
+		};
+
+		size_t helpers = std::min(num_chunks - 1, m_Workers.size());
+		for (size_t h = 0; h < helpers; h++) {
+			Enqueue(run);
+		}
+		run();
+
+		// Every chunk is claimed by now, what is left is already running on other threads
+		std::unique_lock<std::mutex> lock(state->Mutex);
+		state->Done.wait(lock, [&]() { return state->DoneChunks == num_chunks; });
+		if (state->Error) {
+			std::rethrow_exception(state->Error);
+		}
+	}
+
+	size_t GetThreadCount() const { return m_Workers.size(); }
+
+	// Shared pool for background work
+	static ThreadPool& Get();
+private:
+	struct WorkerQueue {
+		std::mutex Mutex;
+		std::deque<std::function<void()>> Tasks;
+	};
+
+	void Enqueue(std::function<void()> task);
+	bool TryPop(size_t queue, std::function<void()>& task);
+	bool TrySteal(size_t thief, std::function<void()>& task);
+	void WorkerLoop(size_t index);
+
+	std::vector<std::thread> m_Workers;
+	std::vector<Scope<WorkerQueue>> m_Queues;
+	std::atomic<size_t> m_NextQueue = 0;
+
+	// Sleeping workers wait for m_PendingTasks > 0, it is raised under m_SleepMutex so no wakeup is lost
+	std::atomic<size_t> m_PendingTasks = 0;
+	std::mutex m_SleepMutex;
+	std::condition_variable m_Condition;
+	bool m_Stopping = false;
+};
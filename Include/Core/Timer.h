@@ -0,0 +1,20 @@
+#pragma once
+
+#include <chrono>
+
+// Simple wall clock stopwatch, starts on construction
+class Timer
+{
+public:
+	Timer() { Reset(); }
+
+	void Reset() { m_Start = std::chrono::steady_clock::now(); }
+
+	double Elapsed() const {
+		return std::chrono::duration<double>(std::chrono::steady_clock::now() - m_Start).count();
+	}
+	double ElapsedMillis() const { return Elapsed() * 1000.0; }
+
+private:
+	std::chrono::steady_clock::time_point m_Start;
+};
@@ -2,6 +2,11 @@
 
 #include "Core/Base.h"
 
+#include <string>
+
+class SNIRF;
+using SNIRFLoadID = uint64_t;
+
 
 // EventBus is a singleton class that manages event subscriptions and publishing.
 // Here we define the structs which represent different commands/events in the application.
@@ -11,7 +16,25 @@ struct CoordinateSystemGenerated {
 	// No additional data needed for this command
 };
 
+// Published by SNIRFLoader while a background load runs
+struct SNIRFFileLoadProgressEvent {
+	SNIRFLoadID LoadID = 0;
+	std::string Filepath = "";
+	std::string Stage = "";
+	float Progress = 0.0f; // 0 to 1
+};
+
 struct SNIRFFileLoadedEvent {
+	SNIRFLoadID LoadID = 0;
+	Ref<SNIRF> File = nullptr;
+	double Seconds = 0.0;
+};
+
+struct SNIRFFileLoadFailedEvent {
+	SNIRFLoadID LoadID = 0;
+	std::string Filepath = "";
+	std::string Error = "";
+	bool Cancelled = false;
 };
 
 struct HeadAnatomyLoadedEvent {
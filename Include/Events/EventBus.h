@@ -5,6 +5,7 @@
 #include <typeindex>
 #include <memory>
 #include <mutex>
+#include <vector>
 
 class EventBus {
 private:
@@ -22,6 +23,10 @@ private:
 	std::map<std::type_index, std::unique_ptr<IEventHandler>> handlers;
 	std::mutex busMutex; // Thread safety is important for a central bus
 
+	// Events posted from other threads, delivered on the main thread by DispatchPosted()
+	std::vector<std::function<void()>> postedEvents;
+	std::mutex postedMutex;
+
 public:
 public:
 	// ------------------- Singleton Access -------------------
@@ -76,6 +81,29 @@ public:
 			}
 		}
 	}
+
+	// ------------------- Cross Thread Publishing -------------------
+	/**
+	 * @brief Queues an event to be published on the thread that calls DispatchPosted().
+	 * Use this from worker threads, listeners can then safely touch Qt widgets and GL state.
+	 */
+	template<typename T>
+	void Post(const T& event) {
+		std::lock_guard<std::mutex> lock(postedMutex);
+		postedEvents.push_back([this, event]() { Publish(event); });
+	}
+
+	// Publishes everything posted since the last call, called once per frame from the main thread
+	void DispatchPosted() {
+		std::vector<std::function<void()>> events;
+		{
+			std::lock_guard<std::mutex> lock(postedMutex);
+			events.swap(postedEvents);
+		}
+		for (const auto& publish : events) {
+			publish();
+		}
+	}
 };
 
 #include "Events/Commands.h"
\ No newline at end of file
@@ -0,0 +1,64 @@
+#pragma once
+#include "Core/Base.h"
+
+#include <vector>
+
+#include <Eigen/Dense>
+
+#include "NIRS/NIRS.h"
+
+namespace NIRS {
+
+	// Molar extinction coefficients in cm^-1 / M (decadic, matches log10 optical density)
+	struct ExtinctionCoefficients {
+		double HbO = 0.0;
+		double HbR = 0.0;
+	};
+
+	// Prahl's tabulation for 650 - 950 nm sampled every 10 nm, linearly interpolated in between
+	ExtinctionCoefficients GetExtinctionCoefficients(double wavelength);
+
+	struct MBLLSpecification {
+		// Differential pathlength factor, DPF[c] for row c of the channel table when it has one entry per channel
+		double DefaultDPF = 6.0;
+		std::vector<double> DPF = {};
+	};
+
+	// One source-detector pair, Channels[w] is the channel table row of wavelength index w + 1
+	struct MBLLPair {
+		ProbeID SourceID = 0;
+		ProbeID DetectorID = 0;
+		double Distance = 0.0; // cm
+		std::vector<size_t> Channels = {};
+	};
+
+	// Modified Beer-Lambert law for one probe : the extinction system of its wavelengths is inverted once,
+	// then every pair converts with the same matrix. The optical density rows of all pairs are gathered
+	// side by side, a tile of samples at a time, so a tile is a single (pairs*tile x W) * (W x 2) product.
+	// Output overwrites the rows of each pair in place, in µM : wavelength index 1 becomes HbR, 2 HbO and
+	// any further wavelength HbT, which is how MeasurementListToWavelength labels raw channels already
+	class BeerLambertConverter {
+	public:
+		BeerLambertConverter() = default;
+		// wavelengths are in nm and in file order (WavelengthIndex - 1). Positions are scaled by
+		// centimetersPerUnit to get source-detector distances in cm
+		BeerLambertConverter(const std::vector<Channel>& channels, const std::vector<int>& wavelengths,
+			const std::vector<Probe3D>& sources, const std::vector<Probe3D>& detectors, double centimetersPerUnit,
+			const MBLLSpecification& spec = {});
+
+		// channels[c] is the optical density of channel table row c. Rows outside of a complete pair are left as they are.
+		// Different sample ranges touch disjoint memory, so ranges can be converted in parallel
+		template<typename T>
+		void Convert(T* const* channels, size_t firstSample, size_t numSamples) const;
+		// Only the pairs listed (indices into GetPairs()), e.g. those whose inputs changed
+		template<typename T>
+		void ConvertPairs(T* const* channels, const size_t* pairs, size_t numPairs, size_t firstSample, size_t numSamples) const;
+
+		const std::vector<MBLLPair>& GetPairs() const { return m_Pairs; }
+		bool IsEmpty() const { return m_Pairs.empty(); }
+	private:
+		std::vector<MBLLPair> m_Pairs = {};
+		std::vector<double> m_RowScales = {}; // 1 / (distance * DPF) per pair and wavelength, pair-major
+		Eigen::MatrixXd m_Inverse;            // W x 2, transposed pseudo inverse of the extinction matrix, columns HbO, HbR
+	};
+}
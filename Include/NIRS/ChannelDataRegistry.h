@@ -0,0 +1,151 @@
+#pragma once
+#include "Core/Base.h"
+
+#include <vector>
+#include <unordered_map>
+#include <atomic>
+
+#include "NIRS/NIRS.h"
+#include "NIRS/DecimationPyramid.h"
+
+class ThreadPool;
+
+// Read-only view of a single channel's samples inside registry owned storage
+template<typename T>
+struct ChannelSpanT {
+	const T* Data = nullptr;
+	size_t Size = 0;
+
+	const T* begin() const { return Data; }
+	const T* end() const { return Data + Size; }
+	size_t size() const { return Size; }
+	bool empty() const { return Size == 0; }
+
+	const T& operator[](size_t index) const { return Data[index]; }
+
+	std::vector<double> ToVector() const { return std::vector<double>(begin(), end()); }
+};
+using ChannelSpan = ChannelSpanT<double>;
+using ChannelSpanF = ChannelSpanT<float>;
+
+// Channel-major block of samples : channel c lives at Samples[c * NumSamples, (c + 1) * NumSamples)
+template<typename T>
+struct ChannelDataBlockT {
+	size_t NumChannels = 0;
+	size_t NumSamples = 0;
+	std::vector<T> Samples = {};
+
+	T* GetChannel(size_t channel) { return Samples.data() + channel * NumSamples; }
+	const T* GetChannel(size_t channel) const { return Samples.data() + channel * NumSamples; }
+};
+using ChannelDataBlock = ChannelDataBlockT<double>;
+using ChannelDataBlockF = ChannelDataBlockT<float>;
+
+class ChannelDataRegistry {
+public:
+	using ChannelData = std::vector<double>;
+
+	// Every loaded SNIRF owns a registry, Get() returns the one made current (by default the first one created)
+	// Files can be loaded on several threads at once, so the current registry is swapped atomically
+	ChannelDataRegistry() {
+		ChannelDataRegistry* none = nullptr;
+		s_Instance.compare_exchange_strong(none, this);
+	};
+	~ChannelDataRegistry() {
+		ChannelDataRegistry* self = this;
+		s_Instance.compare_exchange_strong(self, nullptr);
+	};
+	ChannelDataRegistry(const ChannelDataRegistry&) = delete;
+	ChannelDataRegistry& operator=(const ChannelDataRegistry&) = delete;
+
+	void MakeCurrent() { s_Instance = this; };
+
+	// Copies the data in, identical channels are only stored once
+	int SubmitChannelData(const ChannelData& data);
+	// Takes ownership of the vector, identical channels are only stored once
+	int SubmitChannelData(ChannelData&& data);
+	// Takes ownership of a whole channel-major block without copying any samples.
+	// Returns the index of the first channel, channel c of the block lives at index first + c
+	template<typename T>
+	int SubmitChannelBlock(ChannelDataBlockT<T>&& block);
+	// Registers channel-major samples that live in storage owned elsewhere (e.g. a mapped cache file).
+	// The registry only keeps owner alive, data has to stay valid for as long as owner does
+	template<typename T>
+	int SubmitExternalBlock(Ref<const void> owner, const T* data, size_t numChannels, size_t numSamples);
+
+	// Entries keep the precision they were submitted with, float and double channels can be mixed
+	NIRS::SamplePrecision GetPrecision(int index) const;
+
+	// Zero copy view, T has to match GetPrecision(index)
+	template<typename T>
+	ChannelSpanT<T> GetChannelSpan(int index) const;
+	ChannelSpan GetChannelData(int index) const { return GetChannelSpan<double>(index); }
+
+	// Converting copy for callers that need a fixed precision regardless of how the channel is stored
+	template<typename T>
+	void CopyChannelData(int index, std::vector<T>& out) const;
+
+	// Raw and processed samples of a channel live side by side, the view picks one. Lookups by channel
+	// without a view use the registry's current view (e.g. the raw / preprocessed toggle of the viewer)
+	void SetView(NIRS::ChannelDataView view) { m_View = view; }
+	NIRS::ChannelDataView GetView() const { return m_View; }
+
+	// False when the view was not loaded, e.g. raw samples of a file served from the processed data cache
+	bool HasChannelData(const NIRS::Channel& channel, NIRS::ChannelDataView view) const;
+	bool HasChannelData(const NIRS::Channel& channel) const { return HasChannelData(channel, m_View); }
+
+	template<typename T>
+	ChannelSpanT<T> GetChannelSpan(const NIRS::Channel& channel, NIRS::ChannelDataView view) const { return GetChannelSpan<T>(static_cast<int>(channel.GetDataIndex(view))); }
+	template<typename T>
+	ChannelSpanT<T> GetChannelSpan(const NIRS::Channel& channel) const { return GetChannelSpan<T>(channel, m_View); }
+
+	template<typename T>
+	void CopyChannelData(const NIRS::Channel& channel, NIRS::ChannelDataView view, std::vector<T>& out) const { CopyChannelData(static_cast<int>(channel.GetDataIndex(view)), out); }
+	template<typename T>
+	void CopyChannelData(const NIRS::Channel& channel, std::vector<T>& out) const { CopyChannelData(channel, m_View, out); }
+
+	// Display pyramid of every entry that has none yet, entries in parallel on pool (nullptr uses ThreadPool::Get()).
+	// Loaders call it once their blocks are submitted
+	void BuildPyramids(ThreadPool* pool = nullptr);
+	bool HasPyramid(int index) const { return GetEntry(index).Pyramid != nullptr; }
+	// One min / max / mean per pixel column of samples [first, last), see NIRS::DecimationPyramid::Fetch.
+	// False (and out left empty) when the entry has no pyramid
+	bool FetchEnvelope(int index, double first, double last, size_t numColumns, NIRS::Envelope& out) const;
+	bool FetchEnvelope(const NIRS::Channel& channel, NIRS::ChannelDataView view, double first, double last, size_t numColumns, NIRS::Envelope& out) const {
+		return FetchEnvelope(static_cast<int>(channel.GetDataIndex(view)), first, last, numColumns, out);
+	}
+
+	size_t GetChannelCount() const { return m_Entries.size(); };
+
+	void Clear() {
+		m_Entries.clear();
+		m_LookupMap.clear();
+	}
+
+	static ChannelDataRegistry& Get() {
+		ChannelDataRegistry* instance = s_Instance.load();
+		NVIZ_ASSERT(instance, "No current ChannelDataRegistry!");
+		return *instance;
+	}
+private:
+	// Every entry points into storage it keeps alive, either its own vector or a shared block
+	struct Entry {
+		Ref<const void> Owner = nullptr;
+		const void* Data = nullptr;
+		size_t Size = 0;
+		NIRS::SamplePrecision Precision = NIRS::SamplePrecision::Float64;
+		Ref<const NIRS::DecimationPyramid> Pyramid = nullptr;
+	};
+	const Entry& GetEntry(int index) const;
+	std::vector<Entry> m_Entries;
+	std::atomic<NIRS::ChannelDataView> m_View = NIRS::ChannelDataView::Processed;
+
+	// Map to quickly check if a vector with the same content hash already exists.
+	// Key: Hash of the ChannelData content. Value: Index in m_Entries.
+	std::unordered_map<std::size_t, int> m_LookupMap;
+
+	int FindDuplicate(std::size_t hash, const ChannelData& data) const;
+	std::size_t HashChannelData(const ChannelData& data) const;
+
+	static std::atomic<ChannelDataRegistry*> s_Instance;
+};
@@ -0,0 +1,68 @@
+#pragma once
+#include "Core/Base.h"
+
+#include <vector>
+
+#include <Eigen/Dense>
+
+#include "NIRS/NIRS.h"
+#include "NIRS/ChannelDataRegistry.h"
+
+class ThreadPool;
+
+namespace NIRS {
+
+	// Pearson correlation of every pair of channels over the whole recording, numChannels x numChannels.
+	// Channels are z-normalized a run of samples at a time and every run is one blocked product Z * Z',
+	// lower triangle tiles in parallel on pool (nullptr uses ThreadPool::Get()). Constant channels correlate as NaN
+	template<typename T>
+	Eigen::MatrixXd ComputeCorrelation(const T* const* channels, size_t numChannels, size_t numSamples, ThreadPool* pool = nullptr);
+	// Same for channels of a registry, whichever precision they are stored at
+	Eigen::MatrixXd ComputeCorrelation(const ChannelDataRegistry& registry, const std::vector<Channel>& channels,
+		ChannelDataView view = ChannelDataView::Processed, ThreadPool* pool = nullptr);
+
+	// Correlation matrices of a window sliding over the recording. Samples are z-normalized with statistics of
+	// the whole recording, then the window keeps the sums of z and of the outer products z z'. Moving on by a step adds
+	// the outer products of the samples that enter and removes those of the samples that leave, a single rank-2*step
+	// product instead of a product over the whole window. The sums are recomputed from scratch every RefreshSteps
+	// steps so rounding cannot build up. Channel rows are read in place and have to outlive the object
+	template<typename T>
+	class SlidingCorrelation {
+	public:
+		static constexpr size_t RefreshSteps = 256;
+
+		SlidingCorrelation(const T* const* channels, size_t numChannels, size_t numSamples,
+			size_t windowSamples, size_t stepSamples, ThreadPool* pool = nullptr);
+
+		size_t GetNumWindows() const { return m_NumWindows; }
+		size_t GetWindow() const { return m_Window; }
+		size_t GetFirstSample(size_t window) const { return window * m_Step; }
+
+		// Moves to window, one step forward is incremental, any other move recomputes the window
+		const Eigen::MatrixXd& Seek(size_t window);
+		// Moves one step forward, false at the last window
+		bool Next();
+
+		// Of the current window
+		const Eigen::MatrixXd& GetCorrelation() const { return m_Correlation; }
+	private:
+		void Recompute();
+		void Finish();
+
+		std::vector<const T*> m_Channels = {};
+		size_t m_NumSamples = 0;
+		size_t m_WindowSamples = 0;
+		size_t m_Step = 0;
+		size_t m_NumWindows = 0;
+		ThreadPool* m_Pool = nullptr;
+
+		std::vector<double> m_Means = {};
+		std::vector<double> m_InverseDeviations = {}; // 0 for constant channels
+
+		size_t m_Window = 0;
+		size_t m_StepsSinceRefresh = 0;
+		Eigen::MatrixXd m_Products;  // Lower triangle of sum z z' over the window
+		Eigen::VectorXd m_Sums;      // sum z over the window
+		Eigen::MatrixXd m_Correlation;
+	};
+}
@@ -0,0 +1,51 @@
+#pragma once
+#include "Core/Base.h"
+
+#include <vector>
+
+namespace NIRS {
+
+	// Min, max and mean of the samples under each pixel column of a view, NaN for columns past the end of the channel
+	struct Envelope {
+		std::vector<float> Min = {};
+		std::vector<float> Max = {};
+		std::vector<float> Mean = {};
+
+		size_t GetNumColumns() const { return Min.size(); }
+	};
+
+	// Min / max / mean of one channel at every power of LevelFactor, starting at BaseBucketSamples samples per bucket.
+	// Together the levels are about a quarter of a float channel. A view of any zoom picks the coarsest level whose
+	// buckets still fit in a pixel column, so a column only ever reads 1 to LevelFactor buckets however long the
+	// recording is. Columns are snapped to bucket edges of that level (by at most half a bucket) : every bucket
+	// belongs to exactly one column, so no peak is lost or drawn twice. Views narrower than a base bucket per
+	// column read the samples themselves
+	class DecimationPyramid {
+	public:
+		static constexpr size_t BaseBucketSamples = 16;
+		static constexpr size_t LevelFactor = 4;
+
+		DecimationPyramid() = default;
+		template<typename T>
+		DecimationPyramid(const T* samples, size_t numSamples);
+
+		size_t GetNumSamples() const { return m_NumSamples; }
+		size_t GetNumLevels() const { return m_Levels.size(); }
+		size_t GetBucketSamples(size_t level) const { return m_Levels[level].BucketSamples; }
+
+		// Samples [first, last) split evenly into numColumns columns, first and last may be fractional.
+		// samples are the ones the pyramid was built from. O(numColumns)
+		template<typename T>
+		void Fetch(const T* samples, double first, double last, size_t numColumns, Envelope& out) const;
+	private:
+		struct Level {
+			size_t BucketSamples = 0;
+			std::vector<float> Min = {};
+			std::vector<float> Max = {};
+			std::vector<float> Mean = {};
+		};
+
+		size_t m_NumSamples = 0;
+		std::vector<Level> m_Levels = {};
+	};
+}
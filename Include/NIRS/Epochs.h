@@ -0,0 +1,76 @@
+#pragma once
+#include "Core/Base.h"
+
+#include <string>
+#include <vector>
+
+#include "NIRS/ChannelDataRegistry.h"
+
+class ThreadPool;
+
+namespace NIRS {
+
+	// One row of a SNIRF stim data matrix
+	struct StimEvent {
+		double Onset = 0.0;    // seconds, on the time axis of the data block
+		double Duration = 0.0; // seconds
+		double Amplitude = 1.0;
+	};
+
+	// A /nirs{i}/stim{j} group : one condition and its events
+	struct StimCondition {
+		std::string Name = "";
+		std::vector<StimEvent> Events = {};
+		std::vector<std::string> DataLabels = {}; // Column names when the file has them, Onset / Duration / Amplitude first
+	};
+
+	// Event-related average : a window of [Start, End) seconds around every onset, averaged per channel
+	struct EpochSpecification {
+		std::vector<double> Onsets = {}; // Seconds from the first sample, epochs that do not fit the recording are skipped
+		double Start = -2.0;
+		double End = 15.0;
+		bool BaselineCorrection = true; // Subtract the mean of [Start, 0) from every epoch
+	};
+
+	// Onsets of a condition as EpochSpecification wants them, relative to startTime (the block's first timestamp)
+	std::vector<double> GetOnsets(const StimCondition& condition, double startTime = 0.0);
+
+	// Mean and standard error of the mean of every channel's epochs, both channel-major with GetLength() samples per channel
+	struct EpochAverage {
+		ChannelDataBlock Mean = {};
+		ChannelDataBlock StandardError = {};
+		size_t NumEpochs = 0;
+		int64_t Offset = 0; // Samples from the onset to the first sample of an epoch, negative before the onset
+
+		size_t GetLength() const { return Mean.NumSamples; }
+	};
+
+	// Onsets are turned into sample windows once, then every channel is a single forward pass over its own samples :
+	// epochs are visited in onset order and folded into a running mean and sum of squares per lag (Welford), each
+	// epoch shifted by its own baseline as it is read. No epoch is ever stored, the working set of a channel is its
+	// output rows. Channels are independent and averaged in parallel
+	class EpochAverager {
+	public:
+		EpochAverager(const EpochSpecification& spec, size_t numSamples, double samplingRate);
+
+		bool IsEmpty() const { return m_Windows.empty(); }
+		size_t GetNumEpochs() const { return m_Windows.size(); }
+		size_t GetLength() const { return m_Length; }
+		int64_t GetOffset() const { return m_Offset; }
+
+		// channels[c] has the numSamples of the constructor. On pool, nullptr uses ThreadPool::Get()
+		template<typename T>
+		EpochAverage Average(const T* const* channels, size_t numChannels, ThreadPool* pool = nullptr) const;
+
+		// Averages channels[i] into row rows[i] of average, which has to be sized by Allocate.
+		// Calls on disjoint rows can run concurrently
+		void Allocate(EpochAverage& average, size_t numChannels) const;
+		template<typename T>
+		void AverageInto(const T* const* channels, const size_t* rows, size_t numChannels, EpochAverage& average) const;
+	private:
+		std::vector<size_t> m_Windows = {}; // First sample of every epoch, ascending
+		int64_t m_Offset = 0;
+		size_t m_Length = 0;
+		size_t m_BaselineSamples = 0; // Leading samples of an epoch that form its baseline, 0 without correction
+	};
+}
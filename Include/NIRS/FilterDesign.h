@@ -0,0 +1,122 @@
+#pragma once
+#include "Core/Base.h"
+
+#include <array>
+#include <vector>
+
+namespace NIRS {
+
+	enum class FilterFamily {
+		Butterworth,
+		Chebyshev1
+	};
+
+	enum class FilterType {
+		Lowpass,
+		Highpass,
+		Bandpass
+	};
+
+	// Digital IIR filter description. Order is the order of the analog prototype like scipy's butter / cheby1,
+	// so a band-pass of order N has 2N poles. Lowpass uses HighCutoff, highpass LowCutoff. Frequencies in Hz
+	struct FilterSpecification {
+		FilterFamily Family = FilterFamily::Butterworth;
+		FilterType Type = FilterType::Bandpass;
+		int Order = 5;
+		double LowCutoff = 0.01;
+		double HighCutoff = 0.1;
+		double RippleDb = 0.5; // Passband ripple, Chebyshev only
+	};
+
+	// One second order section, normalized so a0 = 1
+	struct Biquad {
+		double B0 = 1.0, B1 = 0.0, B2 = 0.0;
+		double A1 = 0.0, A2 = 0.0;
+	};
+
+	// Designs the filter at runtime : analog prototype -> prewarped frequency transform -> bilinear transform,
+	// then poles and zeros are paired into sections, the ones nearest the unit circle last.
+	// Returns no sections (and logs) when the cutoffs do not fit below the Nyquist frequency of samplingRate
+	std::vector<Biquad> DesignFilter(const FilterSpecification& spec, double samplingRate);
+
+	using SectionState = std::array<double, 2>;
+
+	// State of every section after a long unit step, like scipy's sosfilt_zi. Scaled by the first sample
+	// of a signal it starts the filter as if the signal had always been at that level, so there is no edge transient
+	std::vector<SectionState> ComputeInitialConditions(const std::vector<Biquad>& sections);
+
+	// Samples of odd extension at each end for zero phase filtering, the same as scipy's sosfiltfilt
+	// default (3x the number of taps) but clamped to numSamples - 1 for short signals
+	size_t GetFiltFiltPadding(const std::vector<Biquad>& sections, size_t numSamples);
+
+	// Cascade of biquads in transposed direct form II. Each section only has two state values and
+	// its poles are only a pair, so it stays stable where a high order transfer function does not
+	class SOSFilter {
+	public:
+		SOSFilter() = default;
+		SOSFilter(const std::vector<Biquad>& sections);
+
+		double Process(double x);
+		// In place, one section at a time over the whole buffer so every pass is a short dependency chain.
+		// Values between sections are stored as T, filter float data in a double buffer when that matters
+		template<typename T>
+		void Process(T* data, size_t numSamples);
+		// Backward in time over the buffer, without reversing it
+		template<typename T>
+		void ProcessReverse(T* data, size_t numSamples);
+
+		// Zero phase in place, like scipy's sosfiltfilt : odd extensions at both ends and steady state initial
+		// conditions for both passes. Only the extensions need extra memory, they live in a scratch buffer owned
+		// by the filter, so filtering many channels with one filter does not allocate
+		void FiltFilt(double* data, size_t numSamples);
+
+		void Reset();
+		// Steady state for a signal starting at value, see ComputeInitialConditions
+		void SetSteadyState(double value);
+
+		const std::vector<Biquad>& GetSections() const { return m_Sections; }
+		bool IsEmpty() const { return m_Sections.empty(); }
+	private:
+		template<bool Reverse, typename T>
+		void Run(T* data, size_t numSamples);
+
+		std::vector<Biquad> m_Sections = {};
+		std::vector<SectionState> m_State = {};
+		std::vector<SectionState> m_InitialConditions = {};
+		std::vector<double> m_Scratch = {};
+	};
+
+	// The same cascade over many channels at once. Samples are interleaved, data[i * Lanes + lane], so every step
+	// of the recursion advances whole SIMD vectors of channels (see Core/SIMD.h) instead of one sample of one channel.
+	// Several vectors per step keep independent recursions in flight to hide the latency of each one
+	class InterleavedSOSFilter {
+	public:
+		static constexpr size_t Lanes = 16;
+
+		InterleavedSOSFilter() = default;
+		InterleavedSOSFilter(const std::vector<Biquad>& sections);
+
+		// Forward in time
+		void Process(double* data, size_t numSamples);
+		// Backward in time, the second pass of zero phase filtering without reversing the buffer
+		void ProcessReverse(double* data, size_t numSamples);
+
+		// Zero phase in place like SOSFilter::FiltFilt. The caller leaves padding free rows on both sides of the
+		// signal, data holds padding + numSamples + padding rows (see GetFiltFiltPadding) and the extensions are
+		// written there, so the interleaved buffer is the only memory the filter touches
+		void FiltFilt(double* data, size_t numSamples, size_t padding);
+
+		void Reset();
+		// Steady state of each lane for a signal starting at values[lane]
+		void SetSteadyState(const double* values);
+
+		bool IsEmpty() const { return m_Sections.empty(); }
+	private:
+		template<bool Reverse>
+		void Run(double* data, size_t numSamples);
+
+		std::vector<Biquad> m_Sections = {};
+		std::vector<double> m_State = {}; // sections x 2 x Lanes
+		std::vector<SectionState> m_InitialConditions = {};
+	};
+}
@@ -0,0 +1,100 @@
+#pragma once
+#include "Core/Base.h"
+
+#include <string>
+#include <vector>
+
+#include <Eigen/Dense>
+
+class ThreadPool;
+
+namespace NIRS {
+
+	// --- Design ---
+	struct GLMEvent {
+		double Onset = 0.0;    // seconds from the first sample
+		double Duration = 0.0; // seconds, 0 is an impulse
+		double Amplitude = 1.0;
+	};
+
+	struct GLMCondition {
+		std::string Name = "";
+		std::vector<GLMEvent> Events = {};
+	};
+
+	enum class GLMDrift {
+		None,
+		Polynomial, // Legendre polynomials up to DriftOrder over the recording
+		Cosine      // Discrete cosine set with periods down to DriftCutoffSeconds, like SPM's high-pass
+	};
+
+	struct GLMDesignSpecification {
+		std::vector<GLMCondition> Conditions = {};
+		double HRFSeconds = 32.0;
+
+		GLMDrift Drift = GLMDrift::Polynomial;
+		int DriftOrder = 3;
+		double DriftCutoffSeconds = 128.0;
+	};
+
+	// Columns are regressors, rows samples
+	struct GLMDesign {
+		Eigen::MatrixXd X;
+		std::vector<std::string> Regressors = {};
+	};
+
+	// SPM's canonical double gamma (peak at 6 s, undershoot at 16 s, ratio 1/6) sampled at samplingRate, sums to 1
+	std::vector<double> CanonicalHRF(double samplingRate, double duration = 32.0);
+
+	// One column per condition (its boxcar convolved with the HRF), then the drift terms and a constant
+	GLMDesign BuildDesignMatrix(const GLMDesignSpecification& spec, size_t numSamples, double samplingRate);
+
+	// --- Fit ---
+	enum class GLMSolverMethod {
+		Cholesky, // Normal equations, one pass over the data. The default, designs here are small and well scaled
+		QR        // Column pivoting Householder QR of X, for designs too close to collinear for the normal equations
+	};
+
+	struct GLMResult {
+		std::vector<std::string> Regressors = {};
+		Eigen::MatrixXd Betas;             // regressors x channels
+		Eigen::MatrixXd TValues;           // regressors x channels
+		Eigen::VectorXd ResidualVariance;  // per channel, residual sum of squares / degrees of freedom
+		std::vector<size_t> DegreesOfFreedom = {}; // per channel, samples - regressors of its design
+	};
+
+	// The design is factorized once, then every channel is a right-hand side of the same system.
+	// Channels are solved a block at a time straight from their (channel-major) sample arrays
+	class GLMSolver {
+	public:
+		GLMSolver(const GLMDesign& design, GLMSolverMethod method = GLMSolverMethod::Cholesky);
+
+		// False when the design is rank deficient for the method or has no degrees of freedom left (logged)
+		bool IsValid() const { return m_Valid; }
+		size_t GetNumSamples() const { return static_cast<size_t>(m_Design.X.rows()); }
+		size_t GetNumRegressors() const { return static_cast<size_t>(m_Design.X.cols()); }
+
+		// channels[c] has GetNumSamples() samples. Blocks of channels are fitted in parallel on pool, nullptr uses ThreadPool::Get()
+		template<typename T>
+		GLMResult Fit(const T* const* channels, size_t numChannels, ThreadPool* pool = nullptr) const;
+
+		// Fits channels[i] into column columns[i] of result, the first GetNumRegressors() rows.
+		// result has to be sized already, calls on disjoint columns can run concurrently
+		template<typename T>
+		void FitInto(const T* const* channels, const size_t* columns, size_t numChannels, GLMResult& result) const;
+	private:
+		GLMDesign m_Design;
+		GLMSolverMethod m_Method;
+		Eigen::LLT<Eigen::MatrixXd> m_Cholesky;
+		Eigen::ColPivHouseholderQR<Eigen::MatrixXd> m_QR;
+		Eigen::VectorXd m_InverseDiagonal; // diag((X'X)^-1), scales the betas into t-values
+		bool m_Valid = false;
+	};
+
+	// Channels whose designs differ only by a few regressors of their own, e.g. the nearest short channel.
+	// Every design in extras has the same columns, designs[c] picks the one of channel c (-1 for none).
+	// Channels sharing an index share a factorization of [base | extra]; extra rows are NaN for channels without one
+	template<typename T>
+	GLMResult FitGLMBatched(const GLMDesign& base, const std::vector<GLMDesign>& extras, const std::vector<int>& designs,
+		const T* const* channels, size_t numChannels, GLMSolverMethod method = GLMSolverMethod::Cholesky, ThreadPool* pool = nullptr);
+}
@@ -0,0 +1,23 @@
+#pragma once
+#include "Core/Base.h"
+
+#include <mutex>
+
+namespace NIRS {
+
+	// libhdf5 is not reentrant unless it is built thread-safe, and even then it serializes on one global lock.
+	// Every HDF5 call made while background loads can be running goes through this mutex
+	std::recursive_mutex& GetHDF5Mutex();
+
+	using HDF5Lock = std::lock_guard<std::recursive_mutex>;
+
+	// Wraps a HighFive object so it is also released under the lock, whichever thread drops the last reference.
+	// Call it while holding the lock
+	template<typename T>
+	Ref<T> MakeLockedHandle(T&& object) {
+		return Ref<T>(new T(std::move(object)), [](T* ptr) {
+			HDF5Lock lock(GetHDF5Mutex());
+			delete ptr;
+		});
+	}
+}
@@ -0,0 +1,31 @@
+#pragma once
+#include "Core/Base.h"
+
+#include <string>
+#include <vector>
+
+#include <highfive/H5Group.hpp>
+
+#include "NIRS/NIRS.h"
+
+namespace NIRS {
+
+	// One decoded measurement list, a row in the flat channel table
+	struct MeasurementListEntry {
+		uint32_t Index = 0; // 1-indexed, measurementList{Index} describes column Index - 1 of dataTimeSeries
+
+		int SourceIndex = 0;
+		int DetectorIndex = 0;
+		int WavelengthIndex = 0;
+		int DataType = 0;
+		int DataTypeIndex = 0;
+		std::string DataTypeLabel = ""; // Only read when it is needed to identify the channel (processed data)
+	};
+
+	// Decodes every measurement list of a data group into a flat table sorted by Index.
+	// Handles both the per-channel measurementList{i} groups, walked in a single link iteration pass,
+	// and the SNIRF v1.1 compact measurementLists table where each field is one array.
+	std::vector<MeasurementListEntry> ParseMeasurementLists(const HighFive::Group& data);
+
+	WavelengthType MeasurementListToWavelength(const MeasurementListEntry& entry);
+}
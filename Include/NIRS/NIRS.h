@@ -4,9 +4,11 @@
 #include <optional> // For C++17 and later
 #include <iostream>
 #include <string>
+#include <vector>
 #include <unordered_map>
 #include <algorithm> // For std::transform (optional, but good for case insensitivity)
 #include <map>
+#include <type_traits>
 
 namespace NIRS {
 
@@ -21,6 +23,22 @@ namespace NIRS {
     using ChannelDataID = uint32_t;
     using ChannelValue = double;
 
+    static constexpr ChannelDataID InvalidChannelDataID = (ChannelDataID)-1;
+
+    // How samples are stored in the channel data registry and the processed data cache.
+    // Float32 is the display and analysis tier, Float64 keeps full precision. The value is the element size
+    enum class SamplePrecision : uint32_t {
+        Float32 = 4,
+        Float64 = 8
+    };
+
+    template<typename T>
+    constexpr SamplePrecision PrecisionOf() {
+        static_assert(std::is_same_v<T, float> || std::is_same_v<T, double>, "Samples are float or double");
+        return std::is_same_v<T, float> ? SamplePrecision::Float32 : SamplePrecision::Float64;
+    }
+    constexpr size_t GetSampleSize(SamplePrecision precision) { return static_cast<size_t>(precision); }
+
     struct Line {
         glm::vec3 Start;
         glm::vec3 End;
@@ -63,13 +81,38 @@ namespace NIRS {
         ProbeID ID;
     };
 
+    // Which samples of a channel a registry lookup returns
+    enum class ChannelDataView {
+        Raw,
+        Processed
+    };
+
     struct Channel {
         ChannelID ID;
 
         ProbeID SourceID; // This is 1-indexed index
         ProbeID DetectorID;
         WavelengthType Wavelength;
-        ChannelDataID DataIndex; // Index into the channel data registry
+        ChannelDataID DataIndex = InvalidChannelDataID; // Index into the channel data registry
+        ChannelDataID ProcessedDataIndex = InvalidChannelDataID; // Preprocessed samples of the same channel
+
+        // Channels without preprocessed samples (data that was not raw intensity) show their raw samples in the Processed view
+        ChannelDataID GetDataIndex(ChannelDataView view) const {
+            if (view == ChannelDataView::Processed && ProcessedDataIndex != InvalidChannelDataID) return ProcessedDataIndex;
+            return DataIndex;
+        }
+    };
+
+    // --- Data Windows ---
+    // A block of samples for a time range and a subset of channels, read on demand from the file.
+    // Samples are channel-major : Samples[c * NumSamples + s] is sample s of Channels[c]
+    struct DataWindow {
+        size_t FirstSample = 0;
+        size_t NumSamples = 0;
+        std::vector<ChannelID> Channels = {};
+        std::vector<ChannelValue> Samples = {};
+
+        const ChannelValue* GetChannel(size_t index) const { return Samples.data() + index * NumSamples; }
     };
 
     struct ChannelVisualization {
@@ -0,0 +1,36 @@
+#pragma once
+#include "Core/Base.h"
+
+#include <cstddef>
+
+namespace NIRS {
+
+	// Intensity every optical density is taken against
+	enum class ODBaseline {
+		FirstSample,
+		Mean,   // of the first BaselineSeconds
+		Median  // of the first BaselineSeconds, robust to motion spikes at the start
+	};
+
+	struct OpticalDensitySpecification {
+		ODBaseline Baseline = ODBaseline::FirstSample;
+		double BaselineSeconds = 0.0; // Mean and Median only, 0 uses the whole recording
+	};
+
+	// Intensities below this (and NaN) are dropouts, their optical density is 0
+	constexpr double MinimumIntensity = 1e-9;
+
+	template<typename T>
+	double ComputeBaselineIntensity(const T* raw, size_t numSamples, double samplingRate, const OpticalDensitySpecification& spec = {});
+
+	// od[i] = log10(baseline / raw[i]) through SIMD::Log, within a few ulp of std::log10 and branchless,
+	// so it is bound by memory rather than libm. raw and od may be the same buffer
+	template<typename T>
+	void ConvertToOpticalDensity(const T* raw, T* od, size_t numSamples, double baseline);
+	// The stage as the preprocessing pipeline runs it : baseline from spec, then the conversion
+	template<typename T>
+	void ConvertToOpticalDensity(const T* raw, T* od, size_t numSamples, double samplingRate, const OpticalDensitySpecification& spec);
+
+	// od[i] = log10(baseline[i] / raw[i]) with a baseline per element, e.g. one frame of many channels
+	void ConvertFrameToOpticalDensity(const double* raw, const double* baseline, double* od, size_t count);
+}
@@ -0,0 +1,82 @@
+#pragma once
+#include "Core/Base.h"
+
+#include <filesystem>
+#include <functional>
+#include <vector>
+
+#include "Core/MappedFile.h"
+#include "NIRS/NIRS.h"
+
+namespace NIRS {
+
+	// Streaming xxHash64 of arbitrary data, used to fingerprint recordings
+	class ContentHasher {
+	public:
+		ContentHasher(uint64_t seed = 0);
+
+		void Update(const void* data, size_t size);
+		uint64_t Digest() const;
+	private:
+		uint64_t m_Lanes[4];
+		uint8_t m_Buffer[32];
+		size_t m_BufferSize = 0;
+		uint64_t m_TotalSize = 0;
+		uint64_t m_Seed = 0;
+	};
+
+	// What a sidecar was computed from. A sidecar is valid when the content and parameter hashes match,
+	// size and modification time only let a warm open skip re-hashing an unchanged file.
+	// ContentHash is whatever fingerprint of the recording the writer chose, SNIRF hashes the samples as it decodes them
+	struct ProcessedCacheKey {
+		uint64_t FileSize = 0;
+		int64_t FileModifiedTime = 0;
+		uint64_t ContentHash = 0;
+		uint64_t ParametersHash = 0;
+	};
+
+	// One data block of a recording as stored in the sidecar. Samples are channel-major
+	// (Channels.size() x NumSamples) of the given precision, DataIndex of the channels is not stored
+	struct ProcessedCacheBlock {
+		std::vector<Channel> Channels = {};
+		const void* Samples = nullptr;
+		SamplePrecision Precision = SamplePrecision::Float64;
+		size_t NumSamples = 0;
+		double SamplingRate = 0.0;
+
+		// T has to match Precision
+		template<typename T>
+		const T* GetChannelSamples(size_t channel) const {
+			NVIZ_ASSERT(PrecisionOf<T>() == Precision, "Cached samples have another precision");
+			return static_cast<const T*>(Samples) + channel * NumSamples;
+		}
+	};
+
+	// On-disk sidecar holding the channel tables and the preprocessed samples of every data block of a recording.
+	// Layout : header | block table | per block channel table and samples, each section 64 byte aligned and the
+	// samples channel-major floats or doubles, so a warm open maps the file and hands the samples to the registry without reading them
+	class ProcessedDataCache {
+	public:
+		static std::filesystem::path GetCachePath(const std::filesystem::path& recording, const std::filesystem::path& cacheDirectory = {});
+
+		// Size and modification time of the recording, the content hash is left for the caller
+		static ProcessedCacheKey MakeKey(const std::filesystem::path& recording, uint64_t parametersHash);
+
+		static bool Write(const std::filesystem::path& cachePath, const ProcessedCacheKey& key, const std::vector<ProcessedCacheBlock>& blocks);
+
+		// Maps the sidecar, nullptr when it is missing, corrupt or stale for this recording and parameters.
+		// hashContents recomputes ContentHash and is only called when the recording's modification time changed,
+		// without it such a sidecar counts as stale
+		static Ref<ProcessedDataCache> Open(const std::filesystem::path& cachePath, const std::filesystem::path& recording, uint64_t parametersHash,
+			const std::function<uint64_t()>& hashContents = nullptr);
+
+		// Blocks in the order they were written, Samples point into the mapping
+		size_t GetNumBlocks() const { return m_Blocks.size(); }
+		const ProcessedCacheBlock& GetBlock(size_t block) const { return m_Blocks[block]; }
+
+		const Ref<MappedFile>& GetMapping() const { return m_Mapping; }
+	private:
+		Ref<MappedFile> m_Mapping = nullptr;
+		std::vector<ProcessedCacheBlock> m_Blocks = {};
+	};
+}
@@ -1,53 +1,112 @@
 #pragma once
 
+#include <mutex>
+
 #include "Core/Base.h"
 #include "NIRS/NIRS.h"
+#include "NIRS/FilterDesign.h"
+#include "NIRS/BeerLambert.h"
+#include "NIRS/OpticalDensity.h"
 
 namespace NIRS
 {
+	// Parameters of the preprocessing pipeline. Hash() keys cached results, so every field that changes
+	// the output has to be part of it
+	struct PreprocessingSpecification {
+		float LowCutoff = 0.01f;  // Hz
+		float HighCutoff = 0.1f;  // Hz
+		int FilterOrder = 5;      // Butterworth prototype order, the band-pass has twice as many poles
+		OpticalDensitySpecification OpticalDensity = {};
+		bool MotionCorrection = false; // TDDR on the optical density, before the band-pass
+
+		// Raw intensity recordings end up as HbO / HbR in µM instead of optical density, see BeerLambertConverter
+		bool ConvertToConcentration = true;
+		MBLLSpecification BeerLambert = {};
+
+		uint64_t Hash() const;
+	};
+
+	// The mixing Hash() uses, for keys derived from the specification (e.g. per stage in ProcessingGraph)
+	uint64_t HashCombine(uint64_t seed, uint64_t value);
+	uint64_t HashDouble(double value);
+
+	// Working memory of the filter and TDDR. Buffers grow to the longest channel they have seen and are reused
+	// after that, so a task that keeps one across channel groups does not allocate per group
+	struct ProcessingScratch {
+		std::vector<double> Interleaved = {}; // Padded channel group of FilterHemodynamicChannels
+		std::vector<double> Signal = {};      // TDDR
+		std::vector<double> Low = {};
+		std::vector<double> Derivative = {};
+		std::vector<double> Weights = {};
+		std::vector<double> Deviations = {};
+	};
+
+	// Scratch for the tasks of a ParallelFor : Acquire hands out a free one and only makes a new one when all are in use,
+	// so there are never more than the number of threads working at once. Owned by a load or a graph update, the
+	// buffers are freed with it
+	class ProcessingScratchPool {
+	public:
+		class Lease {
+		public:
+			Lease(ProcessingScratchPool& pool, ProcessingScratch* scratch) : m_Pool(pool), m_Scratch(scratch) {}
+			~Lease() { m_Pool.Release(m_Scratch); }
+			Lease(const Lease&) = delete;
+			Lease& operator=(const Lease&) = delete;
+
+			ProcessingScratch* Get() const { return m_Scratch; }
+		private:
+			ProcessingScratchPool& m_Pool;
+			ProcessingScratch* m_Scratch;
+		};
+
+		Lease Acquire();
+	private:
+		void Release(ProcessingScratch* scratch);
+
+		std::mutex m_Mutex;
+		std::vector<Scope<ProcessingScratch>> m_Scratch = {};
+		std::vector<ProcessingScratch*> m_Free = {};
+	};
 
 	void PreprocessHemodynamicData(const std::vector<NIRS::ChannelValue>& rawData,
 		std::vector<NIRS::ChannelValue>& processedData,
 		float samplingRate);
+	void PreprocessHemodynamicData(const NIRS::ChannelValue* rawData, size_t numSamples,
+		std::vector<NIRS::ChannelValue>& processedData,
+		float samplingRate,
+		const PreprocessingSpecification& spec = {});
+	// Writes numSamples values to processedData. T is the storage precision (float or double),
+	// the filter itself always runs in double
+	template<typename T>
+	void PreprocessHemodynamicData(const T* rawData, size_t numSamples, T* processedData,
+		float samplingRate,
+		const PreprocessingSpecification& spec = {});
+	// Same for a group of channels recorded at the same rate, rawData[c] -> processedData[c]. The channels go
+	// through the filter together, InterleavedSOSFilter::Lanes at a time, so pass as many as are at hand.
+	// Without scratch the working buffers are allocated for this call
+	template<typename T>
+	void PreprocessHemodynamicChannels(const T* const* rawData, T* const* processedData, size_t numChannels, size_t numSamples,
+		float samplingRate,
+		const PreprocessingSpecification& spec = {},
+		ProcessingScratch* scratch = nullptr);
+	// The band-pass stage alone : zero phase filter of sections over input[c] -> output[c], which may be the same rows.
+	// Channels are filtered InterleavedSOSFilter::Lanes at a time, nothing is written when sections is empty
+	template<typename T>
+	void FilterHemodynamicChannels(const T* const* input, T* const* output, size_t numChannels, size_t numSamples,
+		const std::vector<Biquad>& sections, ProcessingScratch* scratch = nullptr);
+	// Band-pass of the specification, no sections (and an error logged) when the cutoffs do not fit samplingRate
+	std::vector<Biquad> DesignBandpass(const PreprocessingSpecification& spec, float samplingRate);
 
 
-	void ButterworthBandpassFilter(std::vector<NIRS::ChannelValue>& data, float sampleRate, float lowerCutoff, float higherCutoff);
+	// Temporal Derivative Distribution Repair (Fishburn et al. 2019), in place on optical density.
+	// The derivative of the low frequency part is reweighted with Tukey's biweight until its robust mean converges,
+	// outlier steps (motion) get weight 0, then the signal is integrated back. Same steps as MNE's implementation,
+	// the weighting passes run on SIMD::DoubleVec and the median is a selection, so each iteration is O(n)
+	template<typename T>
+	void CorrectMotionArtifactsTDDR(T* data, size_t numSamples, double samplingRate, ProcessingScratch* scratch = nullptr);
 
-}
+	// Zero phase (forward-backward) band-pass designed for sampleRate, data is left untouched when the cutoffs do not fit
+	void ButterworthBandpassFilter(std::vector<NIRS::ChannelValue>& data, float sampleRate, float lowerCutoff, float higherCutoff, int order = 5);
 
+}
 
-class IIRFilter {
-public:
-    IIRFilter(const std::vector<double>& b, const std::vector<double>& a)
-        : b_(b), a_(a), z_(std::max(b.size(), a.size()) - 1, 0.0)
-    {
-        if (a_[0] != 1.0) {
-            for (auto& coeff : b_) coeff /= a_[0];
-            for (size_t i = 1; i < a_.size(); ++i) a_[i] /= a_[0];
-            a_[0] = 1.0;
-        }
-    }
-
-    double process(double x)
-    {
-        double y = b_[0] * x + z_[0];
-        for (size_t i = 1; i < z_.size(); ++i)
-            z_[i - 1] = b_[i] * x + z_[i] - a_[i] * y;
-        z_.back() = b_.back() * x - a_.back() * y;
-        return y;
-    }
-
-    std::vector<double> process(const std::vector<double>& input)
-    {
-        std::vector<double> output;
-        output.reserve(input.size());
-        for (double x : input)
-            output.push_back(process(x));
-        return output;
-    }
-
-private:
-    std::vector<double> b_;
-    std::vector<double> a_;
-    std::vector<double> z_;
-};
\ No newline at end of file
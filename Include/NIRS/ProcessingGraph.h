@@ -0,0 +1,139 @@
+#pragma once
+#include "Core/Base.h"
+
+#include <array>
+#include <vector>
+
+#include "NIRS/NIRS.h"
+#include "NIRS/ChannelDataRegistry.h"
+#include "NIRS/Processing.h"
+#include "NIRS/GLM.h"
+#include "NIRS/Epochs.h"
+
+class ThreadPool;
+
+namespace NIRS {
+
+	// Nodes of the processing graph, every node reads the one before it except Epochs, which reads BeerLambert like GLM
+	enum class ProcessingStage {
+		OpticalDensity = 0,
+		MotionCorrection,
+		Filter,
+		BeerLambert,
+		GLM,
+		Epochs,
+		Count
+	};
+	constexpr size_t NumProcessingStages = static_cast<size_t>(ProcessingStage::Count);
+	const char* ProcessingStageToString(ProcessingStage stage);
+
+	// What a graph processes. Raw rows are not copied, they have to stay valid for the lifetime of the graph
+	template<typename T>
+	struct ProcessingGraphSource {
+		std::vector<const T*> Raw = {};          // Raw[c] is the intensity of Channels[c]
+		std::vector<Channel> Channels = {};
+		size_t NumSamples = 0;
+		double SamplingRate = 0.0;
+
+		// Probe of the channels, for the Beer-Lambert node (see BeerLambertConverter)
+		std::vector<int> Wavelengths = {};       // File order
+		std::vector<Probe3D> Sources = {};
+		std::vector<Probe3D> Detectors = {};
+		double CentimetersPerUnit = 0.1;
+	};
+
+	// Channels recomputed per stage by one Update()
+	struct ProcessingUpdate {
+		std::array<size_t, NumProcessingStages> Channels = {};
+		double Seconds = 0.0;
+
+		size_t GetTotal() const {
+			size_t total = 0;
+			for (size_t count : Channels) total += count;
+			return total;
+		}
+	};
+
+	// The preprocessing pipeline as a graph of cached nodes : OD -> motion correction -> filter -> Beer-Lambert -> GLM / epochs.
+	// Every node keeps its output together with a hash per channel of the node's parameters and of the input channels
+	// it read. Update() walks the nodes in order and only recomputes the channels whose hash changed, so a new band-pass
+	// cutoff re-filters from the cached optical density and a new DPF only converts the pairs it belongs to.
+	// Disabled nodes pass their input through and hold no samples. Setters only record, Update() does the work;
+	// pointers returned by the getters stay valid until the next Update()
+	template<typename T>
+	class ProcessingGraph {
+	public:
+		ProcessingGraph(ProcessingGraphSource<T> source, const PreprocessingSpecification& spec = {});
+
+		void SetPreprocessing(const PreprocessingSpecification& spec) { m_Preprocessing = spec; }
+		const PreprocessingSpecification& GetPreprocessing() const { return m_Preprocessing; }
+
+		// The GLM node only runs with a design, design regressors are built for the source's samples and rate
+		void SetGLM(const GLMDesignSpecification& spec, GLMSolverMethod method = GLMSolverMethod::Cholesky);
+		void ClearGLM();
+
+		// The epoch node only runs with onsets
+		void SetEpochs(const EpochSpecification& spec) { m_Epochs = spec; }
+
+		// The raw samples of these channels changed in place, everything downstream of them is recomputed
+		void InvalidateChannels(const std::vector<size_t>& channels);
+
+		// Channels are recomputed in parallel on pool, nullptr uses ThreadPool::Get()
+		ProcessingUpdate Update(ThreadPool* pool = nullptr);
+
+		size_t GetNumChannels() const { return m_Source.Channels.size(); }
+		size_t GetNumSamples() const { return m_Source.NumSamples; }
+
+		// Time series of a channel after stage, nullptr for GLM and Epochs
+		const T* GetChannel(ProcessingStage stage, size_t channel) const;
+		// What the loader registers as processed samples
+		const T* GetProcessedChannel(size_t channel) const { return GetChannel(ProcessingStage::BeerLambert, channel); }
+
+		const GLMResult& GetGLMResult() const { return m_GLMResult; }
+		// Empty until epochs are set
+		const EpochAverage& GetEpochAverage() const { return m_EpochAverage; }
+	private:
+		struct Node {
+			ChannelDataBlockT<T> Output = {};  // Empty while the node passes through
+			std::vector<const T*> Rows = {};   // Output of every channel, into Output or the input node
+			std::vector<uint64_t> Hashes = {}; // Of what Output holds per channel, 0 is nothing
+		};
+
+		Node& GetNode(ProcessingStage stage) { return m_Nodes[static_cast<size_t>(stage)]; }
+
+		// Rows of node become its input's, no samples are kept
+		void PassThrough(Node& node, const Node& input);
+		// Allocates numSamples per channel, forgetting what the node held before when the size changes
+		void Allocate(Node& node, size_t numSamples);
+		// Channels whose target hash differs from what node holds
+		std::vector<size_t> GetStale(const Node& node, const std::vector<uint64_t>& hashes) const;
+
+		size_t UpdateBeerLambert(ThreadPool& pool);
+		size_t UpdateGLM(ThreadPool& pool);
+		size_t UpdateEpochs(ThreadPool& pool);
+
+		ProcessingGraphSource<T> m_Source;
+		PreprocessingSpecification m_Preprocessing;
+		std::vector<uint64_t> m_RawRevisions = {};
+
+		std::array<Node, NumProcessingStages> m_Nodes = {};
+
+		// Rebuilt when their parameters change
+		std::vector<Biquad> m_Sections = {};
+		uint64_t m_SectionsHash = 0;
+		BeerLambertConverter m_Converter;
+		uint64_t m_ConverterHash = 0;
+
+		bool m_GLMEnabled = false;
+		GLMDesignSpecification m_GLMSpecification;
+		GLMSolverMethod m_GLMMethod = GLMSolverMethod::Cholesky;
+		Scope<GLMSolver> m_GLMSolver = nullptr;
+		uint64_t m_GLMHash = 0;
+		GLMResult m_GLMResult;
+
+		EpochSpecification m_Epochs;
+		Scope<EpochAverager> m_EpochAverager = nullptr;
+		uint64_t m_EpochsHash = 0;
+		EpochAverage m_EpochAverage;
+	};
+}
@@ -0,0 +1,44 @@
+#pragma once
+#include "Core/Base.h"
+
+#include <filesystem>
+#include <functional>
+#include <vector>
+
+#include "NIRS/Snirf.h"
+
+struct SNIRFLibraryScanStats {
+	size_t Files = 0;     // .snirf files found
+	size_t Probed = 0;    // New or changed since the last scan
+	size_t Reused = 0;    // Taken from the index as is
+	size_t Removed = 0;   // Index entries whose file is gone
+	size_t Failed = 0;
+	double Seconds = 0.0;
+};
+
+// Summaries of every SNIRF file below a directory, kept in a persistent index file so a rescan only
+// probes files that are new or whose size or modification time changed
+class SNIRFLibrary {
+public:
+	// An empty indexPath keeps the index in <root>/.nvizindex
+	SNIRFLibrary(const std::filesystem::path& root, const std::filesystem::path& indexPath = {});
+
+	// False when there is no usable index, the library is then empty until Scan
+	bool LoadIndex();
+	bool SaveIndex() const;
+
+	// Walks the root, probes new and changed files in parallel on the pool (ThreadPool::Get() when nullptr)
+	// and drops entries of deleted files. OnProgress gets (probed, toProbe) from pool threads, one call at a time
+	// with probed increasing, so it does not need to be thread safe. It should be quick, probes wait on it
+	SNIRFLibraryScanStats Scan(bool recursive = true, ThreadPool* pool = nullptr,
+		const std::function<void(size_t done, size_t total)>& onProgress = nullptr);
+
+	// Sorted by path
+	const std::vector<SNIRFSummary>& GetEntries() const { return m_Entries; }
+	const std::filesystem::path& GetRoot() const { return m_Root; }
+	const std::filesystem::path& GetIndexPath() const { return m_IndexPath; }
+private:
+	std::filesystem::path m_Root;
+	std::filesystem::path m_IndexPath;
+	std::vector<SNIRFSummary> m_Entries = {};
+};
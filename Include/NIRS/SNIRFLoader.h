@@ -0,0 +1,35 @@
+#pragma once
+#include "Core/Base.h"
+
+#include <filesystem>
+#include <unordered_map>
+#include <atomic>
+#include <mutex>
+
+#include "NIRS/Snirf.h"
+#include "Events/EventBus.h"
+
+// Loads SNIRF files on the shared thread pool so the UI keeps rendering.
+// Progress, completion and failure are posted to the EventBus as SNIRFFileLoadProgressEvent,
+// SNIRFFileLoadedEvent and SNIRFFileLoadFailedEvent, delivered on the main thread by EventBus::DispatchPosted
+class SNIRFLoader {
+public:
+	static SNIRFLoader& Get();
+
+	SNIRFLoadID LoadAsync(const std::filesystem::path& filepath, const SNIRFLoadSpecification& spec = {});
+
+	// The load stops at its next checkpoint and posts a SNIRFFileLoadFailedEvent with Cancelled set
+	void Cancel(SNIRFLoadID id);
+	void CancelAll();
+
+	bool IsLoading();
+private:
+	SNIRFLoader() = default;
+
+	void RunLoad(SNIRFLoadID id, std::filesystem::path filepath, SNIRFLoadSpecification spec, Ref<std::atomic<bool>> cancelToken);
+
+	std::atomic<SNIRFLoadID> m_NextLoadID = 1;
+
+	std::mutex m_Mutex;
+	std::unordered_map<SNIRFLoadID, Ref<std::atomic<bool>>> m_ActiveLoads;
+};
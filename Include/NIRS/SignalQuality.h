@@ -0,0 +1,79 @@
+#pragma once
+#include "Core/Base.h"
+
+#include <vector>
+
+#include "NIRS/NIRS.h"
+
+class ThreadPool;
+
+namespace NIRS {
+
+	// Bits of SignalQuality::Flags, a window is good when none is set
+	enum QualityFlag : uint8_t {
+		QualityGood = 0,
+		QualityLowSCI = 1 << 0,
+		QualityLowPSP = 1 << 1,
+		QualityHighCV = 1 << 2
+	};
+
+	struct SignalQualitySpecification {
+		double WindowSeconds = 5.0;
+		double StepSeconds = 5.0;
+
+		// Cardiac band, both wavelengths of a well coupled optode pulse together in it
+		double CardiacLow = 0.5;  // Hz
+		double CardiacHigh = 2.5; // Hz
+		int FilterOrder = 3;
+
+		float MinSCI = 0.75f; // Scalp coupling index, correlation of the two wavelengths in the cardiac band
+		float MinPSP = 0.1f;  // Peak spectral power of that cross-correlation, 0.5 for a clean pulse
+		float MaxCV = 0.1f;   // Coefficient of variation of the raw intensity, std / mean
+
+		// A channel is bad when less than this fraction of its windows is good
+		float MinGoodWindows = 0.75f;
+	};
+
+	// Quality of every channel table row in every window, channel-major : row c holds NumWindows values.
+	// SCI and PSP belong to a source-detector pair and are the same for its channels, NaN for a channel without
+	// a second wavelength (those are never flagged for it). Window w covers samples [w * StepSamples, w * StepSamples + WindowSamples)
+	struct SignalQuality {
+		size_t NumChannels = 0;
+		size_t NumWindows = 0;
+		size_t WindowSamples = 0;
+		size_t StepSamples = 0;
+
+		std::vector<float> SCI = {};
+		std::vector<float> PSP = {};
+		std::vector<float> CV = {};
+		std::vector<uint8_t> Flags = {};        // QualityFlag bits per channel and window
+
+		std::vector<float> GoodFraction = {};   // Per channel, of its windows
+		std::vector<uint8_t> BadChannels = {};  // Per channel, 1 when GoodFraction < MinGoodWindows
+
+		bool IsEmpty() const { return NumChannels == 0 || NumWindows == 0; }
+		bool IsBad(size_t channel) const { return BadChannels[channel] != 0; }
+		size_t GetNumBadChannels() const {
+			size_t count = 0;
+			for (uint8_t bad : BadChannels) count += bad;
+			return count;
+		}
+
+		const float* GetSCI(size_t channel) const { return SCI.data() + channel * NumWindows; }
+		const float* GetPSP(size_t channel) const { return PSP.data() + channel * NumWindows; }
+		const float* GetCV(size_t channel) const { return CV.data() + channel * NumWindows; }
+		const uint8_t* GetFlags(size_t channel) const { return Flags.data() + channel * NumWindows; }
+	};
+
+	// channels[c] is the raw intensity of channel table row c. Channels with the same source and detector are paired by
+	// Channel::Wavelength, the first two wavelengths of a pair are compared. Every pair is one streaming pass after the
+	// cardiac band-pass : running sums give SCI and CV as the window slides, and a sliding DFT of both wavelengths over
+	// the cardiac bins gives the Hann windowed cross-spectrum, whose peak is PSP. Pairs run in parallel on pool,
+	// nullptr uses ThreadPool::Get(). The window is shortened to the recording when it is longer
+	template<typename T>
+	SignalQuality ComputeSignalQuality(const T* const* channels, const std::vector<Channel>& table, size_t numSamples,
+		double samplingRate, const SignalQualitySpecification& spec = {}, ThreadPool* pool = nullptr);
+
+	// Rows of table that are not bad, in order, for channel lists that should skip them
+	std::vector<Channel> GetGoodChannels(const std::vector<Channel>& table, const SignalQuality& quality);
+}
@@ -3,142 +3,272 @@
 
 #include <string>
 #include <filesystem>
+#include <functional>
+#include <atomic>
+#include <mutex>
+#include <algorithm>
 
 #include <Eigen/Dense>
 
 #include <highfive/H5Group.hpp>
+#include <highfive/H5File.hpp>
 
 #include "NIRS/NIRS.h"
+#include "NIRS/ChannelDataRegistry.h"
+#include "NIRS/Processing.h"
+#include "NIRS/ProcessingGraph.h"
+#include "NIRS/SignalQuality.h"
+#include "NIRS/TimeBase.h"
+
+class ThreadPool;
+
+struct SNIRFLoadSpecification {
+	// When Windowed is set, LoadFile only reads the metadata and the first InitialWindowSeconds of
+	// dataTimeSeries. Everything else is pulled on demand with SNIRF::ReadWindow.
+	bool Windowed = false;
+	double InitialWindowSeconds = 30.0;
+
+	// Optional hooks for background loads (see SNIRFLoader). OnProgress is called with a value in [0, 1]
+	// from the loading thread or a pool thread, never from two at once. Setting CancelToken makes LoadFile
+	// stop at the next checkpoint and return false. Both only live for the LoadFile call, the SNIRF drops them
+	// before returning
+	std::function<void(float progress, const std::string& stage)> OnProgress = nullptr;
+	const std::atomic<bool>* CancelToken = nullptr;
+
+	// Preprocessed samples are kept in a <file>.nvizcache sidecar keyed by a fingerprint of the recording (probe,
+	// channel tables and samples) and these parameters. A warm open maps the sidecar instead of reading and
+	// filtering the signal again.
+	// An empty CacheDirectory puts the sidecar next to the recording
+	NIRS::PreprocessingSpecification Preprocessing = {};
+	bool UseProcessedCache = true;
+	std::filesystem::path CacheDirectory = {};
+
+	// Precision of the raw and preprocessed samples kept in the registry and the sidecar. Float32 halves
+	// the memory of long sessions and is plenty for display and analysis, filtering always runs in double
+	NIRS::SamplePrecision StoragePrecision = NIRS::SamplePrecision::Float32;
+
+	// SCI / PSP / CV of every continuous wave block while its raw samples are at hand, see SNIRFDataBlock::Quality
+	bool ComputeQuality = true;
+	NIRS::SignalQualitySpecification Quality = {};
+
+	// Min / max / mean pyramids of every registry entry for time series views (ChannelDataRegistry::FetchEnvelope)
+	bool BuildPyramids = true;
+
+	// Channels are preprocessed in parallel on this pool, nullptr uses ThreadPool::Get()
+	ThreadPool* Pool = nullptr;
+};
 
-class ChannelDataRegistry {
-	using ChannelData = std::vector<double>;
-public:
-	ChannelDataRegistry() {
-		NVIZ_ASSERT(!s_Instance, "ChannelDataRegistry instance already exists!");
-		s_Instance = this;
-	};
+// Wall clock seconds spent in each phase of the last LoadFile
+struct SNIRFLoadTimings {
+	double Probe = 0.0;
+	double Metadata = 0.0; // time axis and measurement lists
+	double Signal = 0.0;   // dataTimeSeries
+	double Preprocessing = 0.0;
+	double Quality = 0.0;
+	double Pyramids = 0.0;
+	double Total = 0.0;
+	bool FromCache = false; // Signal and preprocessing were served by the processed data cache
+};
 
-	int SubmitChannelData(const ChannelData& data) {
-		std::size_t hash_val = HashChannelData(data);
+// Probe geometry of one /nirs{i} element, channel source and detector IDs index into it
+struct SNIRFProbe {
+	std::vector<NIRS::Probe2D> Sources2D = {};
+	std::vector<NIRS::Probe2D> Detectors2D = {};
+	std::vector<NIRS::Probe3D> Sources3D = {};
+	std::vector<NIRS::Probe3D> Detectors3D = {};
+	std::vector<int> Wavelengths = {};     // Sorted ascending
+	std::vector<int> FileWavelengths = {}; // As stored, measurement list wavelength index i is FileWavelengths[i - 1]
 
-		if (m_LookupMap.count(hash_val)) { 
-			int potential_index = m_LookupMap.at(hash_val);
-			if (m_DataStorage[potential_index] == data) {
-				return potential_index;
-			}
-		}
+	double CentimetersPerUnit = 0.1; // Probe positions are in metaDataTags/LengthUnit, mm when it is missing
+};
 
-		int new_index = static_cast<int>(m_DataStorage.size());
-		m_DataStorage.push_back(data); 
+// One /nirs{i}/data{j} group. Multi-run files have a block per run, hyperscanning files a nirs element
+// (and probe) per subject. Every block has its own channel table and time base
+struct SNIRFDataBlock {
+	std::string Path = "";  // e.g. /nirs2/data1
+	size_t ProbeIndex = 0;  // Into SNIRF::GetProbes()
 
-		m_LookupMap[hash_val] = new_index;
+	std::vector<NIRS::Channel> Channels = {};
+	size_t NumSamples = 0;
+	size_t NumChannels = 0; // dataTimeSeries columns, channel ID c is column c - 1
+	int DataType = 0;       // measurementList dataType of the channels, 1 is continuous wave intensity
 
-		return new_index;
-	}
-	const ChannelData& GetChannelData(int index) const {
-		if (index < 0 || index >= m_DataStorage.size()) {
-			NVIZ_ERROR("Invalid channel data index: {}", index);
-			throw std::out_of_range("Invalid channel data index.");
-		}
-		return m_DataStorage[index];
-	}
-	
-	void Clear() {
-		m_DataStorage.clear();
-		m_LookupMap.clear();
-	}
+	NIRS::TimeBase Time = {};
 
-	static ChannelDataRegistry& Get() {
-		return *s_Instance;
-	}
-private:
-	std::vector<ChannelData> m_DataStorage;
-
-	// Map to quickly check if a vector with the same content hash already exists.
-	// Key: Hash of the ChannelData content. Value: Index in data_storage_.
-	std::unordered_map<std::size_t, int> m_LookupMap;
-
-	std::size_t HashChannelData(const ChannelData& data) const {
-		// Simple hash combining the size and a few values.
-		// For a more robust solution, a non-cryptographic polynomial rolling hash
-		// (like FNV-1a or MurmurHash) is usually better. 
-		// For demonstration, here's a basic size-and-checksum-based hash:
-
-		std::size_t seed = data.size();
-		for (double d : data) {
-			// Combine hash of the double with the current seed
-			// This is a common pattern for combining hashes in C++
-			std::hash<double> double_hasher;
-			seed ^= double_hasher(d) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
-		}
-		return seed;
-	}
+	// False for blocks that were not raw intensity, there is nothing to preprocess and the Processed view shows Raw
+	bool HasProcessedData() const { return !Channels.empty() && Channels.front().ProcessedDataIndex != NIRS::InvalidChannelDataID; }
+
+	// Channel x window quality of the raw intensity, rows in channel table order. Empty for other data types and
+	// for loads served from the processed data cache, which has no raw samples
+	NIRS::SignalQuality Quality = {};
+};
+
+// One /nirs{i}/stim{j} group, onsets are on the time axis of the data blocks of the same nirs element
+struct SNIRFStim {
+	std::string Path = "";  // e.g. /nirs1/stim2
+	size_t ProbeIndex = 0;  // The nirs element, blocks with the same ProbeIndex share the stims
+	NIRS::StimCondition Condition = {};
+};
+
+// Shape of a data block as seen by SNIRF::Probe, only dimensions and the first and last timestamp are read
+struct SNIRFDataBlockSummary {
+	std::string Path = "";
+	size_t ProbeIndex = 0;
+	size_t NumSamples = 0;
+	size_t NumChannels = 0;
 
-	static ChannelDataRegistry* s_Instance;
+	double StartTime = 0.0;
+	double EndTime = 0.0;
+	double SamplingRate = 0.0;
+};
+
+// What a file browser shows about a recording. Cheap to produce : no measurement lists and no samples
+struct SNIRFSummary {
+	std::filesystem::path Filepath = {};
+	uintmax_t FileSize = 0;
+	int64_t ModifiedTime = 0; // file_time_type ticks, only compared for equality
+
+	bool Valid = false;
+	std::string Error = "";
+
+	std::vector<SNIRFProbe> Probes = {};
+	std::vector<SNIRFDataBlockSummary> Blocks = {};
+
+	double GetDuration() const {
+		double duration = 0.0;
+		for (const auto& block : Blocks) duration = std::max(duration, block.EndTime - block.StartTime);
+		return duration;
+	}
 };
 
 class SNIRF {
 public:
 	SNIRF();
-	SNIRF(const std::filesystem::path& filepath);
+	SNIRF(const std::filesystem::path& filepath, const SNIRFLoadSpecification& spec = {});
+	~SNIRF();
 
 	void Print();
 
-	void LoadFile(const std::filesystem::path& filepath);
+	// Returns false when the file could not be opened or the load was cancelled
+	bool LoadFile(const std::filesystem::path& filepath, const SNIRFLoadSpecification& spec = {});
+
+	// Quick open : probes, dataTimeSeries dimensions and time endpoints of every block, nothing else.
+	// Never throws, failures are reported through SNIRFSummary::Error
+	static SNIRFSummary Probe(const std::filesystem::path& filepath);
+
+	// Reads the samples in [t0, t1) seconds of a data block for the given channel IDs (all channels when empty)
+	// through a hyperslab selection, only the chunks that intersect the window are touched.
+	// The returned window lists its channels in ascending ID order.
+	NIRS::DataWindow ReadWindow(double t0, double t1, const std::vector<NIRS::ChannelID>& channels = {}, size_t block = 0);
+	NIRS::DataWindow ReadSampleWindow(size_t firstSample, size_t numSamples, const std::vector<NIRS::ChannelID>& channels = {}, size_t block = 0);
+
+	// The window of the first block read during a windowed load
+	const NIRS::DataWindow& GetVisibleWindow() { return m_VisibleWindow; };
 
 	void ParseMetadataTags(const HighFive::Group& metadata);
-	void ParseProbe(const HighFive::Group& probe);
-	void ParseData1(const HighFive::Group& data1);
+	static void ParseProbe(const HighFive::Group& probe, SNIRFProbe& out);
+	// name, data (events x [onset, duration, amplitude, ...]) and dataLabels of a stim group, false when data is unreadable
+	static bool ParseStim(const HighFive::Group& stim, NIRS::StimCondition& out);
+	// Time base and dimensions of a data group, the channel table is filled by ParseMeasurementLists.
+	// false when dataTimeSeries is not 2D or the time vector does not match its rows
+	bool ParseDataBlock(const HighFive::Group& data, SNIRFDataBlock& block);
+	void ParseMeasurementLists(const HighFive::Group& data, SNIRFDataBlock& block);
 
 	std::string GetFilepath() { return m_Filepath.string(); };
 
 	bool IsFileLoaded() { return !m_Filepath.empty(); };
 
+	// Every nirs/data block of the file, in /nirs1/data1, /nirs1/data2, ..., /nirs2/data1 order
+	const std::vector<SNIRFDataBlock>& GetDataBlocks() { return m_Blocks; };
+	const std::vector<SNIRFProbe>& GetProbes() { return m_Probes; };
+	// Every stim group of the file, in /nirs1/stim1, /nirs1/stim2, ... order
+	const std::vector<SNIRFStim>& GetStims() { return m_Stims; };
+	size_t GetNumDataBlocks() { return m_Blocks.size(); };
+
 
 	//std::vector<NIRS::Landmark> GetLandmarks() { return m_ManualLandmarks; };
 
+	// The accessors below describe the first block and its probe, which is all single run files have
 
-	std::vector<NIRS::Probe2D> GetSources2D() { return m_Sources2D; };
-	std::vector<NIRS::Probe3D> GetSources3D() { return m_Sources3D; };
+	std::vector<NIRS::Probe2D> GetSources2D() { return GetPrimaryProbe().Sources2D; };
+	std::vector<NIRS::Probe3D> GetSources3D() { return GetPrimaryProbe().Sources3D; };
 
-	std::vector<NIRS::Probe2D> GetDetectors2D() { return m_Detectors2D; };
-	std::vector<NIRS::Probe3D> GetDetectors3D() { return m_Detectors3D; };
+	std::vector<NIRS::Probe2D> GetDetectors2D() { return GetPrimaryProbe().Detectors2D; };
+	std::vector<NIRS::Probe3D> GetDetectors3D() { return GetPrimaryProbe().Detectors3D; };
 
-	NIRS::Probe2D GetDetector2D(int index) { return m_Detectors2D[index]; };
-	NIRS::Probe3D GetDetector3D(int index) { return m_Detectors3D[index]; };
+	NIRS::Probe2D GetDetector2D(int index) { return GetPrimaryProbe().Detectors2D[index]; };
+	NIRS::Probe3D GetDetector3D(int index) { return GetPrimaryProbe().Detectors3D[index]; };
 
-	NIRS::Probe2D GetSource2D(int index) { return m_Sources2D[index]; };
-	NIRS::Probe3D GetSource3D(int index) { return m_Sources3D[index]; };
+	NIRS::Probe2D GetSource2D(int index) { return GetPrimaryProbe().Sources2D[index]; };
+	NIRS::Probe3D GetSource3D(int index) { return GetPrimaryProbe().Sources3D[index]; };
 
-	std::vector<NIRS::Channel> GetChannels() { return m_Channels; };
+	std::vector<NIRS::Channel> GetChannels() { return GetPrimaryBlock().Channels; };
 
-	std::vector<int> GetWavelengths() { return m_Wavelengths; };
+	std::vector<int> GetWavelengths() { return GetPrimaryProbe().Wavelengths; };
 
-	int GetSourceAmount()	{ return m_Sources2D.size(); };
-	int GetDetectorAmount()	{ return m_Detectors2D.size(); };
+	int GetSourceAmount()	{ return GetPrimaryProbe().Sources2D.size(); };
+	int GetDetectorAmount()	{ return GetPrimaryProbe().Detectors2D.size(); };
 
-	double GetSamplingRate() { return m_SamplingRate; };
-	std::vector<double> GetTime() { return m_Time; };
+	double GetSamplingRate() { return GetPrimaryBlock().Time.GetSamplingRate(); };
+	const NIRS::TimeBase& GetTime() { return GetPrimaryBlock().Time; };
+
+	size_t GetNumSamples()	{ return GetPrimaryBlock().NumSamples; };
+	size_t GetNumChannels() { return GetPrimaryBlock().NumChannels; };
+
+	// False for processed or concentration blocks, which are only ever shown as stored
+	bool HasProcessedData(size_t block = 0) { return block < m_Blocks.size() && m_Blocks[block].HasProcessedData(); };
+
+	size_t TimeToSample(double seconds, size_t block = 0);
+
+	const SNIRFLoadTimings& GetLoadTimings() { return m_LoadTimings; };
+
+	ChannelDataRegistry& GetChannelDataRegistry() { return m_ChannelDataRegistry; };
+
+	// Raw rows and probe of a data block for a NIRS::ProcessingGraph, re-tuning the preprocessing then works on the
+	// loaded samples instead of a reload. After a load served from the processed data cache the raw samples are read
+	// from the file on the first call. Empty (and logged) when the block is not continuous wave intensity or its raw
+	// samples are in the registry with another precision than T
+	template<typename T>
+	NIRS::ProcessingGraphSource<T> GetProcessingGraphSource(size_t block = 0);
+
+	// Block average of the processed samples of a data block around every onset of stim, spec.Onsets is filled from it.
+	// Empty (and logged) when the block has no processed samples loaded or the stim belongs to another nirs element
+	NIRS::EpochAverage AverageEpochs(const SNIRFStim& stim, NIRS::EpochSpecification spec = {}, size_t block = 0);
 private:
 	std::filesystem::path m_Filepath = std::filesystem::path("");
+	SNIRFLoadSpecification m_LoadSpecification;
+	SNIRFLoadTimings m_LoadTimings;
 
-	Eigen::Matrix<double,
-		Eigen::Dynamic,
-		Eigen::Dynamic,
-		Eigen::RowMajor> m_ChannelData;
+	// Kept open so windows can be read after the load
+	Ref<HighFive::File> m_File = nullptr;
 
-	double m_SamplingRate = 0.0;
-	double m_DurationSeconds = 0.0;
-	std::vector<double> m_Time = {};
+	NIRS::DataWindow m_VisibleWindow;
 
-	std::vector<NIRS::Probe2D> m_Sources2D	 = {};
-	std::vector<NIRS::Probe2D> m_Detectors2D = {};
-	std::vector<NIRS::Probe3D> m_Sources3D	 = {};
-	std::vector<NIRS::Probe3D> m_Detectors3D = {};
 	//std::vector<NIRS::Landmark> m_Landmarks	 = {};
-	std::vector<NIRS::Channel> m_Channels	 = {};
-	std::vector<int> m_Wavelengths			 = {};
+	std::vector<SNIRFProbe> m_Probes		 = {};
+	std::vector<SNIRFDataBlock> m_Blocks	 = {};
+	std::vector<SNIRFStim> m_Stims		 = {};
 
 	ChannelDataRegistry m_ChannelDataRegistry;
 
+	std::mutex m_ProgressMutex;
+
+	const SNIRFProbe& GetPrimaryProbe();
+	const SNIRFDataBlock& GetPrimaryBlock();
+
+	void Reset();
+	bool IsLoadCancelled();
+	void ReportProgress(float progress, const std::string& stage);
+	bool LoadFromProcessedCache();
+	// dataTimeSeries of a block a few chunk rows at a time, visit(first, count, rows) gets every (count x NumChannels)
+	// slab in order. false when the load was cancelled
+	template<typename T, typename F>
+	bool ReadRawRows(size_t block, F&& visit);
+	// Raw samples of a block into the registry, for blocks whose load was served from the processed data cache
+	template<typename T>
+	bool LoadRawSamples(size_t block);
+	void DecodeDataBlocks();
+	template<typename T>
+	void DecodeDataBlocksAs();
+
 };
\ No newline at end of file
@@ -0,0 +1,88 @@
+#pragma once
+#include "Core/Base.h"
+
+#include <mutex>
+#include <vector>
+
+#include "NIRS/FilterDesign.h"
+
+namespace NIRS {
+
+	struct StreamingSpecification {
+		size_t NumChannels = 0;
+		double SamplingRate = 0.0;
+
+		// Causal, so a band-pass here has phase delay unlike the zero phase filter of a full load
+		FilterSpecification Filter = {};
+
+		// Optical density is taken against the mean intensity of the first BaselineSeconds of every channel.
+		// Until that window is full the mean of what arrived so far is used, 0 uses the first sample only
+		double BaselineSeconds = 10.0;
+
+		// Filtered samples kept for readers, 0 keeps one minute
+		size_t HistorySamples = 0;
+	};
+
+	// Seconds spent in Push including the history write, over the last LatencyWindow blocks
+	struct StreamingLatencyStats {
+		size_t Blocks = 0;
+		double Last = 0.0;
+		double Mean = 0.0;
+		double P99 = 0.0;
+		double Max = 0.0;
+	};
+
+	// Online preprocessing for live acquisition : frames go in a few at a time and come out as optical density
+	// passed through the causal filter, with every channel's filter state kept between pushes.
+	// Channels are filtered 16 at a time through InterleavedSOSFilter, a frame of the device is already in that layout.
+	// Push is meant for one acquisition thread, the Read functions can be called from any thread
+	class StreamingProcessor {
+	public:
+		static constexpr size_t LatencyWindow = 1024;
+
+		StreamingProcessor(const StreamingSpecification& spec);
+
+		// frames is sample-major, frames[i * NumChannels + c] is channel c of frame i
+		void Push(const double* frames, size_t numFrames);
+
+		// Filtered frames pushed so far, the ring keeps the last GetHistoryCapacity() of them
+		size_t GetFrameCount() const;
+		size_t GetHistoryCapacity() const { return m_HistoryCapacity; }
+
+		// Copies the newest numFrames frames (sample-major like Push) and returns how many there were
+		size_t ReadLatest(size_t numFrames, std::vector<float>& out) const;
+		// Newest numSamples samples of one channel, oldest first
+		size_t ReadChannel(size_t channel, size_t numSamples, std::vector<float>& out) const;
+
+		StreamingLatencyStats GetLatencyStats() const;
+
+		// Forgets the baseline, the filter state and the history, e.g. when acquisition restarts
+		void Reset();
+
+		const StreamingSpecification& GetSpecification() const { return m_Specification; }
+	private:
+		void UpdateBaseline(const double* frame);
+
+		StreamingSpecification m_Specification;
+		size_t m_NumGroups = 0;
+
+		// Baseline intensity per channel, accumulated until m_BaselineFrames frames were seen
+		std::vector<double> m_BaselineSum = {};
+		std::vector<double> m_Baseline = {};
+		size_t m_BaselineFrames = 0;
+		size_t m_BaselineSeen = 0;
+
+		std::vector<InterleavedSOSFilter> m_Filters = {}; // One per group of Lanes channels
+		std::vector<double> m_Staging = {};                // Group-interleaved rows of the current block
+		std::vector<float> m_Pending = {};                  // Sample-major frames of the current block, copied into the ring
+
+		// Guards the history and the latencies
+		mutable std::mutex m_HistoryMutex;
+		std::vector<float> m_History = {}; // Ring of frames
+		size_t m_HistoryCapacity = 0;
+		size_t m_FrameCount = 0;
+
+		std::vector<double> m_Latencies = {};
+		size_t m_LatencyCount = 0;
+	};
+}
@@ -0,0 +1,48 @@
+#pragma once
+#include "Core/Base.h"
+
+#include <vector>
+
+namespace NIRS {
+
+	// Time axis of a data block. Uniformly sampled data is kept as (start, interval, count) and never
+	// materialized, only irregular axes keep their samples. Times are in seconds
+	class TimeBase {
+	public:
+		TimeBase() = default;
+		TimeBase(double startTime, double interval, size_t count);
+
+		// Keeps the samples only when they are not uniformly spaced (within float noise)
+		static TimeBase FromSamples(const std::vector<double>& time);
+
+		bool IsUniform() const { return m_Samples.empty(); }
+		size_t GetCount() const { return m_Count; }
+
+		double GetStartTime() const { return m_StartTime; }
+		double GetEndTime() const { return m_Count ? GetTime(m_Count - 1) : m_StartTime; } // Time of the last sample
+		double GetDuration() const { return GetEndTime() - m_StartTime; }
+
+		// Average interval for irregular axes
+		double GetInterval() const { return m_Interval; }
+		double GetSamplingRate() const { return m_Interval > 0.0 ? 1.0 / m_Interval : 0.0; }
+
+		// O(1)
+		double GetTime(size_t index) const {
+			return IsUniform() ? m_StartTime + static_cast<double>(index) * m_Interval : m_Samples[index];
+		}
+		double operator[](size_t index) const { return GetTime(index); }
+
+		// Index of the sample nearest to seconds, clamped to [0, count] so it can also be used as a range end.
+		// O(1) when uniform, binary search otherwise
+		size_t TimeToIndex(double seconds) const;
+
+		// Only for callers that really need every timestamp
+		std::vector<double> ToVector() const;
+	private:
+		double m_StartTime = 0.0;
+		double m_Interval = 0.0;
+		size_t m_Count = 0;
+
+		std::vector<double> m_Samples = {};
+	};
+}
@@ -85,6 +85,8 @@ public:
 	static void DrawLines(const VertexArray* vertexArray, uint32_t vertexCount);
 	static void DrawArrays(const VertexArray* vertexArray, uint32_t vertexCount);
 	static void DrawPoints(const VertexArray* vertexArray, uint32_t vertexCount);
+	// instanceCount line strips of vertexCount vertices each in one call, shaders tell them apart by gl_InstanceID
+	static void DrawLineStripsInstanced(const VertexArray* vertexArray, uint32_t vertexCount, uint32_t instanceCount);
 
 	static void OnWindowResize(uint32_t width, uint32_t height);
 	static void SetViewport(uint32_t x, uint32_t y, uint32_t width, uint32_t height);
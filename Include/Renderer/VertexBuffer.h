@@ -13,6 +13,10 @@ public:
 	void Unbind();
 
 	void SetData(const void* data, uint32_t size);
+	// Overwrites [offset, offset + size) in place, no reallocation. The buffer has to be large enough
+	void SetSubData(const void* data, uint32_t size, uint32_t offset = 0);
+	// Exposes the buffer to shaders as the shader storage block at binding, for shaders that index it themselves
+	void BindStorage(uint32_t binding);
 
 	void ClearData();
 
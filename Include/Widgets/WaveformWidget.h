@@ -0,0 +1,82 @@
+#pragma once
+
+#include <QOpenGLWidget>
+
+#include <vector>
+
+#include "Core/Base.h"
+#include "NIRS/NIRS.h"
+
+class SNIRF;
+class Shader;
+class VertexArray;
+class VertexBuffer;
+
+// Stacked time series of a data block, one lane per channel. Every repaint after a scroll or zoom fetches one
+// min / max pair per pixel column of every visible lane from the registry's decimation pyramids, so the cost
+// only depends on the widget size, then streams them into a persistent buffer and draws all lanes with one
+// instanced line strip draw.
+// Mouse : wheel zooms time around the cursor, shift + wheel scrolls channels, ctrl + wheel scales the traces,
+// left drag pans time
+class WaveformWidget : public QOpenGLWidget
+{
+    Q_OBJECT
+
+public:
+    WaveformWidget(QWidget* parent = nullptr);
+    ~WaveformWidget();
+
+    void initializeGL() override;
+    void resizeGL(int w, int h) override;
+    void paintGL() override;
+
+    void wheelEvent(QWheelEvent* event) override;
+    void mousePressEvent(QMouseEvent* event) override;
+    void mouseReleaseEvent(QMouseEvent* event) override;
+    void mouseMoveEvent(QMouseEvent* event) override;
+
+public slots:
+    // Shows the whole block, nullptr clears the view
+    void SetSNIRF(const Ref<SNIRF>& snirf, size_t block = 0);
+    void SetChannelDataView(NIRS::ChannelDataView view);
+
+    // Seconds from the start of the block
+    void SetTimeWindow(double start, double seconds);
+    void SetFirstChannel(size_t channel);
+    void SetChannelsPerPage(size_t count);
+
+signals:
+    void TimeWindowChanged(double start, double seconds);
+
+private:
+    // Fetches the envelopes of the visible lanes and uploads them, only when the view changed
+    void StreamEnvelopes();
+    void Invalidate();
+
+    Ref<SNIRF> m_SNIRF = nullptr;
+    size_t m_Block = 0;
+    std::vector<NIRS::Channel> m_Channels = {};
+    NIRS::ChannelDataView m_View = NIRS::ChannelDataView::Processed;
+    size_t m_NumSamples = 0;
+    double m_SamplingRate = 0.0;
+
+    double m_Start = 0.0;   // seconds
+    double m_Seconds = 0.0;
+    size_t m_FirstChannel = 0;
+    size_t m_ChannelsPerPage = 32;
+    float m_Gain = 1.0f;
+
+    Ref<Shader> m_Shader = nullptr;
+    Ref<VertexArray> m_VAO = nullptr;          // No attributes, the shader reads the envelope buffer itself
+    Ref<VertexBuffer> m_EnvelopeBuffer = nullptr;
+    std::vector<float> m_Staging = {};         // What the envelope buffer holds, lane-major line strips
+
+    bool m_Dirty = true;
+    size_t m_NumColumns = 0;   // Per lane, the widget width in pixels
+    size_t m_NumDrawnColumns = 0;
+    size_t m_NumLanes = 0;
+
+    bool m_Panning = false;
+    double m_PanStart = 0.0;
+    double m_PanX = 0.0;
+};
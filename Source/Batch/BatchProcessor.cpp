@@ -0,0 +1,185 @@
+#include "pch.h"
+#include "Batch/BatchProcessor.h"
+
+#include <fstream>
+#include <algorithm>
+
+#include "Core/Timer.h"
+#include "Core/ThreadPool.h"
+#include "NIRS/ProcessedDataCache.h"
+
+namespace Utils {
+
+	bool is_snirf(const std::filesystem::path& path)
+	{
+		std::string extension = path.extension().string();
+		std::transform(extension.begin(), extension.end(), extension.begin(), ::tolower);
+		return extension == ".snirf";
+	}
+
+	std::string csv_escape(const std::string& value)
+	{
+		if (value.find_first_of(",\"\n") == std::string::npos) {
+			return value;
+		}
+		std::string escaped = "\"";
+		for (char c : value) {
+			if (c == '"') escaped += '"';
+			escaped += c;
+		}
+		return escaped + "\"";
+	}
+}
+
+BatchProcessor::BatchProcessor(const BatchSpecification& spec) : m_Specification(spec)
+{
+}
+
+std::vector<std::filesystem::path> BatchProcessor::CollectFiles(const std::vector<std::filesystem::path>& inputs, bool recursive)
+{
+	std::vector<std::filesystem::path> files;
+	for (const auto& input : inputs) {
+		std::error_code error;
+		if (std::filesystem::is_directory(input, error)) {
+			auto add = [&](const std::filesystem::directory_entry& entry) {
+				if (entry.is_regular_file() && Utils::is_snirf(entry.path())) {
+					files.push_back(entry.path());
+				}
+			};
+			if (recursive) {
+				for (const auto& entry : std::filesystem::recursive_directory_iterator(input, error)) add(entry);
+			}
+			else {
+				for (const auto& entry : std::filesystem::directory_iterator(input, error)) add(entry);
+			}
+		}
+		else if (std::filesystem::is_regular_file(input, error)) {
+			files.push_back(input);
+		}
+		else {
+			NVIZ_WARN("Skipping {}, not a file or directory", input.string());
+		}
+	}
+
+	std::sort(files.begin(), files.end());
+	files.erase(std::unique(files.begin(), files.end()), files.end());
+	return files;
+}
+
+std::vector<BatchFileResult> BatchProcessor::Run()
+{
+	Timer wall_timer;
+	auto files = CollectFiles(m_Specification.Inputs, m_Specification.Recursive);
+	std::vector<BatchFileResult> results(files.size());
+	if (files.empty()) {
+		m_WallSeconds = wall_timer.Elapsed();
+		return results;
+	}
+
+	if (!m_Specification.OutputDirectory.empty()) {
+		std::filesystem::create_directories(m_Specification.OutputDirectory);
+	}
+
+	// Largest files start first so the tail of the run is made of small files, not one straggler
+	std::vector<std::pair<uintmax_t, size_t>> order(files.size());
+	for (size_t i = 0; i < files.size(); i++) {
+		std::error_code error;
+		order[i] = { std::filesystem::file_size(files[i], error), i };
+	}
+	std::sort(order.begin(), order.end(), [](const auto& a, const auto& b) { return a.first > b.first; });
+
+	// The calling thread takes part in ParallelFor, so the pool gets one worker less than requested
+	size_t num_threads = m_Specification.NumThreads ? m_Specification.NumThreads : std::thread::hardware_concurrency();
+	ThreadPool pool(std::max<size_t>(num_threads, 2) - 1);
+	NVIZ_INFO("Processing {} files on {} threads", files.size(), pool.GetThreadCount() + 1);
+
+	pool.ParallelFor(0, order.size(), 1, [&](size_t i) {
+		size_t file_index = order[i].second;
+		results[file_index] = ProcessFile(files[file_index], pool);
+	});
+
+	m_WallSeconds = wall_timer.Elapsed();
+	return results;
+}
+
+BatchFileResult BatchProcessor::ProcessFile(const std::filesystem::path& filepath, ThreadPool& pool)
+{
+	Timer timer;
+	BatchFileResult result;
+	result.Filepath = filepath;
+
+	std::error_code error;
+	result.FileSize = std::filesystem::file_size(filepath, error);
+
+	SNIRFLoadSpecification spec;
+	spec.Preprocessing = m_Specification.Preprocessing;
+	spec.StoragePrecision = m_Specification.Precision;
+	spec.UseProcessedCache = true;
+	spec.CacheDirectory = m_Specification.OutputDirectory;
+	spec.Pool = &pool;
+	// Only the sidecar is written, nothing reads the metrics or draws the pyramids
+	spec.ComputeQuality = false;
+	spec.BuildPyramids = false;
+
+	// The sidecar is the result, LoadFile writes it once the channels are processed
+	auto cache_path = NIRS::ProcessedDataCache::GetCachePath(filepath, m_Specification.OutputDirectory);
+	if (m_Specification.Force) {
+		std::filesystem::remove(cache_path, error);
+	}
+
+	try {
+		SNIRF snirf;
+		const auto& blocks = snirf.GetDataBlocks();
+		if (!snirf.LoadFile(filepath, spec)) {
+			result.Error = "Could not load file";
+		}
+		else if (!std::all_of(blocks.begin(), blocks.end(), [](const SNIRFDataBlock& block) { return block.HasProcessedData(); })) {
+			result.Error = "Not raw intensity data, nothing to preprocess";
+		}
+		else if (!NIRS::ProcessedDataCache::Open(cache_path, filepath, spec.Preprocessing.Hash())) {
+			result.Error = "Could not write " + cache_path.string();
+		}
+		else {
+			result.Success = true;
+			result.Cached = snirf.GetLoadTimings().FromCache;
+			for (const auto& block : snirf.GetDataBlocks()) {
+				result.NumChannels += block.Channels.size();
+				result.NumSamples += block.NumSamples;
+			}
+			result.Timings = snirf.GetLoadTimings();
+		}
+	}
+	catch (const std::exception& e) {
+		result.Error = e.what();
+	}
+
+	result.Seconds = timer.Elapsed();
+	if (result.Success) {
+		NVIZ_INFO("{} : {} channels in {:.1f} ms{}", filepath.string(), result.NumChannels, result.Seconds * 1000.0, result.Cached ? " (cached)" : "");
+	}
+	else {
+		NVIZ_ERROR("{} : {}", filepath.string(), result.Error);
+	}
+	return result;
+}
+
+bool BatchProcessor::WriteTimings(const std::filesystem::path& csvPath, const std::vector<BatchFileResult>& results)
+{
+	std::ofstream file(csvPath);
+	if (!file) {
+		NVIZ_ERROR("Cannot write timings to {}", csvPath.string());
+		return false;
+	}
+
+	file << "file,status,bytes,channels,samples,probe_ms,metadata_ms,signal_ms,preprocessing_ms,load_ms,total_ms,error\n";
+	for (const auto& result : results) {
+		const char* status = !result.Success ? "failed" : result.Cached ? "cached" : "processed";
+		file << Utils::csv_escape(result.Filepath.string()) << ',' << status << ','
+			<< result.FileSize << ',' << result.NumChannels << ',' << result.NumSamples << ','
+			<< result.Timings.Probe * 1000.0 << ',' << result.Timings.Metadata * 1000.0 << ','
+			<< result.Timings.Signal * 1000.0 << ',' << result.Timings.Preprocessing * 1000.0 << ','
+			<< result.Timings.Total * 1000.0 << ',' << result.Seconds * 1000.0 << ','
+			<< Utils::csv_escape(result.Error) << '\n';
+	}
+	return static_cast<bool>(file);
+}
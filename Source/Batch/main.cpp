@@ -0,0 +1,187 @@
+#include "pch.h"
+#include "Core/Log.h"
+#include "Batch/BatchProcessor.h"
+#include "NIRS/SNIRFLibrary.h"
+#include "Core/ThreadPool.h"
+#include "Core/InstructionSet.h"
+
+#include <fstream>
+#include <cstdlib>
+
+// nviz-batch : headless preprocessing of SNIRF recordings, no Qt or GL
+
+namespace Utils {
+
+	void print_usage()
+	{
+		std::cout <<
+			"Usage: nviz-batch [options] <file|directory>...\n"
+			"\n"
+			"Preprocesses every SNIRF file and writes a <file>.nvizcache sidecar per recording,\n"
+			"which NVIZ maps on the next open instead of processing the file again.\n"
+			"\n"
+			"Options:\n"
+			"  -o, --output <dir>     Directory for the sidecars (default: next to each recording)\n"
+			"  -l, --list <file>      Read additional inputs from a text file, one path per line\n"
+			"  -r, --recursive        Search directories recursively\n"
+			"  -j, --threads <n>      Number of threads (default: all hardware threads)\n"
+			"      --low <hz>         Band-pass low cutoff (default: 0.01)\n"
+			"      --high <hz>        Band-pass high cutoff (default: 0.1)\n"
+			"      --order <n>        Butterworth band-pass order (default: 5)\n"
+			"      --baseline <mode>  Optical density baseline : first, mean or median (default: first)\n"
+			"      --baseline-seconds <s>  Window at the start for mean and median, 0 is the whole recording (default: 0)\n"
+			"      --tddr             Correct motion artifacts with TDDR before the band-pass\n"
+			"      --dpf <value>      Differential pathlength factor of the HbO / HbR conversion (default: 6)\n"
+			"      --no-mbll          Keep raw intensity recordings as optical density\n"
+			"      --double           Store float64 samples in the sidecars (default: float32)\n"
+			"  -t, --timings <file>   Per-file timing CSV (default: nviz-batch-timings.csv in the output directory)\n"
+			"  -f, --force            Reprocess files that already have an up to date sidecar\n"
+			"  -s, --scan             Only refresh the library index (.nvizindex) of each directory, no processing\n"
+			"  -v, --verbose          Log everything the loader logs\n"
+			"  -h, --help             Show this message\n";
+	}
+
+	bool read_list(const std::filesystem::path& listPath, std::vector<std::filesystem::path>& inputs)
+	{
+		std::ifstream file(listPath);
+		if (!file) {
+			return false;
+		}
+		std::string line;
+		while (std::getline(file, line)) {
+			if (!line.empty() && line.back() == '\r') line.pop_back();
+			if (line.empty() || line[0] == '#') continue;
+			inputs.emplace_back(line);
+		}
+		return true;
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	Log::Init();
+
+	BatchSpecification spec;
+	std::filesystem::path timings_path = {};
+	bool verbose = false;
+	bool scan = false;
+
+	for (int i = 1; i < argc; i++) {
+		std::string arg = argv[i];
+		auto value = [&]() -> std::string {
+			if (i + 1 >= argc) {
+				std::cerr << "Missing value for " << arg << "\n";
+				std::exit(2);
+			}
+			return argv[++i];
+		};
+
+		if (arg == "-h" || arg == "--help") {
+			Utils::print_usage();
+			return 0;
+		}
+		else if (arg == "-o" || arg == "--output")    spec.OutputDirectory = value();
+		else if (arg == "-r" || arg == "--recursive") spec.Recursive = true;
+		else if (arg == "-j" || arg == "--threads")   spec.NumThreads = std::strtoul(value().c_str(), nullptr, 10);
+		else if (arg == "--low")                      spec.Preprocessing.LowCutoff = std::strtof(value().c_str(), nullptr);
+		else if (arg == "--high")                     spec.Preprocessing.HighCutoff = std::strtof(value().c_str(), nullptr);
+		else if (arg == "--order")                    spec.Preprocessing.FilterOrder = std::atoi(value().c_str());
+		else if (arg == "--baseline") {
+			std::string mode = value();
+			if (mode == "first")       spec.Preprocessing.OpticalDensity.Baseline = NIRS::ODBaseline::FirstSample;
+			else if (mode == "mean")   spec.Preprocessing.OpticalDensity.Baseline = NIRS::ODBaseline::Mean;
+			else if (mode == "median") spec.Preprocessing.OpticalDensity.Baseline = NIRS::ODBaseline::Median;
+			else {
+				std::cerr << "Unknown baseline " << mode << "\n";
+				return 2;
+			}
+		}
+		else if (arg == "--baseline-seconds")         spec.Preprocessing.OpticalDensity.BaselineSeconds = std::strtod(value().c_str(), nullptr);
+		else if (arg == "--tddr")                     spec.Preprocessing.MotionCorrection = true;
+		else if (arg == "--dpf")                      spec.Preprocessing.BeerLambert.DefaultDPF = std::strtod(value().c_str(), nullptr);
+		else if (arg == "--no-mbll")                  spec.Preprocessing.ConvertToConcentration = false;
+		else if (arg == "--double")                   spec.Precision = NIRS::SamplePrecision::Float64;
+		else if (arg == "-t" || arg == "--timings")   timings_path = value();
+		else if (arg == "-f" || arg == "--force")     spec.Force = true;
+		else if (arg == "-v" || arg == "--verbose")   verbose = true;
+		else if (arg == "-s" || arg == "--scan")      scan = true;
+		else if (arg == "-l" || arg == "--list") {
+			std::string list = value();
+			if (!Utils::read_list(list, spec.Inputs)) {
+				std::cerr << "Cannot read list " << list << "\n";
+				return 2;
+			}
+		}
+		else if (!arg.empty() && arg[0] == '-') {
+			std::cerr << "Unknown option " << arg << "\n";
+			Utils::print_usage();
+			return 2;
+		}
+		else {
+			spec.Inputs.emplace_back(arg);
+		}
+	}
+
+	if (spec.Inputs.empty()) {
+		Utils::print_usage();
+		return 2;
+	}
+
+	// Only warnings and errors unless --verbose, the loader logs a lot per file
+	if (!verbose) {
+		Log::GetCoreLogger()->set_level(spdlog::level::warn);
+	}
+	if (!SIMD::CheckInstructionSet()) {
+		return 1;
+	}
+
+	if (scan) {
+		size_t num_threads = spec.NumThreads ? spec.NumThreads : std::thread::hardware_concurrency();
+		ThreadPool pool(std::max<size_t>(num_threads, 2) - 1);
+
+		int status = 0;
+		for (const auto& input : spec.Inputs) {
+			if (!std::filesystem::is_directory(input)) {
+				std::cerr << input.string() << " is not a directory\n";
+				status = 1;
+				continue;
+			}
+
+			SNIRFLibrary library(input);
+			library.LoadIndex();
+			auto stats = library.Scan(spec.Recursive, &pool);
+			if (!library.SaveIndex()) status = 1;
+
+			std::cout << input.string() << " : " << stats.Files << " files (" << stats.Probed << " probed, "
+				<< stats.Reused << " unchanged, " << stats.Removed << " removed, " << stats.Failed << " failed) in "
+				<< stats.Seconds << " s\n";
+		}
+		return status;
+	}
+
+	BatchProcessor processor(spec);
+	auto results = processor.Run();
+
+	if (timings_path.empty()) {
+		timings_path = (spec.OutputDirectory.empty() ? std::filesystem::current_path() : spec.OutputDirectory) / "nviz-batch-timings.csv";
+	}
+	BatchProcessor::WriteTimings(timings_path, results);
+
+	size_t failed = 0, cached = 0;
+	uintmax_t bytes = 0;
+	double busy_seconds = 0.0;
+	for (const auto& result : results) {
+		if (!result.Success) failed++;
+		if (result.Cached) cached++;
+		bytes += result.FileSize;
+		busy_seconds += result.Seconds;
+	}
+
+	double wall = processor.GetWallSeconds();
+	std::cout << results.size() << " files (" << cached << " cached, " << failed << " failed) in " << wall << " s, "
+		<< (wall > 0.0 ? bytes / wall / (1024.0 * 1024.0) : 0.0) << " MB/s, "
+		<< "sum of per-file times " << busy_seconds << " s\n"
+		<< "Timings written to " << timings_path.string() << "\n";
+
+	return failed == 0 ? 0 : 1;
+}
@@ -7,10 +7,15 @@
 #include <QMenuBar>
 #include <QStatusBar>
 #include <QDebug>
+#include <QFileDialog>
 
 #include "Widgets/ViewportWidget.h"
+#include "Widgets/WaveformWidget.h"
 #include "Widgets/CameraSettingsWidget.h"
 
+#include "Events/EventBus.h"
+#include "NIRS/SNIRFLoader.h"
+
 Application* Application::s_Instance = nullptr;
 Application::Application(const ApplicationSpecification& spec) : m_Specification(spec)
 {
@@ -44,6 +49,7 @@ Application::Application(const ApplicationSpecification& spec) : m_Specification
 	CreateMenus();
 	CreateDocks();
 	CreateCentralWidget();
+	SubscribeToEvents();
 }
 
 Application::~Application()
@@ -56,6 +62,17 @@ void Application::CreateMenus()
 
 	// --- File ---
 	QMenu* fileMenu = menuBar()->addMenu(tr("&File"));
+	QAction* openSNIRFAction = fileMenu->addAction(tr("&Open SNIRF..."));
+	connect(openSNIRFAction, &QAction::triggered, this, &Application::OpenSNIRFFile);
+
+	QAction* cancelLoadAction = fileMenu->addAction(tr("&Cancel Loading"));
+	connect(cancelLoadAction, &QAction::triggered, [this]() {
+		if (m_ActiveSNIRFLoad) {
+			SNIRFLoader::Get().Cancel(m_ActiveSNIRFLoad);
+		}
+		});
+
+	fileMenu->addSeparator();
 	QAction* exitAction = fileMenu->addAction(tr("E&xit"));
 
 	// Connect the exit action to the QApplication::quit slot
@@ -70,11 +87,90 @@ void Application::CreateMenus()
 		}
 		});
 
+	QAction* toggleTimeSeriesDockAction = viewMenu->addAction(tr("Time Series"));
+	connect(toggleTimeSeriesDockAction, &QAction::triggered, [this]() {
+		if (m_WaveformWidget) {
+			m_WaveformWidget->parentWidget()->setVisible(!m_WaveformWidget->parentWidget()->isVisible());
+		}
+		});
+
+	viewMenu->addSeparator();
+	m_ProcessedDataAction = viewMenu->addAction(tr("Preprocessed Data"));
+	m_ProcessedDataAction->setCheckable(true);
+	m_ProcessedDataAction->setChecked(m_ChannelDataView == NIRS::ChannelDataView::Processed);
+	connect(m_ProcessedDataAction, &QAction::toggled, [this](bool checked) {
+		m_ChannelDataView = checked ? NIRS::ChannelDataView::Processed : NIRS::ChannelDataView::Raw;
+		if (m_SNIRF) {
+			m_SNIRF->GetChannelDataRegistry().SetView(m_ChannelDataView);
+		}
+		if (m_WaveformWidget) {
+			m_WaveformWidget->SetChannelDataView(m_ChannelDataView);
+		}
+		});
+
 	// --- Help ---
 	QMenu* helpMenu = menuBar()->addMenu(tr("&Help"));
 	helpMenu->addAction(tr("&About"));
 }
 
+void Application::SubscribeToEvents()
+{
+	// Loader events are posted from worker threads and delivered here on the main thread
+	EventBus::Instance().Subscribe<SNIRFFileLoadProgressEvent>([this](const SNIRFFileLoadProgressEvent& event) {
+		if (event.LoadID != m_ActiveSNIRFLoad) return;
+		statusBar()->showMessage(QString("Loading %1 : %2 (%3%)")
+			.arg(QString::fromStdString(std::filesystem::path(event.Filepath).filename().string()))
+			.arg(QString::fromStdString(event.Stage))
+			.arg(static_cast<int>(event.Progress * 100.0f)));
+		});
+
+	EventBus::Instance().Subscribe<SNIRFFileLoadedEvent>([this](const SNIRFFileLoadedEvent& event) {
+		if (event.LoadID != m_ActiveSNIRFLoad) return;
+		m_ActiveSNIRFLoad = 0;
+
+		m_SNIRF = event.File;
+		m_SNIRF->GetChannelDataRegistry().MakeCurrent();
+		m_SNIRF->GetChannelDataRegistry().SetView(m_ChannelDataView);
+		if (m_WaveformWidget) {
+			m_WaveformWidget->SetChannelDataView(m_ChannelDataView);
+			m_WaveformWidget->SetSNIRF(m_SNIRF);
+		}
+		// Processed or concentration data is shown as stored, there is no preprocessed version to switch to
+		m_ProcessedDataAction->setEnabled(m_SNIRF->HasProcessedData());
+
+		statusBar()->showMessage(QString("Loaded %1 in %2 s")
+			.arg(QString::fromStdString(m_SNIRF->GetFilepath()))
+			.arg(event.Seconds, 0, 'f', 2), 5000);
+		});
+
+	EventBus::Instance().Subscribe<SNIRFFileLoadFailedEvent>([this](const SNIRFFileLoadFailedEvent& event) {
+		if (event.LoadID != m_ActiveSNIRFLoad) return;
+		m_ActiveSNIRFLoad = 0;
+
+		if (event.Cancelled) {
+			statusBar()->showMessage("Loading cancelled", 5000);
+			return;
+		}
+		statusBar()->showMessage(QString("Failed to load %1 : %2")
+			.arg(QString::fromStdString(event.Filepath))
+			.arg(QString::fromStdString(event.Error)), 5000);
+		});
+}
+
+void Application::OpenSNIRFFile()
+{
+	QString filepath = QFileDialog::getOpenFileName(this, tr("Open SNIRF"), QString(), tr("SNIRF Files (*.snirf)"));
+	if (filepath.isEmpty()) {
+		return;
+	}
+
+	// Only the newest request is shown, an older one still running is cancelled
+	if (m_ActiveSNIRFLoad) {
+		SNIRFLoader::Get().Cancel(m_ActiveSNIRFLoad);
+	}
+	m_ActiveSNIRFLoad = SNIRFLoader::Get().LoadAsync(filepath.toStdString());
+}
+
 void Application::CreateDocks()
 {
 	// What goes here? 
@@ -94,6 +190,13 @@ void Application::CreateCentralWidget()
 
 	addDockWidget(Qt::RightDockWidgetArea, dockWidget);
 
+	QDockWidget* timeSeriesDock = new QDockWidget(tr("Time Series"), this);
+	m_WaveformWidget = new WaveformWidget(this);
+	timeSeriesDock->setWidget(m_WaveformWidget);
+	timeSeriesDock->setMinimumHeight(240);
+
+	addDockWidget(Qt::BottomDockWidgetArea, timeSeriesDock);
+
 	connect(m_CameraSettingsWidget,
 		&CameraSettingsWidget::OnCameraModeChanged,
 		m_ViewportWidget,
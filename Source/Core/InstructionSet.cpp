@@ -0,0 +1,73 @@
+#include "pch.h"
+#include "Core/InstructionSet.h"
+
+#if defined(_MSC_VER) && (defined(NVIZ_SIMD_BUILD_AVX2) || defined(NVIZ_SIMD_BUILD_AVX512))
+	#include <intrin.h>
+	#include <immintrin.h>
+#endif
+
+// Built without the NVIZ_SIMD flags like everything outside the kernels, so this runs on any x86-64 CPU
+
+namespace Utils {
+
+#if defined(_MSC_VER) && (defined(NVIZ_SIMD_BUILD_AVX2) || defined(NVIZ_SIMD_BUILD_AVX512))
+	// CPUID feature bits, and XGETBV for the OS saving the wide registers, what __builtin_cpu_supports checks elsewhere
+	bool supports_wide_vectors(bool avx512)
+	{
+		int info[4] = {};
+		__cpuid(info, 0);
+		if (info[0] < 7) return false;
+
+		__cpuid(info, 1);
+		bool fma = (info[2] & (1 << 12)) != 0;
+		bool os_saves_registers = (info[2] & (1 << 27)) != 0;
+		if (!fma || !os_saves_registers) return false;
+
+		unsigned long long xcr0 = _xgetbv(0);
+		if ((xcr0 & 0x6) != 0x6) return false; // XMM and YMM state
+
+		__cpuidex(info, 7, 0);
+		bool avx2 = (info[1] & (1 << 5)) != 0;
+		if (!avx512) return avx2;
+
+		bool avx512f = (info[1] & (1 << 16)) != 0;
+		return avx2 && avx512f && (xcr0 & 0xE0) == 0xE0; // Opmask and ZMM state
+	}
+#endif
+}
+
+const char* SIMD::GetBuildInstructionSet()
+{
+#if defined(NVIZ_SIMD_BUILD_AVX512)
+	return "AVX-512";
+#elif defined(NVIZ_SIMD_BUILD_AVX2)
+	return "AVX2";
+#else
+	return "Baseline";
+#endif
+}
+
+bool SIMD::CheckInstructionSet()
+{
+	bool supported = true;
+#if defined(NVIZ_SIMD_BUILD_AVX2) || defined(NVIZ_SIMD_BUILD_AVX512)
+	#if defined(_MSC_VER)
+		#if defined(NVIZ_SIMD_BUILD_AVX512)
+			supported = Utils::supports_wide_vectors(true);
+		#else
+			supported = Utils::supports_wide_vectors(false);
+		#endif
+	#else
+		__builtin_cpu_init();
+		supported = __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+		#if defined(NVIZ_SIMD_BUILD_AVX512)
+			supported = supported && __builtin_cpu_supports("avx512f");
+		#endif
+	#endif
+#endif
+
+	if (!supported) {
+		NVIZ_ERROR("This build of NVIZ needs a CPU with {}, rebuild with NVIZ_SIMD=Baseline to run it here", GetBuildInstructionSet());
+	}
+	return supported;
+}
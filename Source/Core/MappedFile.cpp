@@ -0,0 +1,82 @@
+#include "pch.h"
+#include "Core/MappedFile.h"
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#ifdef _WIN32
+
+MappedFile::MappedFile(const std::filesystem::path& filepath)
+{
+	HANDLE file = CreateFileW(filepath.wstring().c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+		OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+	if (file == INVALID_HANDLE_VALUE) {
+		return;
+	}
+	m_FileHandle = file;
+
+	LARGE_INTEGER size;
+	if (!GetFileSizeEx(file, &size) || size.QuadPart == 0) {
+		return;
+	}
+
+	HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	if (!mapping) {
+		NVIZ_ERROR("Failed to map {}", filepath.string());
+		return;
+	}
+	m_MappingHandle = mapping;
+
+	m_Data = static_cast<const uint8_t*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+	if (m_Data) {
+		m_Size = static_cast<size_t>(size.QuadPart);
+	}
+}
+
+MappedFile::~MappedFile()
+{
+	if (m_Data) UnmapViewOfFile(m_Data);
+	if (m_MappingHandle) CloseHandle(m_MappingHandle);
+	if (m_FileHandle) CloseHandle(m_FileHandle);
+}
+
+#else
+
+MappedFile::MappedFile(const std::filesystem::path& filepath)
+{
+	m_FileDescriptor = open(filepath.c_str(), O_RDONLY);
+	if (m_FileDescriptor < 0) {
+		return;
+	}
+
+	struct stat info;
+	if (fstat(m_FileDescriptor, &info) != 0 || info.st_size == 0) {
+		return;
+	}
+
+	void* data = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_SHARED, m_FileDescriptor, 0);
+	if (data == MAP_FAILED) {
+		NVIZ_ERROR("Failed to map {}", filepath.string());
+		return;
+	}
+	m_Data = static_cast<const uint8_t*>(data);
+	m_Size = static_cast<size_t>(info.st_size);
+}
+
+MappedFile::~MappedFile()
+{
+	if (m_Data) munmap(const_cast<uint8_t*>(m_Data), m_Size);
+	if (m_FileDescriptor >= 0) close(m_FileDescriptor);
+}
+
+#endif
@@ -0,0 +1,113 @@
+#include "pch.h"
+#include "Core/ThreadPool.h"
+
+namespace Utils {
+	// Which pool and deque the current thread works for, so nested submits stay local
+	thread_local ThreadPool* t_CurrentPool = nullptr;
+	thread_local size_t t_CurrentQueue = 0;
+}
+
+ThreadPool::ThreadPool(size_t numThreads)
+{
+	if (numThreads == 0) {
+		size_t hardware = std::thread::hardware_concurrency();
+		numThreads = hardware > 1 ? hardware - 1 : 1;
+	}
+
+	m_Queues.reserve(numThreads);
+	for (size_t i = 0; i < numThreads; i++) {
+		m_Queues.push_back(CreateScope<WorkerQueue>());
+	}
+
+	m_Workers.reserve(numThreads);
+	for (size_t i = 0; i < numThreads; i++) {
+		m_Workers.emplace_back([this, i]() { WorkerLoop(i); });
+	}
+}
+
+ThreadPool::~ThreadPool()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_SleepMutex);
+		m_Stopping = true;
+	}
+	m_Condition.notify_all();
+
+	for (auto& worker : m_Workers) {
+		worker.join();
+	}
+}
+
+ThreadPool& ThreadPool::Get()
+{
+	static ThreadPool instance;
+	return instance;
+}
+
+void ThreadPool::Enqueue(std::function<void()> task)
+{
+	size_t queue = Utils::t_CurrentPool == this
+		? Utils::t_CurrentQueue
+		: m_NextQueue.fetch_add(1, std::memory_order_relaxed) % m_Queues.size();
+	{
+		std::lock_guard<std::mutex> lock(m_Queues[queue]->Mutex);
+		m_Queues[queue]->Tasks.push_back(std::move(task));
+	}
+	{
+		std::lock_guard<std::mutex> lock(m_SleepMutex);
+		m_PendingTasks.fetch_add(1);
+	}
+	m_Condition.notify_one();
+}
+
+bool ThreadPool::TryPop(size_t queue, std::function<void()>& task)
+{
+	auto& worker_queue = *m_Queues[queue];
+	std::lock_guard<std::mutex> lock(worker_queue.Mutex);
+	if (worker_queue.Tasks.empty()) {
+		return false;
+	}
+	task = std::move(worker_queue.Tasks.back());
+	worker_queue.Tasks.pop_back();
+	m_PendingTasks.fetch_sub(1);
+	return true;
+}
+
+bool ThreadPool::TrySteal(size_t thief, std::function<void()>& task)
+{
+	// Oldest task first, those tend to be the biggest (a whole file rather than a few channels of it)
+	for (size_t offset = 1; offset <= m_Queues.size(); offset++) {
+		auto& victim = *m_Queues[(thief + offset) % m_Queues.size()];
+		std::lock_guard<std::mutex> lock(victim.Mutex);
+		if (victim.Tasks.empty()) {
+			continue;
+		}
+		task = std::move(victim.Tasks.front());
+		victim.Tasks.pop_front();
+		m_PendingTasks.fetch_sub(1);
+		return true;
+	}
+	return false;
+}
+
+void ThreadPool::WorkerLoop(size_t index)
+{
+	Utils::t_CurrentPool = this;
+	Utils::t_CurrentQueue = index;
+
+	while (true) {
+		std::function<void()> task;
+		if (TryPop(index, task) || TrySteal(index, task)) {
+			task();
+			continue;
+		}
+
+		std::unique_lock<std::mutex> lock(m_SleepMutex);
+		m_Condition.wait(lock, [this]() { return m_Stopping || m_PendingTasks.load() > 0; });
+
+		// Drain what is queued before stopping so no future is left without a value
+		if (m_Stopping && m_PendingTasks.load() == 0) {
+			return;
+		}
+	}
+}
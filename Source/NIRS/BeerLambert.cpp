@@ -0,0 +1,191 @@
+#include "pch.h"
+#include "NIRS/BeerLambert.h"
+
+#include <map>
+#include <cmath>
+#include <algorithm>
+
+namespace Utils {
+
+	// { nm, HbO, HbR } in cm^-1 / M, S. Prahl, omlc.org/spectra/hemoglobin
+	static constexpr double EXTINCTION_TABLE[][3] = {
+		{ 650, 368.0, 3750.12 }, { 660, 319.6, 3226.56 }, { 670, 294.0, 2795.12 }, { 680, 277.6, 2407.92 },
+		{ 690, 276.0, 2051.96 }, { 700, 290.0, 1794.28 }, { 710, 314.0, 1540.48 }, { 720, 348.0, 1325.88 },
+		{ 730, 390.0, 1102.20 }, { 740, 446.0, 1115.88 }, { 750, 518.0, 1405.24 }, { 760, 586.0, 1548.52 },
+		{ 770, 650.0, 1311.88 }, { 780, 710.0, 1075.44 }, { 790, 770.0, 890.80 },  { 800, 816.0, 761.72 },
+		{ 810, 864.0, 717.08 },  { 820, 916.0, 693.76 },  { 830, 974.0, 693.04 },  { 840, 1022.0, 692.36 },
+		{ 850, 1058.0, 691.32 }, { 860, 1092.0, 694.32 }, { 870, 1128.0, 705.84 }, { 880, 1154.0, 726.44 },
+		{ 890, 1178.0, 743.60 }, { 900, 1198.0, 761.84 }, { 910, 1214.0, 774.56 }, { 920, 1224.0, 777.36 },
+		{ 930, 1222.0, 763.84 }, { 940, 1214.0, 693.44 }, { 950, 1204.0, 602.24 },
+	};
+	static constexpr size_t EXTINCTION_TABLE_SIZE = sizeof(EXTINCTION_TABLE) / sizeof(EXTINCTION_TABLE[0]);
+
+	static constexpr double MOLAR_TO_MICROMOLAR = 1e6;
+
+	// A tile is up to TILE_ROWS (pairs x samples) rows, 2 wavelengths of doubles is 16 KB so the gathered
+	// optical density and the product stay in L1 between the three passes. Channels are read in runs of TILE_SAMPLES
+	static constexpr size_t TILE_ROWS = 1024;
+	static constexpr size_t TILE_SAMPLES = 256;
+}
+
+NIRS::ExtinctionCoefficients NIRS::GetExtinctionCoefficients(double wavelength)
+{
+	const auto& first = Utils::EXTINCTION_TABLE[0];
+	const auto& last = Utils::EXTINCTION_TABLE[Utils::EXTINCTION_TABLE_SIZE - 1];
+	if (wavelength <= first[0]) return { first[1], first[2] };
+	if (wavelength >= last[0]) return { last[1], last[2] };
+
+	size_t i = 1;
+	while (Utils::EXTINCTION_TABLE[i][0] < wavelength) i++;
+	const auto& lo = Utils::EXTINCTION_TABLE[i - 1];
+	const auto& hi = Utils::EXTINCTION_TABLE[i];
+	double t = (wavelength - lo[0]) / (hi[0] - lo[0]);
+	return { lo[1] + t * (hi[1] - lo[1]), lo[2] + t * (hi[2] - lo[2]) };
+}
+
+NIRS::BeerLambertConverter::BeerLambertConverter(const std::vector<Channel>& channels, const std::vector<int>& wavelengths,
+	const std::vector<Probe3D>& sources, const std::vector<Probe3D>& detectors, double centimetersPerUnit,
+	const MBLLSpecification& spec)
+{
+	size_t num_wavelengths = wavelengths.size();
+	if (num_wavelengths < 2) {
+		NVIZ_WARN("Beer-Lambert conversion needs at least two wavelengths, the probe has {}", num_wavelengths);
+		return;
+	}
+
+	// Extinction matrix, one row per wavelength : OD_w / (d * DPF_w) = E_w,HbO * HbO + E_w,HbR * HbR
+	Eigen::MatrixXd extinction(num_wavelengths, 2);
+	for (size_t w = 0; w < num_wavelengths; w++) {
+		if (wavelengths[w] < Utils::EXTINCTION_TABLE[0][0] || wavelengths[w] > Utils::EXTINCTION_TABLE[Utils::EXTINCTION_TABLE_SIZE - 1][0]) {
+			NVIZ_WARN("{} nm is outside the extinction table, using the nearest entry", wavelengths[w]);
+		}
+		auto coefficients = GetExtinctionCoefficients(wavelengths[w]);
+		extinction(w, 0) = coefficients.HbO;
+		extinction(w, 1) = coefficients.HbR;
+	}
+	auto decomposition = extinction.completeOrthogonalDecomposition();
+	if (decomposition.rank() < 2) {
+		NVIZ_ERROR("The extinction matrix of the probe wavelengths is singular, no Beer-Lambert conversion");
+		return;
+	}
+	m_Inverse = decomposition.pseudoInverse().transpose() * Utils::MOLAR_TO_MICROMOLAR;
+
+	// Raw channels carry their wavelength index as the WavelengthType, see MeasurementListToWavelength
+	std::map<std::pair<ProbeID, ProbeID>, MBLLPair> pairs;
+	for (size_t c = 0; c < channels.size(); c++) {
+		const auto& channel = channels[c];
+		size_t w = static_cast<size_t>(channel.Wavelength);
+		if (w >= num_wavelengths) {
+			continue;
+		}
+
+		auto& pair = pairs[{ channel.SourceID, channel.DetectorID }];
+		if (pair.Channels.empty()) {
+			pair.SourceID = channel.SourceID;
+			pair.DetectorID = channel.DetectorID;
+			pair.Channels.assign(num_wavelengths, channels.size());
+		}
+		if (pair.Channels[w] != channels.size()) {
+			NVIZ_WARN("S{}-D{} has more than one channel at {} nm, using the first", channel.SourceID, channel.DetectorID, wavelengths[w]);
+			continue;
+		}
+		pair.Channels[w] = c;
+	}
+
+	size_t incomplete = 0;
+	for (auto& [key, pair] : pairs) {
+		if (std::find(pair.Channels.begin(), pair.Channels.end(), channels.size()) != pair.Channels.end()) {
+			incomplete++;
+			continue;
+		}
+		// Probe IDs are 1-indexed
+		if (pair.SourceID < 1 || pair.SourceID > sources.size() || pair.DetectorID < 1 || pair.DetectorID > detectors.size()) {
+			NVIZ_WARN("S{}-D{} has no probe position, skipping it", pair.SourceID, pair.DetectorID);
+			continue;
+		}
+		const auto& source = sources[pair.SourceID - 1].Position;
+		const auto& detector = detectors[pair.DetectorID - 1].Position;
+		double dx = source.x - detector.x, dy = source.y - detector.y, dz = source.z - detector.z;
+		pair.Distance = std::sqrt(dx * dx + dy * dy + dz * dz) * centimetersPerUnit;
+		if (!(pair.Distance > 0.0)) {
+			NVIZ_WARN("S{}-D{} has no source-detector distance, skipping it", pair.SourceID, pair.DetectorID);
+			continue;
+		}
+
+		for (size_t w = 0; w < num_wavelengths; w++) {
+			size_t c = pair.Channels[w];
+			double dpf = spec.DPF.size() == channels.size() ? spec.DPF[c] : spec.DefaultDPF;
+			m_RowScales.push_back(1.0 / (pair.Distance * dpf));
+		}
+		m_Pairs.push_back(std::move(pair));
+	}
+	if (incomplete > 0) {
+		NVIZ_WARN("{} source-detector pairs miss a wavelength and stay optical density", incomplete);
+	}
+}
+
+template<typename T>
+void NIRS::BeerLambertConverter::Convert(T* const* channels, size_t firstSample, size_t numSamples) const
+{
+	ConvertPairs(channels, nullptr, m_Pairs.size(), firstSample, numSamples);
+}
+
+template<typename T>
+void NIRS::BeerLambertConverter::ConvertPairs(T* const* channels, const size_t* pairs, size_t numPairs, size_t firstSample, size_t numSamples) const
+{
+	if (IsEmpty() || numSamples == 0 || numPairs == 0) {
+		return;
+	}
+
+	// nullptr converts every pair
+	auto pair_index = [pairs](size_t i) { return pairs ? pairs[i] : i; };
+
+	size_t num_wavelengths = static_cast<size_t>(m_Inverse.rows());
+	size_t num_pairs = numPairs;
+	size_t tile_samples = std::min(Utils::TILE_SAMPLES, numSamples);
+	size_t tile_pairs = std::min(std::max<size_t>(Utils::TILE_ROWS / tile_samples, 1), num_pairs);
+
+	// Row j of the tile is one sample of one pair, the k-th pair of the tile owns rows [k * count, (k + 1) * count).
+	// Column-major, so every wavelength and every chromophore is a contiguous run and gather and scatter are plain copies
+	Eigen::MatrixXd od(tile_pairs * tile_samples, num_wavelengths);
+	Eigen::MatrixXd hb(tile_pairs * tile_samples, 2);
+	for (size_t start = firstSample; start < firstSample + numSamples; start += tile_samples)
+	for (size_t first_pair = 0; first_pair < num_pairs; first_pair += tile_pairs) {
+		size_t count = std::min(tile_samples, firstSample + numSamples - start);
+		size_t tile_count = std::min(tile_pairs, num_pairs - first_pair);
+		size_t rows = tile_count * count;
+
+		for (size_t k = 0; k < tile_count; k++) {
+			size_t p = pair_index(first_pair + k);
+			for (size_t w = 0; w < num_wavelengths; w++) {
+				const T* src = channels[m_Pairs[p].Channels[w]] + start;
+				double* dst = od.data() + w * od.rows() + k * count;
+				double scale = m_RowScales[p * num_wavelengths + w];
+				for (size_t i = 0; i < count; i++) dst[i] = scale * static_cast<double>(src[i]);
+			}
+		}
+
+		hb.topRows(rows).noalias() = od.topRows(rows) * m_Inverse;
+
+		for (size_t k = 0; k < tile_count; k++) {
+			const double* hbo = hb.data() + k * count;
+			const double* hbr = hb.data() + hb.rows() + k * count;
+			const auto& pair_rows = m_Pairs[pair_index(first_pair + k)].Channels;
+			T* dst_hbr = channels[pair_rows[0]] + start;
+			T* dst_hbo = channels[pair_rows[1]] + start;
+			for (size_t i = 0; i < count; i++) {
+				dst_hbo[i] = static_cast<T>(hbo[i]);
+				dst_hbr[i] = static_cast<T>(hbr[i]);
+			}
+			for (size_t w = 2; w < pair_rows.size(); w++) {
+				T* dst_hbt = channels[pair_rows[w]] + start;
+				for (size_t i = 0; i < count; i++) dst_hbt[i] = static_cast<T>(hbo[i] + hbr[i]);
+			}
+		}
+	}
+}
+
+template void NIRS::BeerLambertConverter::Convert<float>(float* const*, size_t, size_t) const;
+template void NIRS::BeerLambertConverter::Convert<double>(double* const*, size_t, size_t) const;
+template void NIRS::BeerLambertConverter::ConvertPairs<float>(float* const*, const size_t*, size_t, size_t, size_t) const;
+template void NIRS::BeerLambertConverter::ConvertPairs<double>(double* const*, const size_t*, size_t, size_t, size_t) const;
@@ -0,0 +1,173 @@
+#include "pch.h"
+#include "NIRS/ChannelDataRegistry.h"
+
+#include "Core/ThreadPool.h"
+
+std::atomic<ChannelDataRegistry*> ChannelDataRegistry::s_Instance = nullptr;
+
+int ChannelDataRegistry::SubmitChannelData(const ChannelData& data)
+{
+	return SubmitChannelData(ChannelData(data));
+}
+
+int ChannelDataRegistry::SubmitChannelData(ChannelData&& data)
+{
+	std::size_t hash_val = HashChannelData(data);
+
+	int existing = FindDuplicate(hash_val, data);
+	if (existing >= 0) {
+		return existing;
+	}
+
+	auto storage = CreateRef<ChannelData>(std::move(data));
+
+	int new_index = static_cast<int>(m_Entries.size());
+	m_Entries.push_back({ storage, storage->data(), storage->size(), NIRS::SamplePrecision::Float64 });
+
+	m_LookupMap[hash_val] = new_index;
+
+	return new_index;
+}
+
+template<typename T>
+int ChannelDataRegistry::SubmitChannelBlock(ChannelDataBlockT<T>&& block)
+{
+	// The block is shared by all of its channels, so nothing is copied and nothing is deduplicated
+	auto storage = CreateRef<ChannelDataBlockT<T>>(std::move(block));
+
+	int first_index = static_cast<int>(m_Entries.size());
+	m_Entries.reserve(m_Entries.size() + storage->NumChannels);
+	for (size_t c = 0; c < storage->NumChannels; c++) {
+		m_Entries.push_back({ storage, storage->GetChannel(c), storage->NumSamples, NIRS::PrecisionOf<T>() });
+	}
+	return first_index;
+}
+
+template<typename T>
+int ChannelDataRegistry::SubmitExternalBlock(Ref<const void> owner, const T* data, size_t numChannels, size_t numSamples)
+{
+	int first_index = static_cast<int>(m_Entries.size());
+	m_Entries.reserve(m_Entries.size() + numChannels);
+	for (size_t c = 0; c < numChannels; c++) {
+		m_Entries.push_back({ owner, data + c * numSamples, numSamples, NIRS::PrecisionOf<T>() });
+	}
+	return first_index;
+}
+
+const ChannelDataRegistry::Entry& ChannelDataRegistry::GetEntry(int index) const
+{
+	if (index < 0 || static_cast<size_t>(index) >= m_Entries.size()) {
+		NVIZ_ERROR("Invalid channel data index: {}", index);
+		throw std::out_of_range("Invalid channel data index.");
+	}
+	return m_Entries[index];
+}
+
+bool ChannelDataRegistry::HasChannelData(const NIRS::Channel& channel, NIRS::ChannelDataView view) const
+{
+	NIRS::ChannelDataID index = channel.GetDataIndex(view);
+	return index != NIRS::InvalidChannelDataID && index < m_Entries.size();
+}
+
+NIRS::SamplePrecision ChannelDataRegistry::GetPrecision(int index) const
+{
+	return GetEntry(index).Precision;
+}
+
+template<typename T>
+ChannelSpanT<T> ChannelDataRegistry::GetChannelSpan(int index) const
+{
+	const Entry& entry = GetEntry(index);
+	if (entry.Precision != NIRS::PrecisionOf<T>()) {
+		NVIZ_ERROR("Channel data {} is stored as {} byte samples, requested {}", index, NIRS::GetSampleSize(entry.Precision), sizeof(T));
+		throw std::invalid_argument("Channel data precision mismatch.");
+	}
+	return { static_cast<const T*>(entry.Data), entry.Size };
+}
+
+template<typename T>
+void ChannelDataRegistry::CopyChannelData(int index, std::vector<T>& out) const
+{
+	const Entry& entry = GetEntry(index);
+	if (entry.Precision == NIRS::SamplePrecision::Float32) {
+		const float* data = static_cast<const float*>(entry.Data);
+		out.assign(data, data + entry.Size);
+	}
+	else {
+		const double* data = static_cast<const double*>(entry.Data);
+		out.assign(data, data + entry.Size);
+	}
+}
+
+void ChannelDataRegistry::BuildPyramids(ThreadPool* pool)
+{
+	std::vector<size_t> missing;
+	for (size_t i = 0; i < m_Entries.size(); i++) {
+		if (!m_Entries[i].Pyramid) missing.push_back(i);
+	}
+
+	ThreadPool& pyramid_pool = pool ? *pool : ThreadPool::Get();
+	pyramid_pool.ParallelFor(0, missing.size(), 4, [&](size_t i) {
+		Entry& entry = m_Entries[missing[i]];
+		entry.Pyramid = entry.Precision == NIRS::SamplePrecision::Float32
+			? CreateRef<const NIRS::DecimationPyramid>(static_cast<const float*>(entry.Data), entry.Size)
+			: CreateRef<const NIRS::DecimationPyramid>(static_cast<const double*>(entry.Data), entry.Size);
+	});
+}
+
+bool ChannelDataRegistry::FetchEnvelope(int index, double first, double last, size_t numColumns, NIRS::Envelope& out) const
+{
+	const Entry& entry = GetEntry(index);
+	if (!entry.Pyramid) {
+		out = {};
+		return false;
+	}
+	if (entry.Precision == NIRS::SamplePrecision::Float32) {
+		entry.Pyramid->Fetch(static_cast<const float*>(entry.Data), first, last, numColumns, out);
+	}
+	else {
+		entry.Pyramid->Fetch(static_cast<const double*>(entry.Data), first, last, numColumns, out);
+	}
+	return true;
+}
+
+template int ChannelDataRegistry::SubmitChannelBlock<float>(ChannelDataBlockT<float>&&);
+template int ChannelDataRegistry::SubmitChannelBlock<double>(ChannelDataBlockT<double>&&);
+template int ChannelDataRegistry::SubmitExternalBlock<float>(Ref<const void>, const float*, size_t, size_t);
+template int ChannelDataRegistry::SubmitExternalBlock<double>(Ref<const void>, const double*, size_t, size_t);
+template ChannelSpanT<float> ChannelDataRegistry::GetChannelSpan<float>(int) const;
+template ChannelSpanT<double> ChannelDataRegistry::GetChannelSpan<double>(int) const;
+template void ChannelDataRegistry::CopyChannelData<float>(int, std::vector<float>&) const;
+template void ChannelDataRegistry::CopyChannelData<double>(int, std::vector<double>&) const;
+
+int ChannelDataRegistry::FindDuplicate(std::size_t hash, const ChannelData& data) const
+{
+	auto it = m_LookupMap.find(hash);
+	if (it == m_LookupMap.end()) {
+		return -1;
+	}
+
+	const Entry& entry = m_Entries[it->second];
+	if (entry.Precision == NIRS::SamplePrecision::Float64 && entry.Size == data.size() &&
+		std::equal(data.begin(), data.end(), static_cast<const double*>(entry.Data))) {
+		return it->second;
+	}
+	return -1;
+}
+
+std::size_t ChannelDataRegistry::HashChannelData(const ChannelData& data) const
+{
+	// Simple hash combining the size and a few values.
+	// For a more robust solution, a non-cryptographic polynomial rolling hash
+	// (like FNV-1a or MurmurHash) is usually better.
+	// For demonstration, here's a basic size-and-checksum-based hash:
+
+	std::size_t seed = data.size();
+	for (double d : data) {
+		// Combine hash of the double with the current seed
+		// This is a common pattern for combining hashes in C++
+		std::hash<double> double_hasher;
+		seed ^= double_hasher(d) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+	}
+	return seed;
+}
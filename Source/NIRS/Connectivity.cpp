@@ -0,0 +1,255 @@
+#include "pch.h"
+#include "NIRS/Connectivity.h"
+
+#include <cmath>
+#include <limits>
+#include <algorithm>
+
+#include "Core/ThreadPool.h"
+
+namespace Utils {
+
+	using RowMatrix = Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+
+	// Output tiles of the products are TILE_CHANNELS square, a run of RUN_SAMPLES normalized samples of 1000 channels is 16 MB
+	static constexpr size_t TILE_CHANNELS = 128;
+	static constexpr size_t RUN_SAMPLES = 2048;
+
+	template<typename T>
+	void channel_statistics(const T* const* channels, size_t numChannels, size_t numSamples,
+		std::vector<double>& means, std::vector<double>& inverseDeviations, ThreadPool& pool)
+	{
+		means.assign(numChannels, 0.0);
+		inverseDeviations.assign(numChannels, 0.0);
+		if (numSamples == 0) {
+			return;
+		}
+		pool.ParallelFor(0, numChannels, 16, [&](size_t c) {
+			const T* x = channels[c];
+			double sum = 0.0;
+			for (size_t i = 0; i < numSamples; i++) sum += static_cast<double>(x[i]);
+			double mean = sum / static_cast<double>(numSamples);
+			double squares = 0.0;
+			for (size_t i = 0; i < numSamples; i++) {
+				double d = static_cast<double>(x[i]) - mean;
+				squares += d * d;
+			}
+			means[c] = mean;
+			inverseDeviations[c] = squares > 0.0 ? 1.0 / std::sqrt(squares / static_cast<double>(numSamples)) : 0.0;
+		});
+	}
+
+	// Columns [column, column + count) of row c of z are channel c over [first, first + count), z-normalized
+	template<typename T>
+	void normalize_run(const T* const* channels, size_t numChannels, size_t first, size_t count, const std::vector<double>& means,
+		const std::vector<double>& inverseDeviations, RowMatrix& z, Eigen::Index column)
+	{
+		for (size_t c = 0; c < numChannels; c++) {
+			const T* x = channels[c] + first;
+			double* row = z.row(c).data() + column;
+			double mean = means[c];
+			double scale = inverseDeviations[c];
+			for (size_t i = 0; i < count; i++) row[i] = (static_cast<double>(x[i]) - mean) * scale;
+		}
+	}
+
+	// Lower triangle of products += a * b', one task per output tile
+	void rank_update(Eigen::MatrixXd& products, const RowMatrix& a, const RowMatrix& b, ThreadPool& pool)
+	{
+		size_t n = static_cast<size_t>(products.rows());
+		size_t num_tiles = (n + TILE_CHANNELS - 1) / TILE_CHANNELS;
+		std::vector<std::pair<size_t, size_t>> tiles;
+		for (size_t i = 0; i < num_tiles; i++) {
+			for (size_t j = 0; j <= i; j++) tiles.push_back({ i, j });
+		}
+		pool.ParallelFor(0, tiles.size(), 1, [&](size_t t) {
+			auto [i, j] = tiles[t];
+			Eigen::Index i0 = i * TILE_CHANNELS, j0 = j * TILE_CHANNELS;
+			Eigen::Index rows = std::min(TILE_CHANNELS, n - i0), cols = std::min(TILE_CHANNELS, n - j0);
+			products.block(i0, j0, rows, cols).noalias() += a.middleRows(i0, rows) * b.middleRows(j0, cols).transpose();
+		});
+	}
+
+	// Pearson correlation from the lower triangle of sum z z' and sum z over count samples
+	void finish_correlation(const Eigen::MatrixXd& products, const Eigen::VectorXd& sums, size_t count, Eigen::MatrixXd& correlation)
+	{
+		Eigen::Index n = products.rows();
+		double inv_count = count > 0 ? 1.0 / static_cast<double>(count) : 0.0;
+		Eigen::VectorXd deviations(n);
+		for (Eigen::Index i = 0; i < n; i++) {
+			double variance = products(i, i) - sums(i) * sums(i) * inv_count;
+			deviations(i) = variance > 0.0 ? std::sqrt(variance) : std::numeric_limits<double>::quiet_NaN();
+		}
+		correlation.resize(n, n);
+		for (Eigen::Index j = 0; j < n; j++) {
+			for (Eigen::Index i = j; i < n; i++) {
+				double covariance = products(i, j) - sums(i) * sums(j) * inv_count;
+				double r = covariance / (deviations(i) * deviations(j));
+				correlation(i, j) = r;
+				correlation(j, i) = r;
+			}
+		}
+	}
+
+	// Sums over [first, first + count), run by run
+	template<typename T>
+	void accumulate(const T* const* channels, size_t numChannels, size_t first, size_t count, const std::vector<double>& means,
+		const std::vector<double>& inverseDeviations, Eigen::MatrixXd& products, Eigen::VectorXd& sums, ThreadPool& pool)
+	{
+		RowMatrix z(numChannels, std::min(RUN_SAMPLES, count));
+		for (size_t start = first; start < first + count; start += RUN_SAMPLES) {
+			size_t run = std::min(RUN_SAMPLES, first + count - start);
+			if (static_cast<size_t>(z.cols()) != run) z.resize(numChannels, run);
+			normalize_run(channels, numChannels, start, run, means, inverseDeviations, z, 0);
+			rank_update(products, z, z, pool);
+			sums += z.rowwise().sum();
+		}
+	}
+}
+
+template<typename T>
+Eigen::MatrixXd NIRS::ComputeCorrelation(const T* const* channels, size_t numChannels, size_t numSamples, ThreadPool* pool)
+{
+	ThreadPool& correlation_pool = pool ? *pool : ThreadPool::Get();
+	std::vector<double> means, inverse_deviations;
+	Utils::channel_statistics(channels, numChannels, numSamples, means, inverse_deviations, correlation_pool);
+
+	Eigen::MatrixXd products = Eigen::MatrixXd::Zero(numChannels, numChannels);
+	Eigen::VectorXd sums = Eigen::VectorXd::Zero(numChannels);
+	Utils::accumulate(channels, numChannels, 0, numSamples, means, inverse_deviations, products, sums, correlation_pool);
+
+	Eigen::MatrixXd correlation;
+	Utils::finish_correlation(products, sums, numSamples, correlation);
+	return correlation;
+}
+
+Eigen::MatrixXd NIRS::ComputeCorrelation(const ChannelDataRegistry& registry, const std::vector<Channel>& channels, ChannelDataView view, ThreadPool* pool)
+{
+	if (channels.empty()) {
+		return {};
+	}
+
+	// Rows are used in place when they share a precision, mixed blocks are copied to double first
+	auto precision = registry.GetPrecision(static_cast<int>(channels.front().GetDataIndex(view)));
+	bool uniform = std::all_of(channels.begin(), channels.end(), [&](const Channel& channel) {
+		return registry.GetPrecision(static_cast<int>(channel.GetDataIndex(view))) == precision;
+	});
+
+	size_t num_samples = std::numeric_limits<size_t>::max();
+	auto gather = [&](auto tag) {
+		using T = decltype(tag);
+		std::vector<const T*> rows(channels.size());
+		for (size_t c = 0; c < channels.size(); c++) {
+			auto span = registry.GetChannelSpan<T>(channels[c], view);
+			rows[c] = span.Data;
+			num_samples = std::min(num_samples, span.Size);
+		}
+		return rows;
+	};
+
+	if (uniform && precision == SamplePrecision::Float32) {
+		auto rows = gather(float());
+		return ComputeCorrelation(rows.data(), rows.size(), num_samples, pool);
+	}
+	if (uniform) {
+		auto rows = gather(double());
+		return ComputeCorrelation(rows.data(), rows.size(), num_samples, pool);
+	}
+
+	std::vector<std::vector<double>> copies(channels.size());
+	std::vector<const double*> rows(channels.size());
+	for (size_t c = 0; c < channels.size(); c++) {
+		registry.CopyChannelData(channels[c], view, copies[c]);
+		rows[c] = copies[c].data();
+		num_samples = std::min(num_samples, copies[c].size());
+	}
+	return ComputeCorrelation(rows.data(), rows.size(), num_samples, pool);
+}
+
+template<typename T>
+NIRS::SlidingCorrelation<T>::SlidingCorrelation(const T* const* channels, size_t numChannels, size_t numSamples,
+	size_t windowSamples, size_t stepSamples, ThreadPool* pool)
+	: m_Channels(channels, channels + numChannels), m_NumSamples(numSamples), m_WindowSamples(windowSamples),
+	m_Step(std::max<size_t>(stepSamples, 1)), m_Pool(pool)
+{
+	if (windowSamples < 2 || windowSamples > numSamples) {
+		NVIZ_ERROR("Correlation window of {} samples does not fit a recording of {}", windowSamples, numSamples);
+		return;
+	}
+	m_NumWindows = (numSamples - windowSamples) / m_Step + 1;
+
+	ThreadPool& correlation_pool = m_Pool ? *m_Pool : ThreadPool::Get();
+	Utils::channel_statistics(m_Channels.data(), numChannels, numSamples, m_Means, m_InverseDeviations, correlation_pool);
+	Recompute();
+}
+
+template<typename T>
+void NIRS::SlidingCorrelation<T>::Recompute()
+{
+	ThreadPool& correlation_pool = m_Pool ? *m_Pool : ThreadPool::Get();
+	size_t num_channels = m_Channels.size();
+	m_Products = Eigen::MatrixXd::Zero(num_channels, num_channels);
+	m_Sums = Eigen::VectorXd::Zero(num_channels);
+	Utils::accumulate(m_Channels.data(), num_channels, GetFirstSample(m_Window), m_WindowSamples, m_Means, m_InverseDeviations,
+		m_Products, m_Sums, correlation_pool);
+	m_StepsSinceRefresh = 0;
+	Finish();
+}
+
+template<typename T>
+void NIRS::SlidingCorrelation<T>::Finish()
+{
+	Utils::finish_correlation(m_Products, m_Sums, m_WindowSamples, m_Correlation);
+}
+
+template<typename T>
+const Eigen::MatrixXd& NIRS::SlidingCorrelation<T>::Seek(size_t window)
+{
+	if (m_NumWindows == 0 || window >= m_NumWindows || window == m_Window) {
+		return m_Correlation;
+	}
+	if (window == m_Window + 1) {
+		Next();
+	}
+	else {
+		m_Window = window;
+		Recompute();
+	}
+	return m_Correlation;
+}
+
+template<typename T>
+bool NIRS::SlidingCorrelation<T>::Next()
+{
+	if (m_Window + 1 >= m_NumWindows) {
+		return false;
+	}
+
+	size_t leaving = GetFirstSample(m_Window);
+	m_Window++;
+	if (m_Step >= m_WindowSamples / 2 || ++m_StepsSinceRefresh >= RefreshSteps) {
+		Recompute(); // Nothing to gain over a fresh window, or time to shed the rounding of the updates
+		return true;
+	}
+
+	// [in | out] * [in | -out]' adds the entering and removes the leaving outer products in one product
+	size_t entering = leaving + m_WindowSamples;
+	size_t num_channels = m_Channels.size();
+	Utils::RowMatrix a(num_channels, 2 * m_Step);
+	Utils::RowMatrix b(num_channels, 2 * m_Step);
+	Utils::normalize_run(m_Channels.data(), num_channels, entering, m_Step, m_Means, m_InverseDeviations, a, 0);
+	Utils::normalize_run(m_Channels.data(), num_channels, leaving, m_Step, m_Means, m_InverseDeviations, a, m_Step);
+	b.leftCols(m_Step) = a.leftCols(m_Step);
+	b.rightCols(m_Step) = -a.rightCols(m_Step);
+
+	ThreadPool& correlation_pool = m_Pool ? *m_Pool : ThreadPool::Get();
+	Utils::rank_update(m_Products, a, b, correlation_pool);
+	m_Sums += b.rowwise().sum();
+	Finish();
+	return true;
+}
+
+template Eigen::MatrixXd NIRS::ComputeCorrelation<float>(const float* const*, size_t, size_t, ThreadPool*);
+template Eigen::MatrixXd NIRS::ComputeCorrelation<double>(const double* const*, size_t, size_t, ThreadPool*);
+template class NIRS::SlidingCorrelation<float>;
+template class NIRS::SlidingCorrelation<double>;
@@ -0,0 +1,155 @@
+#include "pch.h"
+#include "NIRS/DecimationPyramid.h"
+
+#include <cmath>
+#include <limits>
+#include <algorithm>
+
+namespace Utils {
+
+	static constexpr float NaN = std::numeric_limits<float>::quiet_NaN();
+
+	// Nearest bucket edge to position (in buckets of a level), clamped to the level
+	inline size_t snap(double position, size_t numBuckets)
+	{
+		if (!(position > 0.0)) return 0;
+		return std::min(static_cast<size_t>(std::floor(position + 0.5)), numBuckets);
+	}
+}
+
+template<typename T>
+NIRS::DecimationPyramid::DecimationPyramid(const T* samples, size_t numSamples)
+	: m_NumSamples(numSamples)
+{
+	if (numSamples == 0) {
+		return;
+	}
+
+	// Base level straight from the samples
+	Level base;
+	base.BucketSamples = BaseBucketSamples;
+	size_t num_buckets = (numSamples + BaseBucketSamples - 1) / BaseBucketSamples;
+	base.Min.resize(num_buckets);
+	base.Max.resize(num_buckets);
+	base.Mean.resize(num_buckets);
+	for (size_t b = 0; b < num_buckets; b++) {
+		size_t first = b * BaseBucketSamples;
+		size_t count = std::min(BaseBucketSamples, numSamples - first);
+		float lo = static_cast<float>(samples[first]), hi = lo;
+		double sum = 0.0;
+		for (size_t i = first; i < first + count; i++) {
+			float x = static_cast<float>(samples[i]);
+			lo = std::min(lo, x);
+			hi = std::max(hi, x);
+			sum += static_cast<double>(samples[i]);
+		}
+		base.Min[b] = lo;
+		base.Max[b] = hi;
+		base.Mean[b] = static_cast<float>(sum / static_cast<double>(count));
+	}
+	m_Levels.push_back(std::move(base));
+
+	// Every level above folds LevelFactor buckets of the one below, the last bucket of a level may be partial
+	while (m_Levels.back().Min.size() > 1) {
+		const Level& below = m_Levels.back();
+		Level level;
+		level.BucketSamples = below.BucketSamples * LevelFactor;
+		size_t num_below = below.Min.size();
+		num_buckets = (num_below + LevelFactor - 1) / LevelFactor;
+		level.Min.resize(num_buckets);
+		level.Max.resize(num_buckets);
+		level.Mean.resize(num_buckets);
+		for (size_t b = 0; b < num_buckets; b++) {
+			size_t first = b * LevelFactor;
+			size_t last = std::min(first + LevelFactor, num_below);
+			float lo = below.Min[first], hi = below.Max[first];
+			double sum = 0.0;
+			size_t count = 0;
+			for (size_t j = first; j < last; j++) {
+				size_t child = std::min(below.BucketSamples, numSamples - j * below.BucketSamples);
+				lo = std::min(lo, below.Min[j]);
+				hi = std::max(hi, below.Max[j]);
+				sum += static_cast<double>(below.Mean[j]) * static_cast<double>(child);
+				count += child;
+			}
+			level.Min[b] = lo;
+			level.Max[b] = hi;
+			level.Mean[b] = static_cast<float>(sum / static_cast<double>(count));
+		}
+		m_Levels.push_back(std::move(level));
+	}
+}
+
+template<typename T>
+void NIRS::DecimationPyramid::Fetch(const T* samples, double first, double last, size_t numColumns, Envelope& out) const
+{
+	out.Min.assign(numColumns, Utils::NaN);
+	out.Max.assign(numColumns, Utils::NaN);
+	out.Mean.assign(numColumns, Utils::NaN);
+	if (numColumns == 0 || m_NumSamples == 0 || !(last > first)) {
+		return;
+	}
+
+	double width = (last - first) / static_cast<double>(numColumns); // Samples per column
+	if (width < static_cast<double>(BaseBucketSamples)) {
+		// Zoomed in past the base level, every column reads at most a base bucket of samples
+		for (size_t c = 0; c < numColumns; c++) {
+			double a = first + width * static_cast<double>(c);
+			if (a + width <= 0.0) {
+				continue;
+			}
+			size_t begin = static_cast<size_t>(std::max(std::floor(a), 0.0));
+			size_t end = static_cast<size_t>(std::max(std::floor(a + width), 0.0));
+			end = std::min(std::max(end, begin + 1), m_NumSamples);
+			if (begin >= end) {
+				continue;
+			}
+			float lo = static_cast<float>(samples[begin]), hi = lo;
+			double sum = 0.0;
+			for (size_t i = begin; i < end; i++) {
+				float x = static_cast<float>(samples[i]);
+				lo = std::min(lo, x);
+				hi = std::max(hi, x);
+				sum += static_cast<double>(samples[i]);
+			}
+			out.Min[c] = lo;
+			out.Max[c] = hi;
+			out.Mean[c] = static_cast<float>(sum / static_cast<double>(end - begin));
+		}
+		return;
+	}
+
+	// Coarsest level with at most one column of samples per bucket
+	size_t l = 0;
+	while (l + 1 < m_Levels.size() && static_cast<double>(m_Levels[l + 1].BucketSamples) <= width) l++;
+	const Level& level = m_Levels[l];
+	double scale = 1.0 / static_cast<double>(level.BucketSamples);
+	size_t num_buckets = level.Min.size();
+
+	size_t begin = Utils::snap(first * scale, num_buckets);
+	for (size_t c = 0; c < numColumns; c++) {
+		size_t end = Utils::snap((first + width * static_cast<double>(c + 1)) * scale, num_buckets);
+		if (begin >= end) {
+			continue; // Past either end of the channel
+		}
+		float lo = level.Min[begin], hi = level.Max[begin];
+		double sum = 0.0;
+		size_t count = 0;
+		for (size_t b = begin; b < end; b++) {
+			size_t bucket = std::min(level.BucketSamples, m_NumSamples - b * level.BucketSamples);
+			lo = std::min(lo, level.Min[b]);
+			hi = std::max(hi, level.Max[b]);
+			sum += static_cast<double>(level.Mean[b]) * static_cast<double>(bucket);
+			count += bucket;
+		}
+		out.Min[c] = lo;
+		out.Max[c] = hi;
+		out.Mean[c] = static_cast<float>(sum / static_cast<double>(count));
+		begin = end;
+	}
+}
+
+template NIRS::DecimationPyramid::DecimationPyramid(const float*, size_t);
+template NIRS::DecimationPyramid::DecimationPyramid(const double*, size_t);
+template void NIRS::DecimationPyramid::Fetch<float>(const float*, double, double, size_t, Envelope&) const;
+template void NIRS::DecimationPyramid::Fetch<double>(const double*, double, double, size_t, Envelope&) const;
@@ -0,0 +1,147 @@
+#include "pch.h"
+#include "NIRS/Epochs.h"
+
+#include <cmath>
+#include <limits>
+#include <algorithm>
+
+#include "Core/SIMD.h"
+#include "Core/ThreadPool.h"
+
+namespace Utils {
+
+	// Channels per task of the pool
+	static constexpr size_t EPOCH_GRAIN = 16;
+
+	// One Welford step for every lag of an epoch : v = x - baseline, mean += (v - mean) / k, m2 += (v - mean_old) * (v - mean_new)
+	template<typename T>
+	void welford_update(const T* epoch, double baseline, double invCount, double* mean, double* m2, size_t length)
+	{
+		using SIMD::DoubleVec;
+		constexpr size_t WIDTH = DoubleVec::Width;
+		const DoubleVec vbaseline = DoubleVec::Broadcast(baseline);
+		const DoubleVec vinv = DoubleVec::Broadcast(invCount);
+		size_t i = 0;
+		for (; i + WIDTH <= length; i += WIDTH) {
+			DoubleVec v = DoubleVec::Load(epoch + i) - vbaseline;
+			DoubleVec m = DoubleVec::Load(mean + i);
+			DoubleVec delta = v - m;
+			m = MulAdd(delta, vinv, m);
+			MulAdd(delta, v - m, DoubleVec::Load(m2 + i)).Store(m2 + i);
+			m.Store(mean + i);
+		}
+		for (; i < length; i++) {
+			double v = static_cast<double>(epoch[i]) - baseline;
+			double delta = v - mean[i];
+			mean[i] += delta * invCount;
+			m2[i] += delta * (v - mean[i]);
+		}
+	}
+}
+
+std::vector<double> NIRS::GetOnsets(const StimCondition& condition, double startTime)
+{
+	std::vector<double> onsets;
+	onsets.reserve(condition.Events.size());
+	for (const auto& event : condition.Events) onsets.push_back(event.Onset - startTime);
+	return onsets;
+}
+
+NIRS::EpochAverager::EpochAverager(const EpochSpecification& spec, size_t numSamples, double samplingRate)
+{
+	if (!(spec.End > spec.Start) || !(samplingRate > 0.0)) {
+		NVIZ_ERROR("Epoch window [{}, {}) s at {} Hz is empty", spec.Start, spec.End, samplingRate);
+		return;
+	}
+
+	m_Offset = static_cast<int64_t>(std::round(spec.Start * samplingRate));
+	m_Length = static_cast<size_t>(std::max<int64_t>(static_cast<int64_t>(std::round(spec.End * samplingRate)) - m_Offset, 1));
+	if (spec.BaselineCorrection) {
+		m_BaselineSamples = static_cast<size_t>(std::clamp<int64_t>(-m_Offset, 0, static_cast<int64_t>(m_Length)));
+	}
+
+	size_t skipped = 0;
+	for (double onset : spec.Onsets) {
+		int64_t first = static_cast<int64_t>(std::round(onset * samplingRate)) + m_Offset;
+		if (first < 0 || static_cast<size_t>(first) + m_Length > numSamples) {
+			skipped++;
+			continue;
+		}
+		m_Windows.push_back(static_cast<size_t>(first));
+	}
+	// Onset order is memory order, the pass over a channel then only moves forward
+	std::sort(m_Windows.begin(), m_Windows.end());
+
+	if (skipped > 0) {
+		NVIZ_WARN("{} of {} epochs do not fit the recording and are skipped", skipped, spec.Onsets.size());
+	}
+}
+
+void NIRS::EpochAverager::Allocate(EpochAverage& average, size_t numChannels) const
+{
+	constexpr double NaN = std::numeric_limits<double>::quiet_NaN();
+	average.Mean.NumChannels = numChannels;
+	average.Mean.NumSamples = m_Length;
+	average.Mean.Samples.assign(numChannels * m_Length, NaN);
+	average.StandardError = average.Mean;
+	average.NumEpochs = m_Windows.size();
+	average.Offset = m_Offset;
+}
+
+template<typename T>
+NIRS::EpochAverage NIRS::EpochAverager::Average(const T* const* channels, size_t numChannels, ThreadPool* pool) const
+{
+	EpochAverage average;
+	Allocate(average, numChannels);
+	if (IsEmpty()) {
+		return average;
+	}
+
+	std::vector<size_t> rows(numChannels);
+	for (size_t c = 0; c < numChannels; c++) rows[c] = c;
+
+	ThreadPool& average_pool = pool ? *pool : ThreadPool::Get();
+	size_t num_tasks = (numChannels + Utils::EPOCH_GRAIN - 1) / Utils::EPOCH_GRAIN;
+	average_pool.ParallelFor(0, num_tasks, 1, [&](size_t t) {
+		size_t first = t * Utils::EPOCH_GRAIN;
+		AverageInto(channels + first, rows.data() + first, std::min(Utils::EPOCH_GRAIN, numChannels - first), average);
+	});
+	return average;
+}
+
+template<typename T>
+void NIRS::EpochAverager::AverageInto(const T* const* channels, const size_t* rows, size_t numChannels, EpochAverage& average) const
+{
+	if (IsEmpty()) {
+		return;
+	}
+
+	for (size_t c = 0; c < numChannels; c++) {
+		const T* signal = channels[c];
+		double* mean = average.Mean.GetChannel(rows[c]);
+		double* m2 = average.StandardError.GetChannel(rows[c]); // Sum of squares until the end
+		std::fill(mean, mean + m_Length, 0.0);
+		std::fill(m2, m2 + m_Length, 0.0);
+
+		size_t count = 0;
+		for (size_t first : m_Windows) {
+			const T* epoch = signal + first;
+			double baseline = 0.0;
+			if (m_BaselineSamples > 0) {
+				for (size_t i = 0; i < m_BaselineSamples; i++) baseline += static_cast<double>(epoch[i]);
+				baseline /= static_cast<double>(m_BaselineSamples);
+			}
+			count++;
+			Utils::welford_update(epoch, baseline, 1.0 / static_cast<double>(count), mean, m2, m_Length);
+		}
+
+		// SEM = sqrt(m2 / (n - 1)) / sqrt(n), undefined for a single epoch
+		double scale = count > 1 ? 1.0 / (static_cast<double>(count) * static_cast<double>(count - 1)) : std::numeric_limits<double>::quiet_NaN();
+		for (size_t i = 0; i < m_Length; i++) m2[i] = std::sqrt(m2[i] * scale);
+	}
+}
+
+template NIRS::EpochAverage NIRS::EpochAverager::Average<float>(const float* const*, size_t, ThreadPool*) const;
+template NIRS::EpochAverage NIRS::EpochAverager::Average<double>(const double* const*, size_t, ThreadPool*) const;
+template void NIRS::EpochAverager::AverageInto<float>(const float* const*, const size_t*, size_t, EpochAverage&) const;
+template void NIRS::EpochAverager::AverageInto<double>(const double* const*, const size_t*, size_t, EpochAverage&) const;
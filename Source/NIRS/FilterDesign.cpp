@@ -0,0 +1,480 @@
+#include "pch.h"
+#include "NIRS/FilterDesign.h"
+
+#include <complex>
+#include <cmath>
+#include <algorithm>
+
+#include "Core/SIMD.h"
+
+namespace Utils {
+
+	using Complex = std::complex<double>;
+
+	static constexpr double PI = 3.14159265358979323846;
+	static constexpr double REAL_TOLERANCE = 1e-10;
+
+	// Zeros, poles and gain of a filter, analog or digital
+	struct ZPK {
+		std::vector<Complex> Zeros = {};
+		std::vector<Complex> Poles = {};
+		double Gain = 1.0;
+	};
+
+	Complex product(const std::vector<Complex>& values, Complex offset, double sign)
+	{
+		Complex result = 1.0;
+		for (const auto& value : values) result *= offset + sign * value;
+		return result;
+	}
+
+	// Normalized (1 rad/s) analog prototypes
+	ZPK butterworth_prototype(int order)
+	{
+		ZPK zpk;
+		for (int k = 0; k < order; k++) {
+			double theta = PI * (2.0 * k + order + 1) / (2.0 * order);
+			zpk.Poles.push_back(std::polar(1.0, theta));
+		}
+		return zpk;
+	}
+
+	ZPK chebyshev1_prototype(int order, double rippleDb)
+	{
+		ZPK zpk;
+		double epsilon = std::sqrt(std::pow(10.0, rippleDb / 10.0) - 1.0);
+		double mu = std::asinh(1.0 / epsilon) / order;
+		for (int k = 0; k < order; k++) {
+			double theta = PI * (2.0 * k + 1) / (2.0 * order);
+			zpk.Poles.emplace_back(-std::sinh(mu) * std::sin(theta), std::cosh(mu) * std::cos(theta));
+		}
+		zpk.Gain = product(zpk.Poles, 0.0, -1.0).real();
+		if (order % 2 == 0) {
+			zpk.Gain /= std::sqrt(1.0 + epsilon * epsilon);
+		}
+		return zpk;
+	}
+
+	// --- Analog frequency transforms, same as scipy's lp2lp_zpk / lp2hp_zpk / lp2bp_zpk ---
+	ZPK lowpass_to_lowpass(const ZPK& prototype, double wo)
+	{
+		ZPK zpk = prototype;
+		for (auto& zero : zpk.Zeros) zero *= wo;
+		for (auto& pole : zpk.Poles) pole *= wo;
+		zpk.Gain *= std::pow(wo, static_cast<double>(prototype.Poles.size() - prototype.Zeros.size()));
+		return zpk;
+	}
+
+	ZPK lowpass_to_highpass(const ZPK& prototype, double wo)
+	{
+		ZPK zpk;
+		for (const auto& zero : prototype.Zeros) zpk.Zeros.push_back(wo / zero);
+		for (const auto& pole : prototype.Poles) zpk.Poles.push_back(wo / pole);
+		zpk.Zeros.resize(zpk.Poles.size(), 0.0);
+		zpk.Gain = prototype.Gain * (product(prototype.Zeros, 0.0, -1.0) / product(prototype.Poles, 0.0, -1.0)).real();
+		return zpk;
+	}
+
+	ZPK lowpass_to_bandpass(const ZPK& prototype, double wo, double bandwidth)
+	{
+		ZPK zpk;
+		auto split = [&](const std::vector<Complex>& roots, std::vector<Complex>& out) {
+			for (const auto& root : roots) {
+				Complex scaled = root * bandwidth / 2.0;
+				Complex offset = std::sqrt(scaled * scaled - wo * wo);
+				out.push_back(scaled + offset);
+				out.push_back(scaled - offset);
+			}
+		};
+		split(prototype.Zeros, zpk.Zeros);
+		split(prototype.Poles, zpk.Poles);
+
+		size_t degree = prototype.Poles.size() - prototype.Zeros.size();
+		zpk.Zeros.resize(zpk.Zeros.size() + degree, 0.0);
+		zpk.Gain = prototype.Gain * std::pow(bandwidth, static_cast<double>(degree));
+		return zpk;
+	}
+
+	ZPK bilinear(const ZPK& analog, double samplingRate)
+	{
+		double fs2 = 2.0 * samplingRate;
+		ZPK zpk;
+		for (const auto& zero : analog.Zeros) zpk.Zeros.push_back((fs2 + zero) / (fs2 - zero));
+		for (const auto& pole : analog.Poles) zpk.Poles.push_back((fs2 + pole) / (fs2 - pole));
+		// Zeros at infinity end up at Nyquist
+		zpk.Zeros.resize(zpk.Poles.size(), -1.0);
+		zpk.Gain = analog.Gain * (product(analog.Zeros, fs2, -1.0) / product(analog.Poles, fs2, -1.0)).real();
+		return zpk;
+	}
+
+	bool is_real(const Complex& value) { return std::abs(value.imag()) <= REAL_TOLERANCE * std::max(1.0, std::abs(value)); }
+
+	// Removes and returns the root nearest to target, only considering real ones when realOnly is set
+	bool take_nearest(std::vector<Complex>& roots, const Complex& target, bool realOnly, Complex& out)
+	{
+		auto best = roots.end();
+		for (auto it = roots.begin(); it != roots.end(); ++it) {
+			if (realOnly && !is_real(*it)) continue;
+			if (best == roots.end() || std::abs(*it - target) < std::abs(*best - target)) best = it;
+		}
+		if (best == roots.end()) return false;
+		out = *best;
+		roots.erase(best);
+		return true;
+	}
+
+	// Removes the conjugate partner of a complex root
+	void take_conjugate(std::vector<Complex>& roots, const Complex& root)
+	{
+		Complex partner;
+		take_nearest(roots, std::conj(root), false, partner);
+	}
+
+	// Pairs poles and zeros into biquads like scipy's zpk2sos(pairing='nearest') : poles are taken nearest
+	// to the unit circle first and matched with their nearest zeros, those sections go last in the cascade
+	std::vector<NIRS::Biquad> zpk_to_sos(ZPK zpk)
+	{
+		std::vector<NIRS::Biquad> sections;
+		auto& poles = zpk.Poles;
+		auto& zeros = zpk.Zeros;
+
+		while (!poles.empty()) {
+			auto nearest = std::min_element(poles.begin(), poles.end(), [](const Complex& a, const Complex& b) {
+				return std::abs(1.0 - std::abs(a)) < std::abs(1.0 - std::abs(b));
+			});
+			Complex p1 = *nearest;
+			poles.erase(nearest);
+
+			Complex p2 = 0.0;
+			bool second_order = true;
+			if (!is_real(p1)) {
+				take_conjugate(poles, p1);
+				p2 = std::conj(p1);
+			}
+			else if (!take_nearest(poles, p1, true, p2)) {
+				second_order = false; // Odd order, a lone real pole
+			}
+
+			Complex z1 = 0.0, z2 = 0.0;
+			int num_zeros = 0;
+			if (take_nearest(zeros, p1, false, z1)) {
+				num_zeros = 1;
+				if (!is_real(z1)) {
+					take_conjugate(zeros, z1);
+					z2 = std::conj(z1);
+					num_zeros = 2;
+				}
+				else if (second_order && take_nearest(zeros, p1, true, z2)) {
+					num_zeros = 2;
+				}
+			}
+
+			NIRS::Biquad section;
+			if (num_zeros == 2) {
+				section.B1 = -(z1 + z2).real();
+				section.B2 = (z1 * z2).real();
+			}
+			else if (num_zeros == 1) {
+				section.B1 = -z1.real();
+			}
+			if (second_order) {
+				section.A1 = -(p1 + p2).real();
+				section.A2 = (p1 * p2).real();
+			}
+			else {
+				section.A1 = -p1.real();
+			}
+			sections.push_back(section);
+		}
+
+		// Built from the unit circle inwards, the cascade runs the other way and carries the gain up front
+		std::reverse(sections.begin(), sections.end());
+		if (!sections.empty()) {
+			sections.front().B0 *= zpk.Gain;
+			sections.front().B1 *= zpk.Gain;
+			sections.front().B2 *= zpk.Gain;
+		}
+		return sections;
+	}
+
+	// Frequency in Hz to the prewarped analog frequency of the bilinear transform
+	double prewarp(double frequency, double samplingRate)
+	{
+		return 2.0 * samplingRate * std::tan(PI * frequency / samplingRate);
+	}
+}
+
+std::vector<NIRS::Biquad> NIRS::DesignFilter(const FilterSpecification& spec, double samplingRate)
+{
+	double nyquist = samplingRate / 2.0;
+	bool uses_low = spec.Type != FilterType::Lowpass;
+	bool uses_high = spec.Type != FilterType::Highpass;
+
+	if (spec.Order < 1 || samplingRate <= 0.0) {
+		NVIZ_ERROR("Invalid filter : order {} at {} Hz", spec.Order, samplingRate);
+		return {};
+	}
+	if ((uses_low && (spec.LowCutoff <= 0.0 || spec.LowCutoff >= nyquist)) ||
+		(uses_high && (spec.HighCutoff <= 0.0 || spec.HighCutoff >= nyquist)) ||
+		(uses_low && uses_high && spec.LowCutoff >= spec.HighCutoff)) {
+		NVIZ_ERROR("Filter cutoffs {} - {} Hz do not fit a {} Hz sampling rate", spec.LowCutoff, spec.HighCutoff, samplingRate);
+		return {};
+	}
+	if (spec.Family == FilterFamily::Chebyshev1 && spec.RippleDb <= 0.0) {
+		NVIZ_ERROR("Chebyshev filter needs a positive passband ripple, got {} dB", spec.RippleDb);
+		return {};
+	}
+
+	Utils::ZPK prototype = spec.Family == FilterFamily::Butterworth
+		? Utils::butterworth_prototype(spec.Order)
+		: Utils::chebyshev1_prototype(spec.Order, spec.RippleDb);
+
+	Utils::ZPK analog;
+	switch (spec.Type) {
+	case FilterType::Lowpass:
+		analog = Utils::lowpass_to_lowpass(prototype, Utils::prewarp(spec.HighCutoff, samplingRate));
+		break;
+	case FilterType::Highpass:
+		analog = Utils::lowpass_to_highpass(prototype, Utils::prewarp(spec.LowCutoff, samplingRate));
+		break;
+	case FilterType::Bandpass: {
+		double low = Utils::prewarp(spec.LowCutoff, samplingRate);
+		double high = Utils::prewarp(spec.HighCutoff, samplingRate);
+		analog = Utils::lowpass_to_bandpass(prototype, std::sqrt(low * high), high - low);
+		break;
+	}
+	}
+
+	return Utils::zpk_to_sos(Utils::bilinear(analog, samplingRate));
+}
+
+std::vector<NIRS::SectionState> NIRS::ComputeInitialConditions(const std::vector<Biquad>& sections)
+{
+	// A section in steady state under a step outputs its DC gain, which gives both transposed direct form II states.
+	// Every section sees the step scaled by the DC gain of the sections before it
+	std::vector<SectionState> conditions(sections.size());
+	double scale = 1.0;
+	for (size_t s = 0; s < sections.size(); s++) {
+		const Biquad& section = sections[s];
+		double gain = (section.B0 + section.B1 + section.B2) / (1.0 + section.A1 + section.A2);
+		conditions[s] = { scale * (gain - section.B0), scale * (section.B2 - section.A2 * gain) };
+		scale *= gain;
+	}
+	return conditions;
+}
+
+size_t NIRS::GetFiltFiltPadding(const std::vector<Biquad>& sections, size_t numSamples)
+{
+	if (numSamples < 2) return 0;
+
+	size_t first_order_zeros = 0, first_order_poles = 0;
+	for (const auto& section : sections) {
+		if (section.B2 == 0.0) first_order_zeros++;
+		if (section.A2 == 0.0) first_order_poles++;
+	}
+	size_t taps = 2 * sections.size() + 1 - std::min(first_order_zeros, first_order_poles);
+	return std::min(3 * taps, numSamples - 1);
+}
+
+NIRS::SOSFilter::SOSFilter(const std::vector<Biquad>& sections)
+	: m_Sections(sections), m_State(sections.size(), { 0.0, 0.0 }), m_InitialConditions(ComputeInitialConditions(sections))
+{
+}
+
+double NIRS::SOSFilter::Process(double x)
+{
+	for (size_t s = 0; s < m_Sections.size(); s++) {
+		const Biquad& section = m_Sections[s];
+		auto& z = m_State[s];
+
+		double y = section.B0 * x + z[0];
+		z[0] = section.B1 * x - section.A1 * y + z[1];
+		z[1] = section.B2 * x - section.A2 * y;
+		x = y;
+	}
+	return x;
+}
+
+template<typename T>
+void NIRS::SOSFilter::Process(T* data, size_t numSamples)
+{
+	Run<false>(data, numSamples);
+}
+
+template<typename T>
+void NIRS::SOSFilter::ProcessReverse(T* data, size_t numSamples)
+{
+	Run<true>(data, numSamples);
+}
+
+template<bool Reverse, typename T>
+void NIRS::SOSFilter::Run(T* data, size_t numSamples)
+{
+	for (size_t s = 0; s < m_Sections.size(); s++) {
+		const Biquad section = m_Sections[s];
+		double z0 = m_State[s][0];
+		double z1 = m_State[s][1];
+
+		for (size_t n = 0; n < numSamples; n++) {
+			size_t i = Reverse ? numSamples - 1 - n : n;
+			double x = data[i];
+			double y = section.B0 * x + z0;
+			z0 = section.B1 * x - section.A1 * y + z1;
+			z1 = section.B2 * x - section.A2 * y;
+			data[i] = static_cast<T>(y);
+		}
+
+		m_State[s] = { z0, z1 };
+	}
+}
+
+void NIRS::SOSFilter::FiltFilt(double* data, size_t numSamples)
+{
+	if (IsEmpty() || numSamples == 0) {
+		return;
+	}
+
+	// The extended signal is left | data | right, only the two ends are materialized
+	size_t padding = GetFiltFiltPadding(m_Sections, numSamples);
+	m_Scratch.resize(2 * padding);
+	double* left = m_Scratch.data();
+	double* right = m_Scratch.data() + padding;
+	for (size_t k = 0; k < padding; k++) {
+		left[k] = 2.0 * data[0] - data[padding - k];
+		right[k] = 2.0 * data[numSamples - 1] - data[numSamples - 2 - k];
+	}
+
+	SetSteadyState(padding ? left[0] : data[0]);
+	Process(left, padding);
+	Process(data, numSamples);
+	Process(right, padding);
+
+	SetSteadyState(padding ? right[padding - 1] : data[numSamples - 1]);
+	ProcessReverse(right, padding);
+	ProcessReverse(data, numSamples);
+	ProcessReverse(left, padding);
+}
+
+void NIRS::SOSFilter::Reset()
+{
+	std::fill(m_State.begin(), m_State.end(), SectionState{ 0.0, 0.0 });
+}
+
+void NIRS::SOSFilter::SetSteadyState(double value)
+{
+	for (size_t s = 0; s < m_State.size(); s++) {
+		m_State[s] = { m_InitialConditions[s][0] * value, m_InitialConditions[s][1] * value };
+	}
+}
+
+template void NIRS::SOSFilter::Process<float>(float*, size_t);
+template void NIRS::SOSFilter::Process<double>(double*, size_t);
+template void NIRS::SOSFilter::ProcessReverse<float>(float*, size_t);
+template void NIRS::SOSFilter::ProcessReverse<double>(double*, size_t);
+
+NIRS::InterleavedSOSFilter::InterleavedSOSFilter(const std::vector<Biquad>& sections)
+	: m_Sections(sections), m_State(sections.size() * 2 * Lanes, 0.0), m_InitialConditions(ComputeInitialConditions(sections))
+{
+}
+
+void NIRS::InterleavedSOSFilter::Process(double* data, size_t numSamples)
+{
+	Run<false>(data, numSamples);
+}
+
+void NIRS::InterleavedSOSFilter::ProcessReverse(double* data, size_t numSamples)
+{
+	Run<true>(data, numSamples);
+}
+
+template<bool Reverse>
+void NIRS::InterleavedSOSFilter::Run(double* data, size_t numSamples)
+{
+	using SIMD::DoubleVec;
+	constexpr size_t WIDTH = DoubleVec::Width;
+	constexpr size_t VECTORS = Lanes / WIDTH;
+	static_assert(Lanes % WIDTH == 0, "Lanes has to be a multiple of the vector width");
+
+	// Rows are taken a tile at a time and every section runs over the tile while it is in L1,
+	// the state of a section stays in registers for the whole tile
+	constexpr size_t TILE = 128;
+	for (size_t tile = 0; tile < numSamples; tile += TILE) {
+		size_t count = std::min(TILE, numSamples - tile);
+
+		for (size_t s = 0; s < m_Sections.size(); s++) {
+			const Biquad& section = m_Sections[s];
+			DoubleVec b0 = DoubleVec::Broadcast(section.B0);
+			DoubleVec b1 = DoubleVec::Broadcast(section.B1);
+			DoubleVec b2 = DoubleVec::Broadcast(section.B2);
+			DoubleVec a1 = DoubleVec::Broadcast(section.A1);
+			DoubleVec a2 = DoubleVec::Broadcast(section.A2);
+
+			double* state = m_State.data() + s * 2 * Lanes;
+			DoubleVec z0[VECTORS], z1[VECTORS];
+			for (size_t v = 0; v < VECTORS; v++) {
+				z0[v] = DoubleVec::Load(state + v * WIDTH);
+				z1[v] = DoubleVec::Load(state + Lanes + v * WIDTH);
+			}
+
+			for (size_t n = 0; n < count; n++) {
+				size_t i = Reverse ? numSamples - 1 - (tile + n) : tile + n;
+				double* row = data + i * Lanes;
+				for (size_t v = 0; v < VECTORS; v++) {
+					DoubleVec x = DoubleVec::Load(row + v * WIDTH);
+					DoubleVec y = MulAdd(b0, x, z0[v]);
+					z0[v] = NegMulAdd(a1, y, MulAdd(b1, x, z1[v]));
+					z1[v] = NegMulAdd(a2, y, b2 * x);
+					y.Store(row + v * WIDTH);
+				}
+			}
+
+			for (size_t v = 0; v < VECTORS; v++) {
+				z0[v].Store(state + v * WIDTH);
+				z1[v].Store(state + Lanes + v * WIDTH);
+			}
+		}
+	}
+}
+
+void NIRS::InterleavedSOSFilter::FiltFilt(double* data, size_t numSamples, size_t padding)
+{
+	if (IsEmpty() || numSamples == 0) {
+		return;
+	}
+
+	// Odd extensions into the free rows, lanes are independent so this is the scalar formula per lane
+	const double* first = data + padding * Lanes;
+	const double* last = data + (padding + numSamples - 1) * Lanes;
+	for (size_t k = 0; k < padding; k++) {
+		double* left = data + k * Lanes;
+		double* right = data + (padding + numSamples + k) * Lanes;
+		const double* mirror_left = first + (padding - k) * Lanes;
+		const double* mirror_right = last - (k + 1) * Lanes;
+		for (size_t lane = 0; lane < Lanes; lane++) {
+			left[lane] = 2.0 * first[lane] - mirror_left[lane];
+			right[lane] = 2.0 * last[lane] - mirror_right[lane];
+		}
+	}
+
+	size_t rows = numSamples + 2 * padding;
+	SetSteadyState(data);
+	Process(data, rows);
+	SetSteadyState(data + (rows - 1) * Lanes);
+	ProcessReverse(data, rows);
+}
+
+void NIRS::InterleavedSOSFilter::Reset()
+{
+	std::fill(m_State.begin(), m_State.end(), 0.0);
+}
+
+void NIRS::InterleavedSOSFilter::SetSteadyState(const double* values)
+{
+	for (size_t s = 0; s < m_Sections.size(); s++) {
+		double* state = m_State.data() + s * 2 * Lanes;
+		for (size_t lane = 0; lane < Lanes; lane++) {
+			state[lane] = m_InitialConditions[s][0] * values[lane];
+			state[Lanes + lane] = m_InitialConditions[s][1] * values[lane];
+		}
+	}
+}
@@ -0,0 +1,317 @@
+#include "pch.h"
+#include "NIRS/GLM.h"
+
+#include <map>
+#include <cmath>
+#include <limits>
+#include <algorithm>
+
+#include "Core/ThreadPool.h"
+
+namespace Utils {
+
+	static constexpr double PI = 3.14159265358979323846;
+
+	// SPM's canonical HRF : gamma densities of shape 6 and 16 (unit scale), the second at 1/6 of the first
+	static constexpr double HRF_PEAK_SHAPE = 6.0;
+	static constexpr double HRF_UNDERSHOOT_SHAPE = 16.0;
+	static constexpr double HRF_UNDERSHOOT_RATIO = 1.0 / 6.0;
+
+	// X'X this close to singular is treated as rank deficient by the Cholesky solver
+	static constexpr double MINIMUM_RCOND = 1e-12;
+
+	// Channels per right-hand side block. 32 columns of a 10 Hz hour are 9 MB, and a task of the pool
+	static constexpr size_t BLOCK_CHANNELS = 32;
+
+	static double gamma_density(double t, double shape)
+	{
+		if (t <= 0.0) return 0.0;
+		return std::exp((shape - 1.0) * std::log(t) - t - std::lgamma(shape));
+	}
+
+	static std::vector<double> boxcar(const std::vector<NIRS::GLMEvent>& events, size_t numSamples, double samplingRate)
+	{
+		std::vector<double> signal(numSamples, 0.0);
+		for (const auto& event : events) {
+			double onset = std::round(event.Onset * samplingRate);
+			if (onset >= static_cast<double>(numSamples) || !(onset > -1.0)) {
+				continue;
+			}
+			size_t first = static_cast<size_t>(onset);
+			size_t length = std::max<size_t>(static_cast<size_t>(std::round(std::max(event.Duration, 0.0) * samplingRate)), 1);
+			size_t last = std::min(first + length, numSamples);
+			for (size_t i = first; i < last; i++) signal[i] += event.Amplitude;
+		}
+		return signal;
+	}
+
+	// Causal convolution truncated to numSamples
+	static void convolve(const std::vector<double>& signal, const std::vector<double>& kernel, double* out)
+	{
+		size_t n = signal.size();
+		std::fill(out, out + n, 0.0);
+		for (size_t i = 0; i < n; i++) {
+			if (signal[i] == 0.0) continue;
+			size_t count = std::min(kernel.size(), n - i);
+			for (size_t k = 0; k < count; k++) out[i + k] += signal[i] * kernel[k];
+		}
+	}
+
+	template<typename T>
+	static void fit_parallel(const NIRS::GLMSolver& solver, const std::vector<const T*>& channels, const std::vector<size_t>& columns,
+		NIRS::GLMResult& result, ThreadPool* pool)
+	{
+		ThreadPool& fit_pool = pool ? *pool : ThreadPool::Get();
+		size_t num_blocks = (channels.size() + BLOCK_CHANNELS - 1) / BLOCK_CHANNELS;
+		fit_pool.ParallelFor(0, num_blocks, 1, [&](size_t b) {
+			size_t first = b * BLOCK_CHANNELS;
+			size_t count = std::min(BLOCK_CHANNELS, channels.size() - first);
+			solver.FitInto(channels.data() + first, columns.data() + first, count, result);
+		});
+	}
+
+	static void resize_result(NIRS::GLMResult& result, size_t numRegressors, size_t numChannels)
+	{
+		constexpr double NaN = std::numeric_limits<double>::quiet_NaN();
+		result.Betas = Eigen::MatrixXd::Constant(numRegressors, numChannels, NaN);
+		result.TValues = Eigen::MatrixXd::Constant(numRegressors, numChannels, NaN);
+		result.ResidualVariance = Eigen::VectorXd::Constant(numChannels, NaN);
+		result.DegreesOfFreedom.assign(numChannels, 0);
+	}
+}
+
+std::vector<double> NIRS::CanonicalHRF(double samplingRate, double duration)
+{
+	size_t length = std::max<size_t>(static_cast<size_t>(std::ceil(duration * samplingRate)), 1);
+	std::vector<double> hrf(length);
+	double sum = 0.0;
+	for (size_t i = 0; i < length; i++) {
+		double t = static_cast<double>(i) / samplingRate;
+		hrf[i] = Utils::gamma_density(t, Utils::HRF_PEAK_SHAPE) - Utils::HRF_UNDERSHOOT_RATIO * Utils::gamma_density(t, Utils::HRF_UNDERSHOOT_SHAPE);
+		sum += hrf[i];
+	}
+	if (sum != 0.0) {
+		for (auto& value : hrf) value /= sum;
+	}
+	return hrf;
+}
+
+NIRS::GLMDesign NIRS::BuildDesignMatrix(const GLMDesignSpecification& spec, size_t numSamples, double samplingRate)
+{
+	GLMDesign design;
+	if (numSamples == 0 || !(samplingRate > 0.0)) {
+		NVIZ_ERROR("Cannot build a design matrix for {} samples at {} Hz", numSamples, samplingRate);
+		return design;
+	}
+
+	size_t num_drift = 0;
+	if (spec.Drift == GLMDrift::Polynomial) {
+		num_drift = static_cast<size_t>(std::max(spec.DriftOrder, 0));
+	}
+	else if (spec.Drift == GLMDrift::Cosine && spec.DriftCutoffSeconds > 0.0) {
+		// SPM's spm_filter : every cosine with a period longer than the cutoff
+		double duration = static_cast<double>(numSamples) / samplingRate;
+		num_drift = static_cast<size_t>(std::floor(2.0 * duration / spec.DriftCutoffSeconds));
+	}
+
+	size_t num_conditions = spec.Conditions.size();
+	design.X.resize(numSamples, num_conditions + num_drift + 1);
+
+	auto hrf = CanonicalHRF(samplingRate, spec.HRFSeconds);
+	for (size_t c = 0; c < num_conditions; c++) {
+		const auto& condition = spec.Conditions[c];
+		Utils::convolve(Utils::boxcar(condition.Events, numSamples, samplingRate), hrf, design.X.col(c).data());
+		design.Regressors.push_back(condition.Name.empty() ? "Condition " + std::to_string(c + 1) : condition.Name);
+	}
+
+	double n = static_cast<double>(numSamples);
+	for (size_t k = 1; k <= num_drift; k++) {
+		auto column = design.X.col(num_conditions + k - 1);
+		if (spec.Drift == GLMDrift::Polynomial) {
+			// Legendre rather than plain powers, the columns stay close to orthogonal on [-1, 1]
+			for (size_t i = 0; i < numSamples; i++) {
+				double x = numSamples > 1 ? 2.0 * static_cast<double>(i) / (n - 1.0) - 1.0 : 0.0;
+				double previous = 1.0, current = x;
+				for (size_t order = 1; order < k; order++) {
+					double next = ((2.0 * order + 1.0) * x * current - order * previous) / (order + 1.0);
+					previous = current;
+					current = next;
+				}
+				column(i) = current;
+			}
+		}
+		else {
+			for (size_t i = 0; i < numSamples; i++) {
+				column(i) = std::cos(Utils::PI * static_cast<double>(k) * (static_cast<double>(i) + 0.5) / n);
+			}
+		}
+		design.Regressors.push_back("Drift " + std::to_string(k));
+	}
+
+	design.X.col(design.X.cols() - 1).setOnes();
+	design.Regressors.push_back("Constant");
+	return design;
+}
+
+NIRS::GLMSolver::GLMSolver(const GLMDesign& design, GLMSolverMethod method)
+	: m_Design(design), m_Method(method)
+{
+	Eigen::Index n = m_Design.X.rows();
+	Eigen::Index p = m_Design.X.cols();
+	if (p == 0 || n <= p) {
+		NVIZ_ERROR("GLM design has {} regressors for {} samples, nothing to fit", p, n);
+		return;
+	}
+
+	// Each method only rejects what it cannot solve itself, QR takes designs whose X'X is too close to singular for Cholesky
+	if (m_Method == GLMSolverMethod::QR) {
+		// Eigen's default threshold, a pivot below p * epsilon of the largest one counts as zero
+		m_QR.compute(m_Design.X);
+		if (m_QR.rank() < p) {
+			NVIZ_ERROR("GLM design is rank deficient, only {} of its {} regressors are independent", m_QR.rank(), p);
+			return;
+		}
+
+		// X P = Q R, so (X'X)^-1 = P R^-1 R^-T P' and its diagonal is the squared rows of R^-1, permuted back
+		Eigen::MatrixXd r_inverse = m_QR.matrixR().topLeftCorner(p, p).triangularView<Eigen::Upper>().solve(Eigen::MatrixXd::Identity(p, p));
+		m_InverseDiagonal = m_QR.colsPermutation() * r_inverse.rowwise().squaredNorm();
+	}
+	else {
+		Eigen::MatrixXd gram = Eigen::MatrixXd::Zero(p, p);
+		gram.selfadjointView<Eigen::Lower>().rankUpdate(m_Design.X.transpose());
+		m_Cholesky.compute(gram.selfadjointView<Eigen::Lower>());
+		if (m_Cholesky.info() != Eigen::Success || !(m_Cholesky.rcond() > Utils::MINIMUM_RCOND)) {
+			NVIZ_ERROR("GLM design is rank deficient, some of its {} regressors are collinear", p);
+			return;
+		}
+		m_InverseDiagonal = m_Cholesky.solve(Eigen::MatrixXd::Identity(p, p)).diagonal();
+	}
+
+	m_Valid = true;
+}
+
+template<typename T>
+NIRS::GLMResult NIRS::GLMSolver::Fit(const T* const* channels, size_t numChannels, ThreadPool* pool) const
+{
+	GLMResult result;
+	result.Regressors = m_Design.Regressors;
+	Utils::resize_result(result, GetNumRegressors(), numChannels);
+	if (!m_Valid) {
+		return result;
+	}
+
+	std::vector<const T*> rows(channels, channels + numChannels);
+	std::vector<size_t> columns(numChannels);
+	for (size_t c = 0; c < numChannels; c++) columns[c] = c;
+	Utils::fit_parallel(*this, rows, columns, result, pool);
+	return result;
+}
+
+template<typename T>
+void NIRS::GLMSolver::FitInto(const T* const* channels, const size_t* columns, size_t numChannels, GLMResult& result) const
+{
+	if (!m_Valid || numChannels == 0) {
+		return;
+	}
+
+	Eigen::Index n = m_Design.X.rows();
+	Eigen::Index p = m_Design.X.cols();
+	size_t dof = static_cast<size_t>(n - p);
+
+	for (size_t first = 0; first < numChannels; first += Utils::BLOCK_CHANNELS) {
+		Eigen::Index count = static_cast<Eigen::Index>(std::min(Utils::BLOCK_CHANNELS, numChannels - first));
+
+		// Channel-major rows are the columns of Y as they are, only the cast to double copies
+		Eigen::MatrixXd y(n, count);
+		for (Eigen::Index j = 0; j < count; j++) {
+			y.col(j) = Eigen::Map<const Eigen::Matrix<T, Eigen::Dynamic, 1>>(channels[first + j], n).template cast<double>();
+		}
+
+		Eigen::MatrixXd betas;
+		if (m_Method == GLMSolverMethod::QR) {
+			betas = m_QR.solve(y);
+		}
+		else {
+			betas = m_Cholesky.solve(m_Design.X.transpose() * y);
+		}
+
+		// Residuals in place of y
+		y.noalias() -= m_Design.X * betas;
+		Eigen::RowVectorXd variance = y.colwise().squaredNorm() / static_cast<double>(dof);
+
+		for (Eigen::Index j = 0; j < count; j++) {
+			size_t column = columns[first + j];
+			result.Betas.col(column).head(p) = betas.col(j);
+			result.TValues.col(column).head(p) = betas.col(j).array() / (m_InverseDiagonal.array() * variance(j)).sqrt();
+			result.ResidualVariance(column) = variance(j);
+			result.DegreesOfFreedom[column] = dof;
+		}
+	}
+}
+
+template<typename T>
+NIRS::GLMResult NIRS::FitGLMBatched(const GLMDesign& base, const std::vector<GLMDesign>& extras, const std::vector<int>& designs,
+	const T* const* channels, size_t numChannels, GLMSolverMethod method, ThreadPool* pool)
+{
+	GLMResult result;
+	Eigen::Index n = base.X.rows();
+	Eigen::Index p = base.X.cols();
+	Eigen::Index q = extras.empty() ? 0 : extras.front().X.cols();
+
+	result.Regressors = base.Regressors;
+	if (!extras.empty()) {
+		result.Regressors.insert(result.Regressors.end(), extras.front().Regressors.begin(), extras.front().Regressors.end());
+	}
+	Utils::resize_result(result, static_cast<size_t>(p + q), numChannels);
+
+	if (designs.size() != numChannels) {
+		NVIZ_ERROR("GLM has {} channels but {} design indices", numChannels, designs.size());
+		return result;
+	}
+	for (const auto& extra : extras) {
+		if (extra.X.rows() != n || extra.X.cols() != q) {
+			NVIZ_ERROR("GLM extra regressors are {}x{}, expected {}x{} like the first", extra.X.rows(), extra.X.cols(), n, q);
+			return result;
+		}
+	}
+
+	// Channels by design, -1 are those with the base design alone
+	std::map<int, std::vector<size_t>> groups;
+	for (size_t c = 0; c < numChannels; c++) {
+		int d = designs[c];
+		if (d >= static_cast<int>(extras.size())) {
+			NVIZ_WARN("GLM channel {} refers to design {} of {}, fitting it without extra regressors", c, d, extras.size());
+			d = -1;
+		}
+		groups[std::max(d, -1)].push_back(c);
+	}
+
+	for (const auto& [d, members] : groups) {
+		GLMDesign design = base;
+		if (d >= 0) {
+			design.X.conservativeResize(n, p + q);
+			design.X.rightCols(q) = extras[d].X;
+			design.Regressors = result.Regressors;
+		}
+
+		GLMSolver solver(design, method);
+		if (!solver.IsValid()) {
+			NVIZ_WARN("GLM design {} cannot be fitted, its {} channels stay NaN", d, members.size());
+			continue;
+		}
+
+		std::vector<const T*> rows(members.size());
+		for (size_t i = 0; i < members.size(); i++) rows[i] = channels[members[i]];
+		Utils::fit_parallel(solver, rows, members, result, pool);
+	}
+	return result;
+}
+
+template NIRS::GLMResult NIRS::GLMSolver::Fit<float>(const float* const*, size_t, ThreadPool*) const;
+template NIRS::GLMResult NIRS::GLMSolver::Fit<double>(const double* const*, size_t, ThreadPool*) const;
+template void NIRS::GLMSolver::FitInto<float>(const float* const*, const size_t*, size_t, GLMResult&) const;
+template void NIRS::GLMSolver::FitInto<double>(const double* const*, const size_t*, size_t, GLMResult&) const;
+template NIRS::GLMResult NIRS::FitGLMBatched<float>(const GLMDesign&, const std::vector<GLMDesign>&, const std::vector<int>&,
+	const float* const*, size_t, GLMSolverMethod, ThreadPool*);
+template NIRS::GLMResult NIRS::FitGLMBatched<double>(const GLMDesign&, const std::vector<GLMDesign>&, const std::vector<int>&,
+	const double* const*, size_t, GLMSolverMethod, ThreadPool*);
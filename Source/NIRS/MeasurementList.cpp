@@ -0,0 +1,184 @@
+#include "pch.h"
+#include "NIRS/MeasurementList.h"
+
+#include <cstring>
+#include <cstdlib>
+
+#include <highfive/H5DataSet.hpp>
+
+using namespace HighFive;
+
+namespace Utils {
+
+    static constexpr const char* MEASUREMENT_LIST_PREFIX = "measurementList";
+    static constexpr int PROCESSED_DATA_TYPE = 99999;
+
+    // Reads a single integer from a scalar or 1 element dataset, straight through the C API.
+    // This is the hot path for per-channel groups, so it skips HighFive's object wrappers
+    bool read_scalar_int(hid_t group, const char* name, int& value)
+    {
+        hid_t dataset = -1;
+        H5E_BEGIN_TRY{
+            dataset = H5Dopen2(group, name, H5P_DEFAULT);
+        } H5E_END_TRY;
+        if (dataset < 0) return false;
+
+        bool ok = false;
+        hid_t space = H5Dget_space(dataset);
+        if (space >= 0) {
+            if (H5Sget_simple_extent_npoints(space) == 1) {
+                ok = H5Dread(dataset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, &value) >= 0;
+            }
+            H5Sclose(space);
+        }
+        H5Dclose(dataset);
+        return ok;
+    }
+
+    struct IterationContext {
+        std::vector<NIRS::MeasurementListEntry> Entries;
+        std::vector<std::string> LabelsToRead; // Group names whose dataTypeLabel is needed
+    };
+
+    // H5L_iterate2_t, the link info is not needed since every field is read from the group itself
+    herr_t visit_measurement_list(hid_t data, const char* name, const H5L_info_t*, void* user)
+    {
+        auto* context = static_cast<IterationContext*>(user);
+
+        const size_t prefix_length = std::strlen(MEASUREMENT_LIST_PREFIX);
+        if (std::strncmp(name, MEASUREMENT_LIST_PREFIX, prefix_length) != 0) return 0;
+
+        const char* digits = name + prefix_length;
+        if (*digits == '\0') return 0;
+        for (const char* c = digits; *c; c++) {
+            if (*c < '0' || *c > '9') return 0; // Skips "measurementLists" and anything else that is not ours
+        }
+
+        hid_t group = H5Gopen2(data, name, H5P_DEFAULT);
+        if (group < 0) return 0;
+
+        NIRS::MeasurementListEntry entry;
+        entry.Index = static_cast<uint32_t>(std::strtoul(digits, nullptr, 10));
+
+        bool ok = read_scalar_int(group, "sourceIndex", entry.SourceIndex)
+            && read_scalar_int(group, "detectorIndex", entry.DetectorIndex)
+            && read_scalar_int(group, "wavelengthIndex", entry.WavelengthIndex)
+            && read_scalar_int(group, "dataType", entry.DataType);
+        read_scalar_int(group, "dataTypeIndex", entry.DataTypeIndex);
+        H5Gclose(group);
+
+        if (!ok) {
+            NVIZ_ERROR("Incomplete measurement list : {}", name);
+            return 0;
+        }
+
+        if (entry.DataTypeIndex == -1 || entry.DataType == PROCESSED_DATA_TYPE) {
+            context->LabelsToRead.push_back(name);
+        }
+        context->Entries.push_back(std::move(entry));
+        return 0;
+    }
+
+    template <typename T>
+    std::vector<T> read_column(const Group& table, const std::string& name, size_t expected)
+    {
+        std::vector<T> column;
+        if (table.exist(name)) {
+            table.getDataSet(name).read(column);
+        }
+        if (!column.empty() && column.size() != expected) {
+            NVIZ_ERROR("measurementLists/{} has {} rows, expected {}", name, column.size(), expected);
+            column.clear();
+        }
+        return column;
+    }
+
+    std::vector<NIRS::MeasurementListEntry> parse_compact_table(const Group& table)
+    {
+        // SNIRF v1.1 : one array per field, one row per channel, so the whole table is a handful of reads
+        if (!table.exist("sourceIndex")) {
+            NVIZ_ERROR("measurementLists table without sourceIndex : {}", table.getPath());
+            return {};
+        }
+        const size_t rows = table.getDataSet("sourceIndex").getElementCount();
+
+        auto source_index = read_column<int>(table, "sourceIndex", rows);
+
+        auto detector_index = read_column<int>(table, "detectorIndex", rows);
+        auto wavelength_index = read_column<int>(table, "wavelengthIndex", rows);
+        auto data_type = read_column<int>(table, "dataType", rows);
+        auto data_type_index = read_column<int>(table, "dataTypeIndex", rows);
+        auto data_type_label = read_column<std::string>(table, "dataTypeLabel", rows);
+
+        if (source_index.empty() || detector_index.empty() || wavelength_index.empty() || data_type.empty()) {
+            NVIZ_ERROR("Incomplete measurementLists table : {}", table.getPath());
+            return {};
+        }
+
+        std::vector<NIRS::MeasurementListEntry> entries(rows);
+        for (size_t i = 0; i < rows; i++) {
+            auto& entry = entries[i];
+            entry.Index = static_cast<uint32_t>(i + 1);
+            entry.SourceIndex = source_index[i];
+            entry.DetectorIndex = detector_index[i];
+            entry.WavelengthIndex = wavelength_index[i];
+            entry.DataType = data_type[i];
+            entry.DataTypeIndex = data_type_index.empty() ? 0 : data_type_index[i];
+            entry.DataTypeLabel = data_type_label.empty() ? "" : data_type_label[i];
+        }
+        return entries;
+    }
+}
+
+std::vector<NIRS::MeasurementListEntry> NIRS::ParseMeasurementLists(const HighFive::Group& data)
+{
+    if (data.exist("measurementLists")) {
+        return Utils::parse_compact_table(data.getGroup("measurementLists"));
+    }
+
+    Utils::IterationContext context;
+    hsize_t position = 0;
+    H5Literate(data.getId(), H5_INDEX_NAME, H5_ITER_NATIVE, &position, Utils::visit_measurement_list, &context);
+
+    auto& entries = context.Entries;
+    std::sort(entries.begin(), entries.end(), [](const MeasurementListEntry& a, const MeasurementListEntry& b) {
+        return a.Index < b.Index;
+    });
+
+    // Labels are strings and comparatively slow to read, so only the ones that are needed get read
+    for (const auto& name : context.LabelsToRead) {
+        uint32_t index = static_cast<uint32_t>(std::strtoul(name.c_str() + std::strlen(Utils::MEASUREMENT_LIST_PREFIX), nullptr, 10));
+        auto it = std::lower_bound(entries.begin(), entries.end(), index, [](const MeasurementListEntry& entry, uint32_t value) {
+            return entry.Index < value;
+        });
+        if (it == entries.end() || it->Index != index) continue;
+
+        try {
+            data.getGroup(name).getDataSet("dataTypeLabel").read(it->DataTypeLabel);
+        }
+        catch (const Exception& e) {
+            NVIZ_ERROR("Failed to read {}/dataTypeLabel : {}", name, e.what());
+        }
+    }
+
+    return entries;
+}
+
+NIRS::WavelengthType NIRS::MeasurementListToWavelength(const MeasurementListEntry& entry)
+{
+    if (entry.DataTypeIndex == -1) {
+        // Parse dataTypeLabel
+        if (entry.DataTypeLabel == "HbO") {
+            return WavelengthType::HBO;
+        }
+        else if (entry.DataTypeLabel == "HbR") {
+            return WavelengthType::HBR;
+        }
+        else if (entry.DataTypeLabel == "HbT") {
+            return WavelengthType::HBT;
+        }
+        NVIZ_ERROR("Unknown dataTypeLabel: {0}", entry.DataTypeLabel);
+        return WavelengthType::HBR; // Default to something
+    }
+    return WavelengthType(entry.WavelengthIndex - 1);
+}
@@ -0,0 +1,119 @@
+#include "pch.h"
+#include "NIRS/OpticalDensity.h"
+
+#include <cmath>
+#include <vector>
+#include <algorithm>
+
+#include "Core/SIMD.h"
+
+namespace Utils {
+
+	static constexpr double INV_LN10 = 0.43429448190325182765;
+
+	template<typename T>
+	double median(const T* values, size_t count)
+	{
+		std::vector<T> sorted(values, values + count);
+		auto middle = sorted.begin() + count / 2;
+		std::nth_element(sorted.begin(), middle, sorted.end());
+		double upper = static_cast<double>(*middle);
+		if (count % 2 == 1) {
+			return upper;
+		}
+		double lower = static_cast<double>(*std::max_element(sorted.begin(), middle));
+		return 0.5 * (lower + upper);
+	}
+}
+
+template<typename T>
+double NIRS::ComputeBaselineIntensity(const T* raw, size_t numSamples, double samplingRate, const OpticalDensitySpecification& spec)
+{
+	if (numSamples == 0) {
+		return MinimumIntensity;
+	}
+
+	size_t window = numSamples;
+	if (spec.BaselineSeconds > 0.0 && samplingRate > 0.0) {
+		window = std::clamp<size_t>(static_cast<size_t>(std::round(spec.BaselineSeconds * samplingRate)), 1, numSamples);
+	}
+
+	double baseline = 0.0;
+	switch (spec.Baseline) {
+	case ODBaseline::FirstSample:
+		baseline = static_cast<double>(raw[0]);
+		break;
+	case ODBaseline::Mean: {
+		double sum = 0.0;
+		for (size_t i = 0; i < window; i++) sum += static_cast<double>(raw[i]);
+		baseline = sum / static_cast<double>(window);
+		break;
+	}
+	case ODBaseline::Median:
+		baseline = Utils::median(raw, window);
+		break;
+	}
+	return std::max(baseline, MinimumIntensity);
+}
+
+template<typename T>
+void NIRS::ConvertToOpticalDensity(const T* raw, T* od, size_t numSamples, double baseline)
+{
+	using SIMD::DoubleVec;
+	constexpr size_t WIDTH = DoubleVec::Width;
+
+	// log10(b / x) = (ln b - ln x) / ln 10, ln b is the same for every sample.
+	// The clamp keeps the log in its domain, the select then zeroes what was clamped
+	double log_baseline = std::log(std::max(baseline, MinimumIntensity));
+	const DoubleVec vlog_baseline = DoubleVec::Broadcast(log_baseline);
+	const DoubleVec minimum = DoubleVec::Broadcast(MinimumIntensity);
+	const DoubleVec inv_ln10 = DoubleVec::Broadcast(Utils::INV_LN10);
+	const DoubleVec zero = DoubleVec::Zero();
+
+	size_t i = 0;
+	for (; i + WIDTH <= numSamples; i += WIDTH) {
+		DoubleVec x = DoubleVec::Load(raw + i);
+		DoubleVec value = (vlog_baseline - SIMD::Log(SIMD::Max(x, minimum))) * inv_ln10;
+		SIMD::SelectGreaterEqual(x, minimum, value, zero).Store(od + i);
+	}
+	for (; i < numSamples; i++) {
+		double x = static_cast<double>(raw[i]);
+		od[i] = x >= MinimumIntensity ? static_cast<T>((log_baseline - std::log(x)) * Utils::INV_LN10) : T(0);
+	}
+}
+
+template<typename T>
+void NIRS::ConvertToOpticalDensity(const T* raw, T* od, size_t numSamples, double samplingRate, const OpticalDensitySpecification& spec)
+{
+	ConvertToOpticalDensity(raw, od, numSamples, ComputeBaselineIntensity(raw, numSamples, samplingRate, spec));
+}
+
+void NIRS::ConvertFrameToOpticalDensity(const double* raw, const double* baseline, double* od, size_t count)
+{
+	using SIMD::DoubleVec;
+	constexpr size_t WIDTH = DoubleVec::Width;
+
+	const DoubleVec minimum = DoubleVec::Broadcast(MinimumIntensity);
+	const DoubleVec inv_ln10 = DoubleVec::Broadcast(Utils::INV_LN10);
+	const DoubleVec zero = DoubleVec::Zero();
+
+	size_t i = 0;
+	for (; i + WIDTH <= count; i += WIDTH) {
+		DoubleVec x = DoubleVec::Load(raw + i);
+		DoubleVec b = SIMD::Max(DoubleVec::Load(baseline + i), minimum);
+		DoubleVec value = SIMD::Log(b / SIMD::Max(x, minimum)) * inv_ln10;
+		SIMD::SelectGreaterEqual(x, minimum, value, zero).Store(od + i);
+	}
+	for (; i < count; i++) {
+		// Operands in the order of SIMD::Max, so a NaN baseline is clamped in the tail too
+		double b = std::max(MinimumIntensity, baseline[i]);
+		od[i] = raw[i] >= MinimumIntensity ? std::log10(b / raw[i]) : 0.0;
+	}
+}
+
+template double NIRS::ComputeBaselineIntensity<float>(const float*, size_t, double, const OpticalDensitySpecification&);
+template double NIRS::ComputeBaselineIntensity<double>(const double*, size_t, double, const OpticalDensitySpecification&);
+template void NIRS::ConvertToOpticalDensity<float>(const float*, float*, size_t, double);
+template void NIRS::ConvertToOpticalDensity<double>(const double*, double*, size_t, double);
+template void NIRS::ConvertToOpticalDensity<float>(const float*, float*, size_t, double, const OpticalDensitySpecification&);
+template void NIRS::ConvertToOpticalDensity<double>(const double*, double*, size_t, double, const OpticalDensitySpecification&);
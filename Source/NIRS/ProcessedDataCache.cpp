@@ -0,0 +1,377 @@
+#include "pch.h"
+#include "NIRS/ProcessedDataCache.h"
+
+#include <cstddef>
+#include <cstring>
+#include <fstream>
+
+namespace Utils {
+
+    static constexpr char CACHE_MAGIC[8] = { 'N', 'V', 'I', 'Z', 'P', 'P', 'C', '\0' };
+    static constexpr uint32_t CACHE_VERSION = 5; // 5 : ContentHash is the caller's fingerprint of the recording, not a hash of the file
+    static constexpr size_t CACHE_ALIGNMENT = 64;
+    static constexpr const char* CACHE_EXTENSION = ".nvizcache";
+
+    struct CacheHeader {
+        char Magic[8];
+        uint32_t Version;
+        uint32_t HeaderSize;
+
+        uint64_t FileSize;
+        int64_t FileModifiedTime;
+        uint64_t ContentHash;
+        uint64_t ParametersHash;
+
+        uint64_t NumBlocks;
+        uint64_t BlockTableOffset;
+        uint64_t Reserved[8];
+    };
+    static_assert(sizeof(CacheHeader) == 128, "CacheHeader layout changed, bump CACHE_VERSION");
+
+    struct CachedBlock {
+        uint64_t NumChannels;
+        uint64_t NumSamples;
+        double SamplingRate;
+
+        uint64_t ChannelTableOffset;
+        uint64_t SampleDataOffset;
+        uint64_t SampleSize; // 4 or 8, see NIRS::SamplePrecision
+        uint64_t Reserved[2];
+    };
+    static_assert(sizeof(CachedBlock) == 64, "CachedBlock layout changed, bump CACHE_VERSION");
+
+    struct CachedChannel {
+        uint32_t ID;
+        uint32_t SourceID;
+        uint32_t DetectorID;
+        uint32_t Wavelength;
+    };
+    static_assert(sizeof(CachedChannel) == 16, "CachedChannel layout changed, bump CACHE_VERSION");
+
+    // Records the recording's new modification time after its contents were found unchanged, so the next open
+    // compares times again instead of hashing. Patched in place, the sidecar must not be mapped meanwhile
+    bool refresh_modified_time(const std::filesystem::path& cachePath, int64_t modifiedTime)
+    {
+        std::fstream file(cachePath, std::ios::binary | std::ios::in | std::ios::out);
+        if (!file) {
+            return false;
+        }
+        file.seekp(offsetof(CacheHeader, FileModifiedTime));
+        file.write(reinterpret_cast<const char*>(&modifiedTime), sizeof(modifiedTime));
+        return static_cast<bool>(file);
+    }
+
+    size_t align_up(size_t value)
+    {
+        return (value + CACHE_ALIGNMENT - 1) & ~(CACHE_ALIGNMENT - 1);
+    }
+
+    // --- xxHash64 primitives ---
+    static constexpr uint64_t PRIME1 = 11400714785074694791ull;
+    static constexpr uint64_t PRIME2 = 14029467366897019727ull;
+    static constexpr uint64_t PRIME3 = 1609587929392839161ull;
+    static constexpr uint64_t PRIME4 = 9650029242287828579ull;
+    static constexpr uint64_t PRIME5 = 2870177450012600261ull;
+
+    inline uint64_t rotl(uint64_t x, int r) { return (x << r) | (x >> (64 - r)); }
+
+    inline uint64_t read64(const uint8_t* p) { uint64_t v; std::memcpy(&v, p, 8); return v; }
+    inline uint32_t read32(const uint8_t* p) { uint32_t v; std::memcpy(&v, p, 4); return v; }
+
+    inline uint64_t round(uint64_t acc, uint64_t input)
+    {
+        acc += input * PRIME2;
+        acc = rotl(acc, 31);
+        return acc * PRIME1;
+    }
+
+    inline uint64_t merge_round(uint64_t acc, uint64_t value)
+    {
+        acc ^= round(0, value);
+        return acc * PRIME1 + PRIME4;
+    }
+}
+
+NIRS::ContentHasher::ContentHasher(uint64_t seed) : m_Seed(seed)
+{
+    m_Lanes[0] = seed + Utils::PRIME1 + Utils::PRIME2;
+    m_Lanes[1] = seed + Utils::PRIME2;
+    m_Lanes[2] = seed;
+    m_Lanes[3] = seed - Utils::PRIME1;
+}
+
+void NIRS::ContentHasher::Update(const void* data, size_t size)
+{
+    const uint8_t* p = static_cast<const uint8_t*>(data);
+    const uint8_t* end = p + size;
+    m_TotalSize += size;
+
+    if (m_BufferSize + size < 32) {
+        std::memcpy(m_Buffer + m_BufferSize, p, size);
+        m_BufferSize += size;
+        return;
+    }
+
+    if (m_BufferSize > 0) {
+        size_t fill = 32 - m_BufferSize;
+        std::memcpy(m_Buffer + m_BufferSize, p, fill);
+        for (int lane = 0; lane < 4; lane++) {
+            m_Lanes[lane] = Utils::round(m_Lanes[lane], Utils::read64(m_Buffer + lane * 8));
+        }
+        p += fill;
+        m_BufferSize = 0;
+    }
+
+    // Four independent lanes, so the multiplies pipeline
+    while (p + 32 <= end) {
+        m_Lanes[0] = Utils::round(m_Lanes[0], Utils::read64(p));
+        m_Lanes[1] = Utils::round(m_Lanes[1], Utils::read64(p + 8));
+        m_Lanes[2] = Utils::round(m_Lanes[2], Utils::read64(p + 16));
+        m_Lanes[3] = Utils::round(m_Lanes[3], Utils::read64(p + 24));
+        p += 32;
+    }
+
+    m_BufferSize = static_cast<size_t>(end - p);
+    std::memcpy(m_Buffer, p, m_BufferSize);
+}
+
+uint64_t NIRS::ContentHasher::Digest() const
+{
+    using namespace Utils;
+
+    uint64_t h;
+    if (m_TotalSize >= 32) {
+        h = rotl(m_Lanes[0], 1) + rotl(m_Lanes[1], 7) + rotl(m_Lanes[2], 12) + rotl(m_Lanes[3], 18);
+        for (int lane = 0; lane < 4; lane++) {
+            h = merge_round(h, m_Lanes[lane]);
+        }
+    }
+    else {
+        h = m_Seed + PRIME5;
+    }
+    h += m_TotalSize;
+
+    const uint8_t* p = m_Buffer;
+    const uint8_t* end = m_Buffer + m_BufferSize;
+    while (p + 8 <= end) {
+        h ^= Utils::round(0, read64(p));
+        h = rotl(h, 27) * PRIME1 + PRIME4;
+        p += 8;
+    }
+    if (p + 4 <= end) {
+        h ^= static_cast<uint64_t>(read32(p)) * PRIME1;
+        h = rotl(h, 23) * PRIME2 + PRIME3;
+        p += 4;
+    }
+    while (p < end) {
+        h ^= (*p) * PRIME5;
+        h = rotl(h, 11) * PRIME1;
+        p++;
+    }
+
+    h ^= h >> 33;
+    h *= PRIME2;
+    h ^= h >> 29;
+    h *= PRIME3;
+    h ^= h >> 32;
+    return h;
+}
+
+std::filesystem::path NIRS::ProcessedDataCache::GetCachePath(const std::filesystem::path& recording, const std::filesystem::path& cacheDirectory)
+{
+    std::filesystem::path filename = recording.filename();
+    filename += Utils::CACHE_EXTENSION;
+
+    if (cacheDirectory.empty()) {
+        return recording.parent_path() / filename;
+    }
+    return cacheDirectory / filename;
+}
+
+NIRS::ProcessedCacheKey NIRS::ProcessedDataCache::MakeKey(const std::filesystem::path& recording, uint64_t parametersHash)
+{
+    ProcessedCacheKey key;
+    std::error_code error;
+    key.FileSize = std::filesystem::file_size(recording, error);
+    key.FileModifiedTime = static_cast<int64_t>(std::filesystem::last_write_time(recording, error).time_since_epoch().count());
+    key.ParametersHash = parametersHash;
+    return key;
+}
+
+bool NIRS::ProcessedDataCache::Write(const std::filesystem::path& cachePath, const ProcessedCacheKey& key, const std::vector<ProcessedCacheBlock>& blocks)
+{
+    Utils::CacheHeader header = {};
+    std::memcpy(header.Magic, Utils::CACHE_MAGIC, sizeof(header.Magic));
+    header.Version = Utils::CACHE_VERSION;
+    header.HeaderSize = sizeof(Utils::CacheHeader);
+    header.FileSize = key.FileSize;
+    header.FileModifiedTime = key.FileModifiedTime;
+    header.ContentHash = key.ContentHash;
+    header.ParametersHash = key.ParametersHash;
+    header.NumBlocks = blocks.size();
+    header.BlockTableOffset = Utils::align_up(sizeof(Utils::CacheHeader));
+
+    // Lay every section out first, the file is then written front to back
+    std::vector<Utils::CachedBlock> block_table(blocks.size());
+    size_t offset = Utils::align_up(header.BlockTableOffset + blocks.size() * sizeof(Utils::CachedBlock));
+    for (size_t b = 0; b < blocks.size(); b++) {
+        auto& entry = block_table[b];
+        entry = {};
+        entry.NumChannels = blocks[b].Channels.size();
+        entry.NumSamples = blocks[b].NumSamples;
+        entry.SamplingRate = blocks[b].SamplingRate;
+        entry.ChannelTableOffset = offset;
+        entry.SampleDataOffset = Utils::align_up(offset + entry.NumChannels * sizeof(Utils::CachedChannel));
+        entry.SampleSize = GetSampleSize(blocks[b].Precision);
+        offset = Utils::align_up(entry.SampleDataOffset + entry.NumChannels * entry.NumSamples * entry.SampleSize);
+    }
+
+    // Written next to the target and renamed, so a reader never maps a half written sidecar
+    std::filesystem::path temporary = cachePath;
+    temporary += ".tmp";
+    {
+        std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+        if (!file) {
+            NVIZ_WARN("Cannot write processed data cache {}", cachePath.string());
+            return false;
+        }
+
+        static const char padding[Utils::CACHE_ALIGNMENT] = {};
+        size_t position = 0;
+        auto write = [&](const void* data, size_t size) {
+            file.write(static_cast<const char*>(data), size);
+            position += size;
+        };
+        auto pad_to = [&](size_t target) {
+            write(padding, target - position);
+        };
+
+        write(&header, sizeof(header));
+        pad_to(header.BlockTableOffset);
+        write(block_table.data(), block_table.size() * sizeof(Utils::CachedBlock));
+
+        for (size_t b = 0; b < blocks.size(); b++) {
+            const auto& block = blocks[b];
+            std::vector<Utils::CachedChannel> table(block.Channels.size());
+            for (size_t c = 0; c < block.Channels.size(); c++) {
+                const auto& channel = block.Channels[c];
+                table[c] = { channel.ID, channel.SourceID, channel.DetectorID, static_cast<uint32_t>(channel.Wavelength) };
+            }
+
+            pad_to(block_table[b].ChannelTableOffset);
+            write(table.data(), table.size() * sizeof(Utils::CachedChannel));
+            pad_to(block_table[b].SampleDataOffset);
+            write(block.Samples, block.Channels.size() * block.NumSamples * block_table[b].SampleSize);
+        }
+
+        if (!file) {
+            NVIZ_WARN("Failed writing processed data cache {}", cachePath.string());
+            return false;
+        }
+    }
+
+    std::error_code error;
+    std::filesystem::rename(temporary, cachePath, error);
+    if (error) {
+        NVIZ_WARN("Failed to move processed data cache into place {} : {}", cachePath.string(), error.message());
+        std::filesystem::remove(temporary, error);
+        return false;
+    }
+
+    NVIZ_INFO("Wrote processed data cache {}", cachePath.string());
+    return true;
+}
+
+Ref<NIRS::ProcessedDataCache> NIRS::ProcessedDataCache::Open(const std::filesystem::path& cachePath, const std::filesystem::path& recording, uint64_t parametersHash,
+    const std::function<uint64_t()>& hashContents)
+{
+    std::error_code error;
+    if (!std::filesystem::exists(cachePath, error)) {
+        return nullptr;
+    }
+
+    auto mapping = CreateRef<MappedFile>(cachePath);
+    if (!mapping->IsOpen() || mapping->GetSize() < sizeof(Utils::CacheHeader)) {
+        return nullptr;
+    }
+
+    Utils::CacheHeader header;
+    std::memcpy(&header, mapping->GetData(), sizeof(header));
+
+    if (std::memcmp(header.Magic, Utils::CACHE_MAGIC, sizeof(header.Magic)) != 0 || header.Version != Utils::CACHE_VERSION) {
+        NVIZ_WARN("Ignoring processed data cache with unknown format : {}", cachePath.string());
+        return nullptr;
+    }
+    if (header.ParametersHash != parametersHash) {
+        NVIZ_INFO("Processed data cache was made with other parameters : {}", cachePath.string());
+        return nullptr;
+    }
+
+    // Same size and modification time means the recording is untouched and the stored content hash holds.
+    // Otherwise the contents decide, so a copied or touched file still hits when the caller can hash them
+    ProcessedCacheKey key = MakeKey(recording, parametersHash);
+    if (header.FileSize != key.FileSize) {
+        return nullptr;
+    }
+    if (header.FileModifiedTime != key.FileModifiedTime) {
+        if (!hashContents || hashContents() != header.ContentHash) {
+            NVIZ_INFO("Processed data cache is stale : {}", cachePath.string());
+            return nullptr;
+        }
+
+        // A copy or checkout of the same recording, only its time changed
+        mapping.reset();
+        if (!Utils::refresh_modified_time(cachePath, key.FileModifiedTime)) {
+            NVIZ_WARN("Cannot update the modification time in processed data cache {}", cachePath.string());
+        }
+        mapping = CreateRef<MappedFile>(cachePath);
+        if (!mapping->IsOpen() || mapping->GetSize() < sizeof(Utils::CacheHeader)) {
+            return nullptr;
+        }
+    }
+
+    const uint8_t* data = mapping->GetData();
+    size_t size = mapping->GetSize();
+    if (header.BlockTableOffset + header.NumBlocks * sizeof(Utils::CachedBlock) > size) {
+        NVIZ_WARN("Processed data cache is truncated : {}", cachePath.string());
+        return nullptr;
+    }
+
+    auto cache = CreateRef<ProcessedDataCache>();
+    cache->m_Blocks.resize(header.NumBlocks);
+    for (size_t b = 0; b < header.NumBlocks; b++) {
+        Utils::CachedBlock entry;
+        std::memcpy(&entry, data + header.BlockTableOffset + b * sizeof(Utils::CachedBlock), sizeof(entry));
+
+        if (entry.SampleSize != GetSampleSize(SamplePrecision::Float32) && entry.SampleSize != GetSampleSize(SamplePrecision::Float64)) {
+            NVIZ_WARN("Processed data cache has an unknown sample size : {}", cachePath.string());
+            return nullptr;
+        }
+
+        uint64_t table_end = entry.ChannelTableOffset + entry.NumChannels * sizeof(Utils::CachedChannel);
+        uint64_t samples_end = entry.SampleDataOffset + entry.NumChannels * entry.NumSamples * entry.SampleSize;
+        if (table_end > entry.SampleDataOffset || samples_end > size || entry.SampleDataOffset % Utils::CACHE_ALIGNMENT != 0) {
+            NVIZ_WARN("Processed data cache is truncated : {}", cachePath.string());
+            return nullptr;
+        }
+
+        auto& block = cache->m_Blocks[b];
+        block.Channels.resize(entry.NumChannels);
+        for (size_t c = 0; c < entry.NumChannels; c++) {
+            Utils::CachedChannel cached;
+            std::memcpy(&cached, data + entry.ChannelTableOffset + c * sizeof(Utils::CachedChannel), sizeof(cached));
+
+            block.Channels[c].ID = cached.ID;
+            block.Channels[c].SourceID = cached.SourceID;
+            block.Channels[c].DetectorID = cached.DetectorID;
+            block.Channels[c].Wavelength = static_cast<WavelengthType>(cached.Wavelength);
+        }
+        block.Samples = data + entry.SampleDataOffset;
+        block.Precision = static_cast<SamplePrecision>(entry.SampleSize);
+        block.NumSamples = entry.NumSamples;
+        block.SamplingRate = entry.SamplingRate;
+    }
+
+    cache->m_Mapping = mapping;
+    return cache;
+}
@@ -1,59 +1,363 @@
 #include "pch.h"
 #include "NIRS/Processing.h"
 
+#include <cstring>
+#include <limits>
+#include <algorithm>
 
+#include "Core/SIMD.h"
+
+namespace Utils {
+	// Bump whenever the preprocessing algorithm changes, stale caches are then rejected
+	static constexpr uint64_t PREPROCESSING_VERSION = 6;
+
+	uint64_t hash_combine(uint64_t seed, uint64_t value)
+	{
+		return seed ^ (value + 0x9e3779b97f4a7c15ull + (seed << 6) + (seed >> 2));
+	}
+
+	uint64_t hash_float(float value)
+	{
+		uint32_t bits = 0;
+		std::memcpy(&bits, &value, sizeof(bits));
+		return bits;
+	}
+
+	uint64_t hash_double(double value)
+	{
+		uint64_t bits = 0;
+		std::memcpy(&bits, &value, sizeof(bits));
+		return bits;
+	}
+}
+
+namespace Utils {
+	// TDDR parameters of the reference implementation
+	static constexpr double TDDR_LOWPASS_HZ = 0.5;
+	static constexpr int TDDR_LOWPASS_ORDER = 3;
+	static constexpr double TDDR_TUNING = 4.685;   // Tukey's biweight constant
+	static constexpr double TDDR_MAD_SCALE = 1.4826; // Median absolute deviation -> standard deviation
+	static constexpr int TDDR_MAX_ITERATIONS = 50;
+
+	// In place, values is reordered
+	double median(double* values, size_t count)
+	{
+		double* middle = values + count / 2;
+		std::nth_element(values, middle, values + count);
+		if (count % 2 == 1) {
+			return *middle;
+		}
+		return 0.5 * (*std::max_element(values, middle) + *middle);
+	}
+
+	double weighted_mean(const double* values, const double* weights, size_t count)
+	{
+		using SIMD::DoubleVec;
+		constexpr size_t WIDTH = DoubleVec::Width;
+		DoubleVec sum = DoubleVec::Zero(), weight = DoubleVec::Zero();
+		size_t i = 0;
+		for (; i + WIDTH <= count; i += WIDTH) {
+			DoubleVec w = DoubleVec::Load(weights + i);
+			sum = MulAdd(w, DoubleVec::Load(values + i), sum);
+			weight = weight + w;
+		}
+		double lanes_sum[WIDTH], lanes_weight[WIDTH];
+		sum.Store(lanes_sum);
+		weight.Store(lanes_weight);
+		double total_sum = 0.0, total_weight = 0.0;
+		for (size_t lane = 0; lane < WIDTH; lane++) {
+			total_sum += lanes_sum[lane];
+			total_weight += lanes_weight[lane];
+		}
+		for (; i < count; i++) {
+			total_sum += weights[i] * values[i];
+			total_weight += weights[i];
+		}
+		return total_sum / total_weight;
+	}
+
+	// deviations[i] = |values[i] - mean|
+	void absolute_deviations(const double* values, double mean, double* deviations, size_t count)
+	{
+		using SIMD::DoubleVec;
+		constexpr size_t WIDTH = DoubleVec::Width;
+		const DoubleVec vmean = DoubleVec::Broadcast(mean);
+		const DoubleVec zero = DoubleVec::Zero();
+		size_t i = 0;
+		for (; i + WIDTH <= count; i += WIDTH) {
+			DoubleVec d = DoubleVec::Load(values + i) - vmean;
+			SIMD::Max(d, zero - d).Store(deviations + i);
+		}
+		for (; i < count; i++) deviations[i] = std::abs(values[i] - mean);
+	}
+
+	// Tukey's biweight of |values[i] - mean| / scale : (1 - r^2)^2 inside the unit interval, 0 outside
+	void biweights(const double* values, double mean, double scale, double* weights, size_t count)
+	{
+		using SIMD::DoubleVec;
+		constexpr size_t WIDTH = DoubleVec::Width;
+		const DoubleVec vmean = DoubleVec::Broadcast(mean);
+		const DoubleVec inv_scale = DoubleVec::Broadcast(1.0 / scale);
+		const DoubleVec one = DoubleVec::Broadcast(1.0);
+		const DoubleVec zero = DoubleVec::Zero();
+		size_t i = 0;
+		for (; i + WIDTH <= count; i += WIDTH) {
+			DoubleVec d = DoubleVec::Load(values + i) - vmean;
+			DoubleVec r = SIMD::Max(d, zero - d) * inv_scale;
+			DoubleVec t = NegMulAdd(r, r, one);
+			SIMD::SelectGreater(one, r, t * t, zero).Store(weights + i);
+		}
+		for (; i < count; i++) {
+			double r = std::abs(values[i] - mean) / scale;
+			double t = 1.0 - r * r;
+			weights[i] = r < 1.0 ? t * t : 0.0;
+		}
+	}
+}
+
+uint64_t NIRS::PreprocessingSpecification::Hash() const
+{
+	uint64_t seed = Utils::PREPROCESSING_VERSION;
+	seed = Utils::hash_combine(seed, Utils::hash_float(LowCutoff));
+	seed = Utils::hash_combine(seed, Utils::hash_float(HighCutoff));
+	seed = Utils::hash_combine(seed, static_cast<uint64_t>(FilterOrder));
+	seed = Utils::hash_combine(seed, static_cast<uint64_t>(OpticalDensity.Baseline));
+	seed = Utils::hash_combine(seed, Utils::hash_double(OpticalDensity.BaselineSeconds));
+	seed = Utils::hash_combine(seed, MotionCorrection ? 1 : 0);
+	seed = Utils::hash_combine(seed, ConvertToConcentration ? 1 : 0);
+	if (ConvertToConcentration) {
+		seed = Utils::hash_combine(seed, Utils::hash_double(BeerLambert.DefaultDPF));
+		for (double dpf : BeerLambert.DPF) seed = Utils::hash_combine(seed, Utils::hash_double(dpf));
+	}
+	return seed;
+}
+
+uint64_t NIRS::HashCombine(uint64_t seed, uint64_t value)
+{
+	return Utils::hash_combine(seed, value);
+}
+
+uint64_t NIRS::HashDouble(double value)
+{
+	return Utils::hash_double(value);
+}
+
+NIRS::ProcessingScratchPool::Lease NIRS::ProcessingScratchPool::Acquire()
+{
+	std::lock_guard<std::mutex> lock(m_Mutex);
+	if (m_Free.empty()) {
+		m_Scratch.push_back(CreateScope<ProcessingScratch>());
+		return Lease(*this, m_Scratch.back().get());
+	}
+	ProcessingScratch* scratch = m_Free.back();
+	m_Free.pop_back();
+	return Lease(*this, scratch);
+}
+
+void NIRS::ProcessingScratchPool::Release(ProcessingScratch* scratch)
+{
+	std::lock_guard<std::mutex> lock(m_Mutex);
+	m_Free.push_back(scratch);
+}
+
+std::vector<NIRS::Biquad> NIRS::DesignBandpass(const PreprocessingSpecification& spec, float samplingRate)
+{
+	FilterSpecification filter_spec;
+	filter_spec.Family = FilterFamily::Butterworth;
+	filter_spec.Type = FilterType::Bandpass;
+	filter_spec.Order = spec.FilterOrder;
+	filter_spec.LowCutoff = spec.LowCutoff;
+	filter_spec.HighCutoff = spec.HighCutoff;
+	return DesignFilter(filter_spec, samplingRate);
+}
 
 
 void NIRS::PreprocessHemodynamicData(const std::vector<NIRS::ChannelValue>& rawData, std::vector<NIRS::ChannelValue>& processedData, float samplingRate)
 {
-	// Convert to Optical Density
-	double initial_intensity = rawData[0];
-	const double EPSILON = 1e-9;
+	PreprocessHemodynamicData(rawData.data(), rawData.size(), processedData, samplingRate);
+}
 
-	if (initial_intensity < EPSILON) initial_intensity = EPSILON;
+void NIRS::PreprocessHemodynamicData(const NIRS::ChannelValue* rawData, size_t numSamples, std::vector<NIRS::ChannelValue>& processedData, float samplingRate, const PreprocessingSpecification& spec)
+{
+	processedData.resize(numSamples);
+	PreprocessHemodynamicData(rawData, numSamples, processedData.data(), samplingRate, spec);
+}
 
-	processedData.resize(rawData.size());
-	for (size_t i = 0; i < rawData.size(); i++) {
-		double intensity = rawData[i];
-		
-		if (intensity < EPSILON) { // Cannot divide by zero or take log of zero
-			processedData[i] = 0.0f;
-			continue;
-		}
-		
-		processedData[i] = std::log10(initial_intensity / intensity);
+template<typename T>
+void NIRS::PreprocessHemodynamicData(const T* rawData, size_t numSamples, T* processedData, float samplingRate, const PreprocessingSpecification& spec)
+{
+	PreprocessHemodynamicChannels(&rawData, &processedData, 1, numSamples, samplingRate, spec);
+}
+
+template<typename T>
+void NIRS::PreprocessHemodynamicChannels(const T* const* rawData, T* const* processedData, size_t numChannels, size_t numSamples, float samplingRate,
+	const PreprocessingSpecification& spec, ProcessingScratch* scratch)
+{
+	if (numSamples == 0 || numChannels == 0) {
+		return;
+	}
 
+	ProcessingScratch local_scratch;
+	ProcessingScratch& working = scratch ? *scratch : local_scratch;
+
+	// Convert to Optical Density
+	for (size_t c = 0; c < numChannels; c++) {
+		ConvertToOpticalDensity(rawData[c], processedData[c], numSamples, samplingRate, spec.OpticalDensity);
+		if (spec.MotionCorrection) {
+			CorrectMotionArtifactsTDDR(processedData[c], numSamples, samplingRate, &working);
+		}
 	}
-	// Bandpass Filter
-	// 0.01 to 0.5 Hz - Typical hemodynamic response range
-	// High order Butterworth filter implementation would go here
 
+	FilterHemodynamicChannels(processedData, processedData, numChannels, numSamples, DesignBandpass(spec, samplingRate), &working);
+	// Optical density to hemoglobin needs the channel pairs and probe geometry, the loader does it with BeerLambertConverter
+}
 
-    std::vector<double> signal;
-    signal.reserve(processedData.size());
-    for (auto& v : processedData) signal.push_back(v);
+template<typename T>
+void NIRS::FilterHemodynamicChannels(const T* const* input, T* const* output, size_t numChannels, size_t numSamples,
+	const std::vector<Biquad>& sections, ProcessingScratch* scratch)
+{
+	InterleavedSOSFilter filter(sections);
+	if (filter.IsEmpty() || numSamples == 0) {
+		return;
+	}
 
-    ButterworthBandpassFilter(signal, samplingRate, 0.01f, 0.1f);
-	// Optical Density to Hemoglobin Concentrations via Modified Beer-Lambert Law
+	// One buffer for the whole group, the signal rows sit between the odd extensions filtfilt adds at both ends.
+	// FiltFilt writes the padding itself, so a reused buffer only has to be large enough
+	constexpr size_t LANES = InterleavedSOSFilter::Lanes;
+	size_t padding = GetFiltFiltPadding(sections, numSamples);
+	ProcessingScratch local_scratch;
+	std::vector<double>& interleaved = (scratch ? *scratch : local_scratch).Interleaved;
+	if (interleaved.size() < (numSamples + 2 * padding) * LANES) {
+		interleaved.resize((numSamples + 2 * padding) * LANES);
+	}
+	for (size_t first = 0; first < numChannels; first += LANES) {
+		size_t count = std::min(LANES, numChannels - first);
+
+		// Bandpass Filter, always in double : the poles of a low cutoff band-pass sit too close
+		// to the unit circle for float state.
+		// Row by row, so the channels are read as parallel streams and the lanes written front to back. Unused lanes are zero
+		const T* const* in = input + first;
+		T* const* out = output + first;
+		double* signal = interleaved.data() + padding * LANES;
+		for (size_t i = 0; i < numSamples; i++) {
+			double* row = signal + i * LANES;
+			for (size_t c = 0; c < count; c++) row[c] = in[c][i];
+			for (size_t c = count; c < LANES; c++) row[c] = 0.0;
+		}
 
-    processedData = signal;
+		filter.FiltFilt(interleaved.data(), numSamples, padding);
 
+		for (size_t i = 0; i < numSamples; i++) {
+			const double* row = signal + i * LANES;
+			for (size_t c = 0; c < count; c++) out[c][i] = static_cast<T>(row[c]);
+		}
+	}
 }
 
-std::vector<double> zeroPhaseFilter(IIRFilter& filter, const std::vector<double>& input)
+template<typename T>
+void NIRS::CorrectMotionArtifactsTDDR(T* data, size_t numSamples, double samplingRate, ProcessingScratch* scratch)
 {
-	auto forward = filter.process(input);
-	std::vector<double> reversed(forward.rbegin(), forward.rend());
-	filter = IIRFilter(filter); // reset state
-	auto backward = filter.process(reversed);
-	return std::vector<double>(backward.rbegin(), backward.rend());
+	if (numSamples < 3) {
+		return;
+	}
+
+	// assign and resize reuse the capacity of a scratch that has seen a channel this long
+	ProcessingScratch local_scratch;
+	ProcessingScratch& working = scratch ? *scratch : local_scratch;
+
+	// Work in double around the mean
+	std::vector<double>& signal = working.Signal;
+	signal.assign(data, data + numSamples);
+	double mean = 0.0;
+	for (double value : signal) mean += value;
+	mean /= static_cast<double>(numSamples);
+	for (double& value : signal) value -= mean;
+
+	// Only the slow part is repaired, zero phase low-pass without padding like filtfilt(padlen=0)
+	FilterSpecification lowpass_spec;
+	lowpass_spec.Family = FilterFamily::Butterworth;
+	lowpass_spec.Type = FilterType::Lowpass;
+	lowpass_spec.Order = Utils::TDDR_LOWPASS_ORDER;
+	lowpass_spec.HighCutoff = Utils::TDDR_LOWPASS_HZ;
+
+	std::vector<double>& low = working.Low;
+	low.assign(signal.begin(), signal.end());
+	if (samplingRate > 2.0 * Utils::TDDR_LOWPASS_HZ) {
+		SOSFilter lowpass(DesignFilter(lowpass_spec, samplingRate));
+		if (!lowpass.IsEmpty()) {
+			lowpass.SetSteadyState(low.front());
+			lowpass.Process(low.data(), numSamples);
+			lowpass.SetSteadyState(low.back());
+			lowpass.ProcessReverse(low.data(), numSamples);
+		}
+	}
+
+	size_t num_derivatives = numSamples - 1;
+	std::vector<double>& derivative = working.Derivative;
+	derivative.resize(num_derivatives);
+	for (size_t i = 0; i < num_derivatives; i++) derivative[i] = low[i + 1] - low[i];
+
+	// Iteratively reweighted robust mean of the derivative
+	const double tolerance = std::sqrt(std::numeric_limits<double>::epsilon());
+	std::vector<double>& weights = working.Weights;
+	std::vector<double>& deviations = working.Deviations;
+	weights.assign(num_derivatives, 1.0);
+	deviations.resize(num_derivatives);
+	double mu = std::numeric_limits<double>::infinity();
+	for (int iteration = 0; iteration < Utils::TDDR_MAX_ITERATIONS; iteration++) {
+		double mu0 = mu;
+		mu = Utils::weighted_mean(derivative.data(), weights.data(), num_derivatives);
+
+		Utils::absolute_deviations(derivative.data(), mu, deviations.data(), num_derivatives);
+		double sigma = Utils::TDDR_MAD_SCALE * Utils::median(deviations.data(), num_derivatives);
+		if (!(sigma > 0.0)) {
+			break; // More than half the steps are identical, nothing to reweight against
+		}
+		Utils::biweights(derivative.data(), mu, sigma * Utils::TDDR_TUNING, weights.data(), num_derivatives);
+
+		if (std::abs(mu - mu0) < tolerance * std::max(std::abs(mu), std::abs(mu0))) {
+			break;
+		}
+	}
+
+	// Integrate the reweighted derivative, center the result like the reference, then put the fast part and
+	// the mean back. The first pass only sums the integral, so nothing has to be stored
+	double level = 0.0, level_sum = 0.0;
+	for (size_t i = 0; i < num_derivatives; i++) {
+		level += weights[i] * (derivative[i] - mu);
+		level_sum += level;
+	}
+	double offset = mean - level_sum / static_cast<double>(numSamples);
+
+	level = 0.0;
+	data[0] = static_cast<T>(signal[0] - low[0] + offset);
+	for (size_t i = 0; i < num_derivatives; i++) {
+		level += weights[i] * (derivative[i] - mu);
+		data[i + 1] = static_cast<T>(level + (signal[i + 1] - low[i + 1]) + offset);
+	}
 }
-void NIRS::ButterworthBandpassFilter(std::vector<double>& data, float sampleRate, float lowerCutoff, float higherCutoff)
+
+template void NIRS::CorrectMotionArtifactsTDDR<float>(float*, size_t, double, ProcessingScratch*);
+template void NIRS::CorrectMotionArtifactsTDDR<double>(double*, size_t, double, ProcessingScratch*);
+template void NIRS::PreprocessHemodynamicData<float>(const float*, size_t, float*, float, const PreprocessingSpecification&);
+template void NIRS::PreprocessHemodynamicData<double>(const double*, size_t, double*, float, const PreprocessingSpecification&);
+template void NIRS::PreprocessHemodynamicChannels<float>(const float* const*, float* const*, size_t, size_t, float, const PreprocessingSpecification&, ProcessingScratch*);
+template void NIRS::PreprocessHemodynamicChannels<double>(const double* const*, double* const*, size_t, size_t, float, const PreprocessingSpecification&, ProcessingScratch*);
+template void NIRS::FilterHemodynamicChannels<float>(const float* const*, float* const*, size_t, size_t, const std::vector<Biquad>&, ProcessingScratch*);
+template void NIRS::FilterHemodynamicChannels<double>(const double* const*, double* const*, size_t, size_t, const std::vector<Biquad>&, ProcessingScratch*);
+
+void NIRS::ButterworthBandpassFilter(std::vector<double>& data, float sampleRate, float lowerCutoff, float higherCutoff, int order)
 {
-	// Precalcuatled using Scipy's butter function
-	std::vector<double> b = { 4.4568762392924175e-07, 0.0, -2.2284381196462087e-06, 0.0, 4.456876239292417e-06, 0.0, -4.456876239292417e-06, 0.0, 2.2284381196462087e-06, 0.0, -4.4568762392924175e-07, };
+	FilterSpecification spec;
+	spec.Family = FilterFamily::Butterworth;
+	spec.Type = FilterType::Bandpass;
+	spec.Order = order;
+	spec.LowCutoff = lowerCutoff;
+	spec.HighCutoff = higherCutoff;
 
-	std::vector<double> a = { 1.0, -9.632908071507657, 41.76951188974173, -107.36208543704004, 181.1533213783332, -209.6623428034052, 168.56546947437533, -92.96027493337579, 33.65376715250092, -7.222126070431862, 0.6976674208093903, };
-	IIRFilter filter(b, a);
-	data = zeroPhaseFilter(filter, data);
+	SOSFilter filter(DesignFilter(spec, sampleRate));
+	if (filter.IsEmpty()) {
+		return;
+	}
+	filter.FiltFilt(data.data(), data.size());
 }
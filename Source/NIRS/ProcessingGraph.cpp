@@ -0,0 +1,414 @@
+#include "pch.h"
+#include "NIRS/ProcessingGraph.h"
+
+#include <cmath>
+#include <limits>
+#include <algorithm>
+
+#include "Core/Timer.h"
+#include "Core/ThreadPool.h"
+#include "NIRS/OpticalDensity.h"
+
+namespace Utils {
+
+	// Seeds per stage, so two stages with equal parameters never share a hash
+	static constexpr uint64_t OPTICAL_DENSITY_SEED = 0x4f44;
+	static constexpr uint64_t MOTION_CORRECTION_SEED = 0x54444452;
+	static constexpr uint64_t FILTER_SEED = 0x46494c54;
+	static constexpr uint64_t BEER_LAMBERT_SEED = 0x4d424c4c;
+	static constexpr uint64_t GLM_SEED = 0x474c4d;
+	static constexpr uint64_t EPOCHS_SEED = 0x45504f43;
+
+	// Work per task : a filter group (and as many channels of OD or epochs), a GLM right-hand side block and a Beer-Lambert sample range
+	static constexpr size_t FILTER_GRAIN = NIRS::InterleavedSOSFilter::Lanes;
+	static constexpr size_t GLM_BLOCK_CHANNELS = 32;
+	static constexpr size_t BEER_LAMBERT_RANGE = 16384;
+
+	static uint64_t hash_source(size_t channel, uint64_t revision)
+	{
+		return NIRS::HashCombine(static_cast<uint64_t>(channel) + 1, revision);
+	}
+}
+
+const char* NIRS::ProcessingStageToString(ProcessingStage stage)
+{
+	switch (stage) {
+	case ProcessingStage::OpticalDensity:   return "Optical density";
+	case ProcessingStage::MotionCorrection: return "Motion correction";
+	case ProcessingStage::Filter:           return "Filter";
+	case ProcessingStage::BeerLambert:      return "Beer-Lambert";
+	case ProcessingStage::GLM:              return "GLM";
+	case ProcessingStage::Epochs:           return "Epochs";
+	default:                                return "INVALID";
+	}
+}
+
+template<typename T>
+NIRS::ProcessingGraph<T>::ProcessingGraph(ProcessingGraphSource<T> source, const PreprocessingSpecification& spec)
+	: m_Source(std::move(source)), m_Preprocessing(spec)
+{
+	if (m_Source.Raw.size() != m_Source.Channels.size()) {
+		NVIZ_ERROR("Processing graph has {} raw rows for {} channels, it stays empty", m_Source.Raw.size(), m_Source.Channels.size());
+		m_Source.Raw.clear();
+		m_Source.Channels.clear();
+	}
+
+	size_t num_channels = m_Source.Channels.size();
+	m_RawRevisions.assign(num_channels, 1);
+	for (auto& node : m_Nodes) {
+		node.Rows.assign(num_channels, nullptr);
+		node.Hashes.assign(num_channels, 0);
+	}
+}
+
+template<typename T>
+void NIRS::ProcessingGraph<T>::SetGLM(const GLMDesignSpecification& spec, GLMSolverMethod method)
+{
+	m_GLMEnabled = true;
+	m_GLMSpecification = spec;
+	m_GLMMethod = method;
+}
+
+template<typename T>
+void NIRS::ProcessingGraph<T>::ClearGLM()
+{
+	m_GLMEnabled = false;
+	m_GLMSolver = nullptr;
+	m_GLMHash = 0;
+	m_GLMResult = {};
+	GetNode(ProcessingStage::GLM).Hashes.assign(GetNumChannels(), 0);
+}
+
+template<typename T>
+void NIRS::ProcessingGraph<T>::InvalidateChannels(const std::vector<size_t>& channels)
+{
+	for (size_t c : channels) {
+		if (c < m_RawRevisions.size()) m_RawRevisions[c]++;
+	}
+}
+
+template<typename T>
+void NIRS::ProcessingGraph<T>::PassThrough(Node& node, const Node& input)
+{
+	node.Output = {};
+	node.Rows = input.Rows;
+	node.Hashes = input.Hashes;
+}
+
+template<typename T>
+void NIRS::ProcessingGraph<T>::Allocate(Node& node, size_t numSamples)
+{
+	size_t num_channels = GetNumChannels();
+	if (node.Output.NumChannels == num_channels && node.Output.NumSamples == numSamples && node.Output.Samples.size() == num_channels * numSamples) {
+		return;
+	}
+	node.Output.NumChannels = num_channels;
+	node.Output.NumSamples = numSamples;
+	node.Output.Samples.assign(num_channels * numSamples, T(0));
+	node.Hashes.assign(num_channels, 0);
+}
+
+template<typename T>
+std::vector<size_t> NIRS::ProcessingGraph<T>::GetStale(const Node& node, const std::vector<uint64_t>& hashes) const
+{
+	std::vector<size_t> stale;
+	for (size_t c = 0; c < hashes.size(); c++) {
+		if (node.Hashes[c] != hashes[c]) stale.push_back(c);
+	}
+	return stale;
+}
+
+template<typename T>
+NIRS::ProcessingUpdate NIRS::ProcessingGraph<T>::Update(ThreadPool* pool)
+{
+	Timer timer;
+	ThreadPool& update_pool = pool ? *pool : ThreadPool::Get();
+	ProcessingUpdate update;
+
+	size_t num_channels = GetNumChannels();
+	size_t num_samples = m_Source.NumSamples;
+	double sampling_rate = m_Source.SamplingRate;
+	const auto& spec = m_Preprocessing;
+	std::vector<uint64_t> hashes(num_channels);
+	ProcessingScratchPool scratch_pool; // TDDR and filter buffers, shared by the stages of this update
+
+	// Optical density, from the raw rows
+	{
+		auto& node = GetNode(ProcessingStage::OpticalDensity);
+		uint64_t parameters = HashCombine(Utils::OPTICAL_DENSITY_SEED, static_cast<uint64_t>(spec.OpticalDensity.Baseline));
+		parameters = HashCombine(parameters, HashDouble(spec.OpticalDensity.BaselineSeconds));
+		for (size_t c = 0; c < num_channels; c++) hashes[c] = HashCombine(parameters, Utils::hash_source(c, m_RawRevisions[c]));
+
+		Allocate(node, num_samples);
+		auto stale = GetStale(node, hashes);
+		update_pool.ParallelFor(0, stale.size(), Utils::FILTER_GRAIN, [&](size_t i) {
+			size_t c = stale[i];
+			ConvertToOpticalDensity(m_Source.Raw[c], node.Output.GetChannel(c), num_samples, sampling_rate, spec.OpticalDensity);
+		});
+		for (size_t c = 0; c < num_channels; c++) node.Rows[c] = node.Output.GetChannel(c);
+		node.Hashes = hashes;
+		update.Channels[static_cast<size_t>(ProcessingStage::OpticalDensity)] = stale.size();
+	}
+
+	// Motion correction
+	{
+		auto& node = GetNode(ProcessingStage::MotionCorrection);
+		const auto& input = GetNode(ProcessingStage::OpticalDensity);
+		if (!spec.MotionCorrection) {
+			PassThrough(node, input);
+		}
+		else {
+			for (size_t c = 0; c < num_channels; c++) hashes[c] = HashCombine(Utils::MOTION_CORRECTION_SEED, input.Hashes[c]);
+
+			Allocate(node, num_samples);
+			auto stale = GetStale(node, hashes);
+			update_pool.ParallelFor(0, stale.size(), 1, [&](size_t i) {
+				size_t c = stale[i];
+				T* out = node.Output.GetChannel(c);
+				std::copy(input.Rows[c], input.Rows[c] + num_samples, out);
+				auto scratch = scratch_pool.Acquire();
+				CorrectMotionArtifactsTDDR(out, num_samples, sampling_rate, scratch.Get());
+			});
+			for (size_t c = 0; c < num_channels; c++) node.Rows[c] = node.Output.GetChannel(c);
+			node.Hashes = hashes;
+			update.Channels[static_cast<size_t>(ProcessingStage::MotionCorrection)] = stale.size();
+		}
+	}
+
+	// Band-pass, the sections are designed again only when the filter parameters change
+	{
+		auto& node = GetNode(ProcessingStage::Filter);
+		const auto& input = GetNode(ProcessingStage::MotionCorrection);
+		uint64_t parameters = HashCombine(Utils::FILTER_SEED, HashDouble(spec.LowCutoff));
+		parameters = HashCombine(parameters, HashDouble(spec.HighCutoff));
+		parameters = HashCombine(parameters, static_cast<uint64_t>(spec.FilterOrder));
+		parameters = HashCombine(parameters, HashDouble(sampling_rate));
+		if (parameters != m_SectionsHash) {
+			m_Sections = DesignBandpass(spec, static_cast<float>(sampling_rate));
+			m_SectionsHash = parameters;
+		}
+
+		if (m_Sections.empty()) {
+			PassThrough(node, input);
+		}
+		else {
+			for (size_t c = 0; c < num_channels; c++) hashes[c] = HashCombine(parameters, input.Hashes[c]);
+
+			Allocate(node, num_samples);
+			auto stale = GetStale(node, hashes);
+
+			// Stale channels are packed into filter groups, whichever rows they come from
+			size_t num_groups = (stale.size() + Utils::FILTER_GRAIN - 1) / Utils::FILTER_GRAIN;
+			update_pool.ParallelFor(0, num_groups, 1, [&](size_t g) {
+				size_t first = g * Utils::FILTER_GRAIN;
+				size_t count = std::min(Utils::FILTER_GRAIN, stale.size() - first);
+				const T* in[Utils::FILTER_GRAIN];
+				T* out[Utils::FILTER_GRAIN];
+				for (size_t i = 0; i < count; i++) {
+					in[i] = input.Rows[stale[first + i]];
+					out[i] = node.Output.GetChannel(stale[first + i]);
+				}
+				auto scratch = scratch_pool.Acquire();
+				FilterHemodynamicChannels(in, out, count, num_samples, m_Sections, scratch.Get());
+			});
+			for (size_t c = 0; c < num_channels; c++) node.Rows[c] = node.Output.GetChannel(c);
+			node.Hashes = hashes;
+			update.Channels[static_cast<size_t>(ProcessingStage::Filter)] = stale.size();
+		}
+	}
+
+	update.Channels[static_cast<size_t>(ProcessingStage::BeerLambert)] = UpdateBeerLambert(update_pool);
+	update.Channels[static_cast<size_t>(ProcessingStage::GLM)] = UpdateGLM(update_pool);
+	update.Channels[static_cast<size_t>(ProcessingStage::Epochs)] = UpdateEpochs(update_pool);
+
+	update.Seconds = timer.Elapsed();
+	return update;
+}
+
+template<typename T>
+size_t NIRS::ProcessingGraph<T>::UpdateBeerLambert(ThreadPool& pool)
+{
+	auto& node = GetNode(ProcessingStage::BeerLambert);
+	const auto& input = GetNode(ProcessingStage::Filter);
+	const auto& spec = m_Preprocessing;
+	size_t num_channels = GetNumChannels();
+	size_t num_samples = m_Source.NumSamples;
+
+	// The pairs only depend on the probe, the row scales on the DPFs
+	uint64_t converter_hash = HashCombine(Utils::BEER_LAMBERT_SEED, spec.ConvertToConcentration ? 1 : 0);
+	converter_hash = HashCombine(converter_hash, HashDouble(spec.BeerLambert.DefaultDPF));
+	for (double dpf : spec.BeerLambert.DPF) converter_hash = HashCombine(converter_hash, HashDouble(dpf));
+	if (converter_hash != m_ConverterHash) {
+		m_Converter = spec.ConvertToConcentration
+			? BeerLambertConverter(m_Source.Channels, m_Source.Wavelengths, m_Source.Sources, m_Source.Detectors, m_Source.CentimetersPerUnit, spec.BeerLambert)
+			: BeerLambertConverter();
+		m_ConverterHash = converter_hash;
+	}
+	if (m_Converter.IsEmpty()) {
+		PassThrough(node, input);
+		return 0;
+	}
+
+	// Channels outside a pair pass through, a pair's channels all carry the hash of the pair : its DPFs and every input row
+	std::vector<uint64_t> hashes = input.Hashes;
+	const auto& pairs = m_Converter.GetPairs();
+	bool per_channel_dpf = spec.BeerLambert.DPF.size() == num_channels;
+	for (const auto& pair : pairs) {
+		uint64_t hash = Utils::BEER_LAMBERT_SEED;
+		for (size_t c : pair.Channels) {
+			hash = HashCombine(hash, HashDouble(per_channel_dpf ? spec.BeerLambert.DPF[c] : spec.BeerLambert.DefaultDPF));
+			hash = HashCombine(hash, input.Hashes[c]);
+		}
+		for (size_t c : pair.Channels) hashes[c] = hash;
+	}
+
+	Allocate(node, num_samples);
+	std::vector<size_t> stale;
+	for (size_t p = 0; p < pairs.size(); p++) {
+		size_t c = pairs[p].Channels.front();
+		if (node.Hashes[c] != hashes[c]) stale.push_back(p);
+	}
+
+	// Inputs of the stale pairs are copied over and converted in place, sample ranges in parallel
+	std::vector<T*> rows(num_channels);
+	for (size_t c = 0; c < num_channels; c++) rows[c] = node.Output.GetChannel(c);
+	size_t recomputed = 0;
+	for (size_t p : stale) {
+		for (size_t c : pairs[p].Channels) {
+			std::copy(input.Rows[c], input.Rows[c] + num_samples, rows[c]);
+			recomputed++;
+		}
+	}
+	size_t num_ranges = (num_samples + Utils::BEER_LAMBERT_RANGE - 1) / Utils::BEER_LAMBERT_RANGE;
+	if (!stale.empty()) {
+		pool.ParallelFor(0, num_ranges, 1, [&](size_t r) {
+			size_t first = r * Utils::BEER_LAMBERT_RANGE;
+			m_Converter.ConvertPairs(rows.data(), stale.data(), stale.size(), first, std::min(Utils::BEER_LAMBERT_RANGE, num_samples - first));
+		});
+	}
+
+	std::vector<bool> paired(num_channels, false);
+	for (const auto& pair : pairs) {
+		for (size_t c : pair.Channels) paired[c] = true;
+	}
+	for (size_t c = 0; c < num_channels; c++) node.Rows[c] = paired[c] ? rows[c] : input.Rows[c];
+	node.Hashes = hashes;
+	return recomputed;
+}
+
+template<typename T>
+size_t NIRS::ProcessingGraph<T>::UpdateGLM(ThreadPool& pool)
+{
+	auto& node = GetNode(ProcessingStage::GLM);
+	const auto& input = GetNode(ProcessingStage::BeerLambert);
+	size_t num_channels = GetNumChannels();
+	if (!m_GLMEnabled || num_channels == 0) {
+		return 0;
+	}
+
+	const auto& spec = m_GLMSpecification;
+	uint64_t parameters = HashCombine(Utils::GLM_SEED, static_cast<uint64_t>(m_GLMMethod));
+	for (const auto& condition : spec.Conditions) {
+		parameters = HashCombine(parameters, condition.Events.size());
+		for (const auto& event : condition.Events) {
+			parameters = HashCombine(parameters, HashDouble(event.Onset));
+			parameters = HashCombine(parameters, HashDouble(event.Duration));
+			parameters = HashCombine(parameters, HashDouble(event.Amplitude));
+		}
+	}
+	parameters = HashCombine(parameters, HashDouble(spec.HRFSeconds));
+	parameters = HashCombine(parameters, static_cast<uint64_t>(spec.Drift));
+	parameters = HashCombine(parameters, static_cast<uint64_t>(spec.DriftOrder));
+	parameters = HashCombine(parameters, HashDouble(spec.DriftCutoffSeconds));
+
+	// A new design is a new factorization and a result of another shape, every channel is fitted again
+	if (parameters != m_GLMHash || !m_GLMSolver) {
+		auto design = BuildDesignMatrix(spec, m_Source.NumSamples, m_Source.SamplingRate);
+		m_GLMSolver = CreateScope<GLMSolver>(design, m_GLMMethod);
+		m_GLMHash = parameters;
+
+		constexpr double NaN = std::numeric_limits<double>::quiet_NaN();
+		size_t num_regressors = m_GLMSolver->GetNumRegressors();
+		m_GLMResult = {};
+		m_GLMResult.Regressors = design.Regressors;
+		m_GLMResult.Betas = Eigen::MatrixXd::Constant(num_regressors, num_channels, NaN);
+		m_GLMResult.TValues = Eigen::MatrixXd::Constant(num_regressors, num_channels, NaN);
+		m_GLMResult.ResidualVariance = Eigen::VectorXd::Constant(num_channels, NaN);
+		m_GLMResult.DegreesOfFreedom.assign(num_channels, 0);
+		node.Hashes.assign(num_channels, 0);
+	}
+
+	std::vector<uint64_t> hashes(num_channels);
+	for (size_t c = 0; c < num_channels; c++) hashes[c] = HashCombine(parameters, input.Hashes[c]);
+	auto stale = GetStale(node, hashes);
+	node.Hashes = hashes;
+	if (!m_GLMSolver->IsValid()) {
+		return 0;
+	}
+
+	std::vector<const T*> rows(stale.size());
+	for (size_t i = 0; i < stale.size(); i++) rows[i] = input.Rows[stale[i]];
+	size_t num_blocks = (stale.size() + Utils::GLM_BLOCK_CHANNELS - 1) / Utils::GLM_BLOCK_CHANNELS;
+	pool.ParallelFor(0, num_blocks, 1, [&](size_t b) {
+		size_t first = b * Utils::GLM_BLOCK_CHANNELS;
+		size_t count = std::min(Utils::GLM_BLOCK_CHANNELS, stale.size() - first);
+		m_GLMSolver->FitInto(rows.data() + first, stale.data() + first, count, m_GLMResult);
+	});
+	return stale.size();
+}
+
+template<typename T>
+size_t NIRS::ProcessingGraph<T>::UpdateEpochs(ThreadPool& pool)
+{
+	auto& node = GetNode(ProcessingStage::Epochs);
+	const auto& input = GetNode(ProcessingStage::BeerLambert);
+	const auto& spec = m_Epochs;
+	size_t num_channels = GetNumChannels();
+
+	if (spec.Onsets.empty()) {
+		m_EpochAverager = nullptr;
+		m_EpochsHash = 0;
+		m_EpochAverage = {};
+		node.Hashes.assign(num_channels, 0);
+		return 0;
+	}
+
+	uint64_t parameters = HashCombine(Utils::EPOCHS_SEED, HashDouble(spec.Start));
+	parameters = HashCombine(parameters, HashDouble(spec.End));
+	parameters = HashCombine(parameters, spec.BaselineCorrection ? 1 : 0);
+	for (double onset : spec.Onsets) parameters = HashCombine(parameters, HashDouble(onset));
+
+	// New windows give averages of another shape, every channel is averaged again
+	if (parameters != m_EpochsHash || !m_EpochAverager) {
+		m_EpochAverager = CreateScope<EpochAverager>(spec, m_Source.NumSamples, m_Source.SamplingRate);
+		m_EpochsHash = parameters;
+		m_EpochAverager->Allocate(m_EpochAverage, num_channels);
+		node.Hashes.assign(num_channels, 0);
+	}
+
+	std::vector<uint64_t> hashes(num_channels);
+	for (size_t c = 0; c < num_channels; c++) hashes[c] = HashCombine(parameters, input.Hashes[c]);
+	auto stale = GetStale(node, hashes);
+	node.Hashes = hashes;
+
+	std::vector<const T*> rows(stale.size());
+	for (size_t i = 0; i < stale.size(); i++) rows[i] = input.Rows[stale[i]];
+	size_t num_tasks = (stale.size() + Utils::FILTER_GRAIN - 1) / Utils::FILTER_GRAIN;
+	pool.ParallelFor(0, num_tasks, 1, [&](size_t t) {
+		size_t first = t * Utils::FILTER_GRAIN;
+		m_EpochAverager->AverageInto(rows.data() + first, stale.data() + first, std::min(Utils::FILTER_GRAIN, stale.size() - first), m_EpochAverage);
+	});
+	return stale.size();
+}
+
+template<typename T>
+const T* NIRS::ProcessingGraph<T>::GetChannel(ProcessingStage stage, size_t channel) const
+{
+	if (stage == ProcessingStage::GLM || stage == ProcessingStage::Epochs || stage >= ProcessingStage::Count || channel >= GetNumChannels()) {
+		return nullptr;
+	}
+	return m_Nodes[static_cast<size_t>(stage)].Rows[channel];
+}
+
+template class NIRS::ProcessingGraph<float>;
+template class NIRS::ProcessingGraph<double>;
@@ -0,0 +1,323 @@
+#include "pch.h"
+#include "NIRS/SNIRFLibrary.h"
+
+#include <fstream>
+#include <mutex>
+#include <cstring>
+#include <unordered_map>
+
+#include "Core/Timer.h"
+#include "Core/ThreadPool.h"
+
+namespace Utils {
+
+	static constexpr char INDEX_MAGIC[8] = { 'N', 'V', 'I', 'Z', 'I', 'D', 'X', '\0' };
+	static constexpr uint32_t INDEX_VERSION = 1;
+
+	// Smallest summary write_summary can produce : empty path and error, no probes, no blocks
+	static constexpr uint64_t MIN_SUMMARY_BYTES = 4 + 8 + 8 + 1 + 4 + 4 + 4;
+
+	// Little binary writer/reader for the index, every field is fixed size or length prefixed
+	class IndexWriter {
+	public:
+		IndexWriter(std::ofstream& file) : m_File(file) {}
+
+		template<typename T>
+		void Write(const T& value) { m_File.write(reinterpret_cast<const char*>(&value), sizeof(T)); }
+		void WriteString(const std::string& value) {
+			Write<uint32_t>(static_cast<uint32_t>(value.size()));
+			m_File.write(value.data(), value.size());
+		}
+	private:
+		std::ofstream& m_File;
+	};
+
+	class IndexReader {
+	public:
+		IndexReader(std::ifstream& file) : m_File(file) {}
+
+		template<typename T>
+		T Read() { T value{}; m_File.read(reinterpret_cast<char*>(&value), sizeof(T)); return value; }
+		std::string ReadString() {
+			uint32_t size = Read<uint32_t>();
+			if (!m_File || size > (1u << 20)) { m_File.setstate(std::ios::failbit); return {}; }
+			std::string value(size, '\0');
+			m_File.read(value.data(), size);
+			return value;
+		}
+		bool Good() const { return static_cast<bool>(m_File); }
+		uint64_t Remaining() {
+			auto position = m_File.tellg();
+			m_File.seekg(0, std::ios::end);
+			auto end = m_File.tellg();
+			m_File.seekg(position);
+			return position >= 0 && end >= position ? static_cast<uint64_t>(end - position) : 0;
+		}
+	private:
+		std::ifstream& m_File;
+	};
+
+	template<typename ProbeT>
+	void write_probes(IndexWriter& writer, const std::vector<ProbeT>& probes, int components)
+	{
+		writer.Write<uint32_t>(static_cast<uint32_t>(probes.size()));
+		for (const auto& probe : probes) {
+			for (int c = 0; c < components; c++) writer.Write<float>(probe.Position[c]);
+			writer.Write<uint32_t>(probe.ID);
+		}
+	}
+
+	template<typename ProbeT>
+	void read_probes(IndexReader& reader, std::vector<ProbeT>& probes, int components, NIRS::ProbeType type)
+	{
+		uint32_t count = reader.Read<uint32_t>();
+		if (!reader.Good() || count > (1u << 16)) return;
+		probes.resize(count);
+		for (auto& probe : probes) {
+			for (int c = 0; c < components; c++) probe.Position[c] = reader.Read<float>();
+			probe.ID = reader.Read<uint32_t>();
+			probe.Type = type;
+		}
+	}
+
+	void write_summary(IndexWriter& writer, const SNIRFSummary& summary, const std::string& relativePath)
+	{
+		writer.WriteString(relativePath);
+		writer.Write<uint64_t>(summary.FileSize);
+		writer.Write<int64_t>(summary.ModifiedTime);
+		writer.Write<uint8_t>(summary.Valid ? 1 : 0);
+		writer.WriteString(summary.Error);
+
+		writer.Write<uint32_t>(static_cast<uint32_t>(summary.Probes.size()));
+		for (const auto& probe : summary.Probes) {
+			write_probes(writer, probe.Sources2D, 2);
+			write_probes(writer, probe.Detectors2D, 2);
+			write_probes(writer, probe.Sources3D, 3);
+			write_probes(writer, probe.Detectors3D, 3);
+			writer.Write<uint32_t>(static_cast<uint32_t>(probe.Wavelengths.size()));
+			for (int wavelength : probe.Wavelengths) writer.Write<int32_t>(wavelength);
+		}
+
+		writer.Write<uint32_t>(static_cast<uint32_t>(summary.Blocks.size()));
+		for (const auto& block : summary.Blocks) {
+			writer.WriteString(block.Path);
+			writer.Write<uint64_t>(block.ProbeIndex);
+			writer.Write<uint64_t>(block.NumSamples);
+			writer.Write<uint64_t>(block.NumChannels);
+			writer.Write<double>(block.StartTime);
+			writer.Write<double>(block.EndTime);
+			writer.Write<double>(block.SamplingRate);
+		}
+	}
+
+	bool read_summary(IndexReader& reader, SNIRFSummary& summary, const std::filesystem::path& root)
+	{
+		summary.Filepath = root / std::filesystem::u8path(reader.ReadString());
+		summary.FileSize = reader.Read<uint64_t>();
+		summary.ModifiedTime = reader.Read<int64_t>();
+		summary.Valid = reader.Read<uint8_t>() != 0;
+		summary.Error = reader.ReadString();
+
+		uint32_t num_probes = reader.Read<uint32_t>();
+		if (!reader.Good() || num_probes > 1024) return false;
+		summary.Probes.resize(num_probes);
+		for (auto& probe : summary.Probes) {
+			read_probes(reader, probe.Sources2D, 2, NIRS::SOURCE);
+			read_probes(reader, probe.Detectors2D, 2, NIRS::DETECTOR);
+			read_probes(reader, probe.Sources3D, 3, NIRS::SOURCE);
+			read_probes(reader, probe.Detectors3D, 3, NIRS::DETECTOR);
+			uint32_t num_wavelengths = reader.Read<uint32_t>();
+			if (!reader.Good() || num_wavelengths > 64) return false;
+			probe.Wavelengths.resize(num_wavelengths);
+			for (auto& wavelength : probe.Wavelengths) wavelength = reader.Read<int32_t>();
+		}
+
+		uint32_t num_blocks = reader.Read<uint32_t>();
+		if (!reader.Good() || num_blocks > 4096) return false;
+		summary.Blocks.resize(num_blocks);
+		for (auto& block : summary.Blocks) {
+			block.Path = reader.ReadString();
+			block.ProbeIndex = reader.Read<uint64_t>();
+			block.NumSamples = reader.Read<uint64_t>();
+			block.NumChannels = reader.Read<uint64_t>();
+			block.StartTime = reader.Read<double>();
+			block.EndTime = reader.Read<double>();
+			block.SamplingRate = reader.Read<double>();
+		}
+		return reader.Good();
+	}
+
+	bool is_snirf_file(const std::filesystem::directory_entry& entry)
+	{
+		std::error_code error;
+		if (!entry.is_regular_file(error)) return false;
+
+		std::string extension = entry.path().extension().string();
+		std::transform(extension.begin(), extension.end(), extension.begin(), ::tolower);
+		return extension == ".snirf";
+	}
+}
+
+SNIRFLibrary::SNIRFLibrary(const std::filesystem::path& root, const std::filesystem::path& indexPath)
+	: m_Root(root), m_IndexPath(indexPath.empty() ? root / ".nvizindex" : indexPath)
+{
+}
+
+bool SNIRFLibrary::LoadIndex()
+{
+	m_Entries.clear();
+
+	std::ifstream file(m_IndexPath, std::ios::binary);
+	if (!file) {
+		return false;
+	}
+
+	Utils::IndexReader reader(file);
+	char magic[8] = {};
+	file.read(magic, sizeof(magic));
+	uint32_t version = reader.Read<uint32_t>();
+	if (!reader.Good() || std::memcmp(magic, Utils::INDEX_MAGIC, sizeof(magic)) != 0 || version != Utils::INDEX_VERSION) {
+		NVIZ_WARN("Ignoring library index with unknown format : {}", m_IndexPath.string());
+		return false;
+	}
+
+	// The count comes off disk, a truncated or corrupt index must not size an allocation
+	uint64_t count = reader.Read<uint64_t>();
+	if (!reader.Good() || count > reader.Remaining() / Utils::MIN_SUMMARY_BYTES) {
+		NVIZ_WARN("Library index is corrupt : {}", m_IndexPath.string());
+		return false;
+	}
+
+	std::vector<SNIRFSummary> entries(count);
+	for (auto& entry : entries) {
+		if (!Utils::read_summary(reader, entry, m_Root)) {
+			NVIZ_WARN("Library index is corrupt : {}", m_IndexPath.string());
+			return false;
+		}
+	}
+
+	m_Entries = std::move(entries);
+	return true;
+}
+
+bool SNIRFLibrary::SaveIndex() const
+{
+	std::filesystem::path temporary = m_IndexPath;
+	temporary += ".tmp";
+	{
+		std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+		if (!file) {
+			NVIZ_ERROR("Cannot write library index {}", m_IndexPath.string());
+			return false;
+		}
+
+		Utils::IndexWriter writer(file);
+		file.write(Utils::INDEX_MAGIC, sizeof(Utils::INDEX_MAGIC));
+		writer.Write<uint32_t>(Utils::INDEX_VERSION);
+		writer.Write<uint64_t>(m_Entries.size());
+		for (const auto& entry : m_Entries) {
+			Utils::write_summary(writer, entry, entry.Filepath.lexically_relative(m_Root).generic_u8string());
+		}
+
+		if (!file) {
+			NVIZ_ERROR("Failed writing library index {}", m_IndexPath.string());
+			return false;
+		}
+	}
+
+	std::error_code error;
+	std::filesystem::rename(temporary, m_IndexPath, error);
+	if (error) {
+		NVIZ_ERROR("Failed to move library index into place {} : {}", m_IndexPath.string(), error.message());
+		std::filesystem::remove(temporary, error);
+		return false;
+	}
+	return true;
+}
+
+SNIRFLibraryScanStats SNIRFLibrary::Scan(bool recursive, ThreadPool* pool, const std::function<void(size_t done, size_t total)>& onProgress)
+{
+	Timer timer;
+	SNIRFLibraryScanStats stats;
+	ThreadPool& scan_pool = pool ? *pool : ThreadPool::Get();
+
+	std::vector<std::filesystem::path> files;
+	{
+		std::error_code error;
+		auto options = std::filesystem::directory_options::skip_permission_denied;
+		if (recursive) {
+			for (const auto& entry : std::filesystem::recursive_directory_iterator(m_Root, options, error)) {
+				if (Utils::is_snirf_file(entry)) files.push_back(entry.path());
+			}
+		}
+		else {
+			for (const auto& entry : std::filesystem::directory_iterator(m_Root, options, error)) {
+				if (Utils::is_snirf_file(entry)) files.push_back(entry.path());
+			}
+		}
+		if (error) {
+			NVIZ_ERROR("Failed to scan {} : {}", m_Root.string(), error.message());
+		}
+	}
+	std::sort(files.begin(), files.end());
+	stats.Files = files.size();
+
+	std::unordered_map<std::string, const SNIRFSummary*> previous;
+	for (const auto& entry : m_Entries) {
+		previous[entry.Filepath.lexically_normal().string()] = &entry;
+	}
+
+	// Stat every file against the index, on shared storage the round trips add up so this runs on the pool too
+	std::vector<SNIRFSummary> entries(files.size());
+	std::vector<char> needs_probe(files.size(), 1);
+	scan_pool.ParallelFor(0, files.size(), 16, [&](size_t i) {
+		auto it = previous.find(files[i].lexically_normal().string());
+		if (it == previous.end()) {
+			return;
+		}
+
+		std::error_code error;
+		uintmax_t size = std::filesystem::file_size(files[i], error);
+		int64_t modified = static_cast<int64_t>(std::filesystem::last_write_time(files[i], error).time_since_epoch().count());
+		if (!error && size == it->second->FileSize && modified == it->second->ModifiedTime) {
+			entries[i] = *it->second;
+			needs_probe[i] = 0;
+		}
+	});
+
+	std::vector<size_t> to_probe;
+	for (size_t i = 0; i < files.size(); i++) {
+		if (needs_probe[i]) to_probe.push_back(i);
+	}
+
+	// Probes run concurrently, progress is reported under a lock so the callback never has to be thread safe
+	std::mutex progress_mutex;
+	size_t probed = 0;
+	scan_pool.ParallelFor(0, to_probe.size(), 1, [&](size_t i) {
+		entries[to_probe[i]] = SNIRF::Probe(files[to_probe[i]]);
+
+		std::lock_guard<std::mutex> lock(progress_mutex);
+		probed++;
+		if (onProgress) onProgress(probed, to_probe.size());
+	});
+
+	size_t still_present = 0;
+	for (const auto& entry : entries) {
+		if (!entry.Valid) {
+			stats.Failed++;
+		}
+		if (previous.count(entry.Filepath.lexically_normal().string())) {
+			still_present++;
+		}
+	}
+
+	stats.Probed = to_probe.size();
+	stats.Reused = files.size() - to_probe.size();
+	stats.Removed = m_Entries.size() - std::min(m_Entries.size(), still_present);
+	stats.Seconds = timer.Elapsed();
+
+	m_Entries = std::move(entries);
+	NVIZ_INFO("Scanned {} : {} files, {} probed, {} from the index, {} removed, {} failed in {:.2f} s",
+		m_Root.string(), stats.Files, stats.Probed, stats.Reused, stats.Removed, stats.Failed, stats.Seconds);
+	return stats;
+}
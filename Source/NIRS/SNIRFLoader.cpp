@@ -0,0 +1,98 @@
+#include "pch.h"
+#include "NIRS/SNIRFLoader.h"
+
+#include <cmath>
+
+#include "Core/ThreadPool.h"
+#include "Core/Timer.h"
+
+SNIRFLoader& SNIRFLoader::Get()
+{
+	static SNIRFLoader instance;
+	return instance;
+}
+
+SNIRFLoadID SNIRFLoader::LoadAsync(const std::filesystem::path& filepath, const SNIRFLoadSpecification& spec)
+{
+	SNIRFLoadID id = m_NextLoadID++;
+	auto cancelToken = CreateRef<std::atomic<bool>>(false);
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		m_ActiveLoads[id] = cancelToken;
+	}
+
+	NVIZ_INFO("Loading {} in the background (load {})", filepath.string(), id);
+	ThreadPool::Get().Submit([this, id, filepath, spec, cancelToken]() {
+		RunLoad(id, filepath, spec, cancelToken);
+	});
+	return id;
+}
+
+void SNIRFLoader::Cancel(SNIRFLoadID id)
+{
+	std::lock_guard<std::mutex> lock(m_Mutex);
+	auto it = m_ActiveLoads.find(id);
+	if (it != m_ActiveLoads.end()) {
+		it->second->store(true);
+	}
+}
+
+void SNIRFLoader::CancelAll()
+{
+	std::lock_guard<std::mutex> lock(m_Mutex);
+	for (auto& [id, token] : m_ActiveLoads) {
+		token->store(true);
+	}
+}
+
+bool SNIRFLoader::IsLoading()
+{
+	std::lock_guard<std::mutex> lock(m_Mutex);
+	return !m_ActiveLoads.empty();
+}
+
+void SNIRFLoader::RunLoad(SNIRFLoadID id, std::filesystem::path filepath, SNIRFLoadSpecification spec, Ref<std::atomic<bool>> cancelToken)
+{
+	Timer timer;
+	std::string path = filepath.string();
+
+	// Only post when the percentage changes, the signal read reports once per row block.
+	// Everything is captured by value, the hook is copied into the SNIRF
+	auto lastPercent = CreateRef<std::atomic<int>>(-1);
+	auto userProgress = spec.OnProgress;
+	spec.OnProgress = [id, path, lastPercent, userProgress](float progress, const std::string& stage) {
+		if (userProgress) userProgress(progress, stage);
+
+		int percent = static_cast<int>(std::floor(progress * 100.0f));
+		if (lastPercent->exchange(percent) == percent) return;
+
+		EventBus::Instance().Post(SNIRFFileLoadProgressEvent{ id, path, stage, progress });
+	};
+	spec.CancelToken = cancelToken.get(); // Cleared by LoadFile before it returns
+
+	auto snirf = CreateRef<SNIRF>();
+	bool loaded = false;
+	std::string error = "";
+	try {
+		loaded = snirf->LoadFile(filepath, spec);
+		if (!loaded && !cancelToken->load()) {
+			error = "Could not load file";
+		}
+	}
+	catch (const std::exception& e) {
+		error = e.what();
+		NVIZ_ERROR("Failed to load {} : {}", path, error);
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		m_ActiveLoads.erase(id);
+	}
+
+	if (loaded) {
+		EventBus::Instance().Post(SNIRFFileLoadedEvent{ id, snirf, timer.Elapsed() });
+	}
+	else {
+		EventBus::Instance().Post(SNIRFFileLoadFailedEvent{ id, path, error, cancelToken->load() });
+	}
+}
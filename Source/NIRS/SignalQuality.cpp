@@ -0,0 +1,327 @@
+#include "pch.h"
+#include "NIRS/SignalQuality.h"
+
+#include <cmath>
+#include <limits>
+#include <map>
+#include <algorithm>
+
+#include "Core/ThreadPool.h"
+#include "NIRS/FilterDesign.h"
+#include "NIRS/Processing.h"
+
+namespace Utils {
+
+	static constexpr float NaN = std::numeric_limits<float>::quiet_NaN();
+
+	// Pairs are band-passed together, two rows each in one InterleavedSOSFilter group
+	static constexpr size_t PAIRS_PER_TASK = NIRS::InterleavedSOSFilter::Lanes / 2;
+
+	struct QualityPair {
+		size_t First = 0;  // Channel table rows, the lower wavelength index first
+		size_t Second = 0;
+	};
+
+	// Rows with the same source and detector, paired by their two lowest wavelength indices. Rows left over have no partner
+	void find_wavelength_pairs(const std::vector<NIRS::Channel>& table, std::vector<QualityPair>& pairs, std::vector<size_t>& unpaired)
+	{
+		std::map<std::pair<NIRS::ProbeID, NIRS::ProbeID>, std::vector<size_t>> optodes;
+		for (size_t c = 0; c < table.size(); c++) {
+			optodes[{ table[c].SourceID, table[c].DetectorID }].push_back(c);
+		}
+		for (auto& [key, rows] : optodes) {
+			std::stable_sort(rows.begin(), rows.end(), [&](size_t a, size_t b) { return table[a].Wavelength < table[b].Wavelength; });
+			size_t used = 0;
+			if (rows.size() >= 2 && table[rows[0]].Wavelength != table[rows[1]].Wavelength) {
+				pairs.push_back({ rows[0], rows[1] });
+				used = 2;
+			}
+			for (size_t i = used; i < rows.size(); i++) unpaired.push_back(rows[i]);
+		}
+		std::sort(unpaired.begin(), unpaired.end());
+	}
+
+	// Running sums of raw intensity, shifted by the first sample so the window variance does not cancel
+	struct IntensityWindow {
+		double Reference = 0.0;
+		double Sum = 0.0;
+		double Squares = 0.0;
+
+		void Add(double x) { x -= Reference; Sum += x; Squares += x * x; }
+		void Remove(double x) { x -= Reference; Sum -= x; Squares -= x * x; }
+
+		float GetCV(double count) const {
+			double mean = Sum / count;
+			double variance = std::max(Squares / count - mean * mean, 0.0);
+			return static_cast<float>(std::sqrt(variance) / (Reference + mean));
+		}
+	};
+
+	// X(w) = sum_j x[s + j] e^(-i w j) over the window at every bin, slid a sample at a time :
+	// X <- e^(i w) (X - x[s] + x[s + W] e^(-i w W)). Bins are pi / W apart, so e^(-i w W) is +-1
+	// and a Hann window is the combination 0.5 X(m) - 0.25 X(m - 2) - 0.25 X(m + 2) of neighbouring bins
+	struct SlidingSpectrum {
+		std::vector<double> Real = {};
+		std::vector<double> Imaginary = {};
+
+		void Reset(size_t numBins) {
+			Real.assign(numBins, 0.0);
+			Imaginary.assign(numBins, 0.0);
+		}
+		void Slide(double in, double out, const double* cosines, const double* sines, const double* signs) {
+			size_t num_bins = Real.size();
+			double* re = Real.data();
+			double* im = Imaginary.data();
+			for (size_t k = 0; k < num_bins; k++) {
+				double a = re[k] - out + in * signs[k];
+				double b = im[k];
+				re[k] = a * cosines[k] - b * sines[k];
+				im[k] = a * sines[k] + b * cosines[k];
+			}
+		}
+		double GetHannReal(size_t k) const { return 0.5 * Real[k] - 0.25 * (Real[k - 2] + Real[k + 2]); }
+		double GetHannImaginary(size_t k) const { return 0.5 * Imaginary[k] - 0.25 * (Imaginary[k - 2] + Imaginary[k + 2]); }
+	};
+
+	// Bins of the sliding DFT, m * pi / W for m in [FirstBin - 2, LastBin + 2]
+	struct CardiacBins {
+		int64_t FirstBin = 0;
+		int64_t LastBin = -1;
+		std::vector<double> Cosines = {}; // e^(i w), per bin
+		std::vector<double> Sines = {};
+		std::vector<double> Signs = {};   // e^(-i w W)
+		std::vector<std::vector<double>> FirstCosines = {}; // e^(-i w j) for j < W, to fill the first window
+		std::vector<std::vector<double>> FirstSines = {};
+
+		size_t GetNumBins() const { return static_cast<size_t>(LastBin - FirstBin + 5); }
+		bool IsEmpty() const { return LastBin < FirstBin; }
+	};
+
+	CardiacBins make_cardiac_bins(const NIRS::SignalQualitySpecification& spec, size_t windowSamples, double samplingRate)
+	{
+		constexpr double PI = 3.14159265358979323846;
+		double resolution = samplingRate / (2.0 * static_cast<double>(windowSamples)); // Hz between bins
+		CardiacBins bins;
+		bins.FirstBin = std::max<int64_t>(static_cast<int64_t>(std::ceil(spec.CardiacLow / resolution)), 1);
+		bins.LastBin = static_cast<int64_t>(std::floor(std::min(spec.CardiacHigh, 0.5 * samplingRate) / resolution));
+		if (bins.IsEmpty()) {
+			return bins;
+		}
+
+		size_t num_bins = bins.GetNumBins();
+		bins.Cosines.resize(num_bins);
+		bins.Sines.resize(num_bins);
+		bins.Signs.resize(num_bins);
+		bins.FirstCosines.assign(num_bins, std::vector<double>(windowSamples));
+		bins.FirstSines.assign(num_bins, std::vector<double>(windowSamples));
+		for (size_t k = 0; k < num_bins; k++) {
+			int64_t m = bins.FirstBin - 2 + static_cast<int64_t>(k);
+			double w = PI * static_cast<double>(m) / static_cast<double>(windowSamples);
+			bins.Cosines[k] = std::cos(w);
+			bins.Sines[k] = std::sin(w);
+			bins.Signs[k] = (m % 2 == 0) ? 1.0 : -1.0;
+			for (size_t j = 0; j < windowSamples; j++) {
+				bins.FirstCosines[k][j] = std::cos(w * static_cast<double>(j));
+				bins.FirstSines[k][j] = -std::sin(w * static_cast<double>(j));
+			}
+		}
+		return bins;
+	}
+
+	// One forward pass over a pair : raw rows for CV, cardiac band rows for SCI and PSP. Writes row first and second of quality
+	template<typename T>
+	void pair_quality(const T* rawFirst, const T* rawSecond, const double* x, const double* y, const CardiacBins& bins,
+		NIRS::SignalQuality& quality, size_t first, size_t second)
+	{
+		size_t window = quality.WindowSamples;
+		size_t step = quality.StepSamples;
+		double count = static_cast<double>(window);
+
+		IntensityWindow intensity[2] = { { static_cast<double>(rawFirst[0]) }, { static_cast<double>(rawSecond[0]) } };
+		double sx = 0.0, sy = 0.0, sxx = 0.0, syy = 0.0, sxy = 0.0;
+		SlidingSpectrum spectra[2];
+		spectra[0].Reset(bins.GetNumBins());
+		spectra[1].Reset(bins.GetNumBins());
+
+		for (size_t j = 0; j < window; j++) {
+			intensity[0].Add(static_cast<double>(rawFirst[j]));
+			intensity[1].Add(static_cast<double>(rawSecond[j]));
+			sx += x[j]; sy += y[j];
+			sxx += x[j] * x[j]; syy += y[j] * y[j]; sxy += x[j] * y[j];
+			for (size_t k = 0; k < bins.GetNumBins(); k++) {
+				spectra[0].Real[k] += x[j] * bins.FirstCosines[k][j];
+				spectra[0].Imaginary[k] += x[j] * bins.FirstSines[k][j];
+				spectra[1].Real[k] += y[j] * bins.FirstCosines[k][j];
+				spectra[1].Imaginary[k] += y[j] * bins.FirstSines[k][j];
+			}
+		}
+
+		// Hann window sum is W / 2, a unit variance sinusoid then peaks at 0.5
+		double spectrum_scale = 4.0 / (count * count);
+		for (size_t w = 0, start = 0; w < quality.NumWindows; w++) {
+			// Slide the sums from the previous window start to this one
+			for (; start < w * step; start++) {
+				size_t in = start + window;
+				intensity[0].Add(static_cast<double>(rawFirst[in]));
+				intensity[0].Remove(static_cast<double>(rawFirst[start]));
+				intensity[1].Add(static_cast<double>(rawSecond[in]));
+				intensity[1].Remove(static_cast<double>(rawSecond[start]));
+				sx += x[in] - x[start];
+				sy += y[in] - y[start];
+				sxx += x[in] * x[in] - x[start] * x[start];
+				syy += y[in] * y[in] - y[start] * y[start];
+				sxy += x[in] * y[in] - x[start] * y[start];
+				spectra[0].Slide(x[in], x[start], bins.Cosines.data(), bins.Sines.data(), bins.Signs.data());
+				spectra[1].Slide(y[in], y[start], bins.Cosines.data(), bins.Sines.data(), bins.Signs.data());
+			}
+
+			double vx = std::max(sxx - sx * sx / count, 0.0);
+			double vy = std::max(syy - sy * sy / count, 0.0);
+			double deviations = std::sqrt(vx * vy);
+			float sci = deviations > 0.0 ? static_cast<float>((sxy - sx * sy / count) / deviations) : NaN;
+
+			float psp = NaN;
+			if (deviations > 0.0 && !bins.IsEmpty()) {
+				double peak = -std::numeric_limits<double>::infinity();
+				for (size_t k = 2; k + 2 < bins.GetNumBins(); k++) {
+					double power = spectra[0].GetHannReal(k) * spectra[1].GetHannReal(k) + spectra[0].GetHannImaginary(k) * spectra[1].GetHannImaginary(k);
+					peak = std::max(peak, power);
+				}
+				psp = static_cast<float>(peak * spectrum_scale / (deviations / count));
+			}
+
+			size_t rows[2] = { first, second };
+			for (size_t i = 0; i < 2; i++) {
+				size_t index = rows[i] * quality.NumWindows + w;
+				quality.SCI[index] = sci;
+				quality.PSP[index] = psp;
+				quality.CV[index] = intensity[i].GetCV(count);
+			}
+		}
+	}
+
+	template<typename T>
+	void channel_cv(const T* raw, NIRS::SignalQuality& quality, size_t row)
+	{
+		size_t window = quality.WindowSamples;
+		IntensityWindow intensity = { static_cast<double>(raw[0]) };
+		for (size_t j = 0; j < window; j++) intensity.Add(static_cast<double>(raw[j]));
+		for (size_t w = 0, start = 0; w < quality.NumWindows; w++) {
+			for (; start < w * quality.StepSamples; start++) {
+				intensity.Add(static_cast<double>(raw[start + window]));
+				intensity.Remove(static_cast<double>(raw[start]));
+			}
+			quality.CV[row * quality.NumWindows + w] = intensity.GetCV(static_cast<double>(window));
+		}
+	}
+}
+
+template<typename T>
+NIRS::SignalQuality NIRS::ComputeSignalQuality(const T* const* channels, const std::vector<Channel>& table, size_t numSamples,
+	double samplingRate, const SignalQualitySpecification& spec, ThreadPool* pool)
+{
+	SignalQuality quality;
+	if (table.empty() || numSamples < 2 || !(samplingRate > 0.0)) {
+		return quality;
+	}
+
+	quality.NumChannels = table.size();
+	quality.WindowSamples = std::clamp<size_t>(static_cast<size_t>(std::round(spec.WindowSeconds * samplingRate)), 2, numSamples);
+	quality.StepSamples = std::max<size_t>(static_cast<size_t>(std::round(spec.StepSeconds * samplingRate)), 1);
+	quality.NumWindows = (numSamples - quality.WindowSamples) / quality.StepSamples + 1;
+
+	size_t num_values = quality.NumChannels * quality.NumWindows;
+	quality.SCI.assign(num_values, Utils::NaN);
+	quality.PSP.assign(num_values, Utils::NaN);
+	quality.CV.assign(num_values, Utils::NaN);
+	quality.Flags.assign(num_values, QualityGood);
+
+	std::vector<Utils::QualityPair> pairs;
+	std::vector<size_t> unpaired;
+	Utils::find_wavelength_pairs(table, pairs, unpaired);
+
+	FilterSpecification filter_spec;
+	filter_spec.Family = FilterFamily::Butterworth;
+	filter_spec.Type = FilterType::Bandpass;
+	filter_spec.Order = spec.FilterOrder;
+	filter_spec.LowCutoff = spec.CardiacLow;
+	filter_spec.HighCutoff = std::min(spec.CardiacHigh, 0.45 * samplingRate); // Slow systems still get the lower end of the band
+	auto sections = DesignFilter(filter_spec, samplingRate);
+	auto bins = Utils::make_cardiac_bins(spec, quality.WindowSamples, samplingRate);
+	if (sections.empty() || bins.IsEmpty()) {
+		NVIZ_WARN("Cardiac band [{}, {}] Hz does not fit {} Hz sampling, only CV is computed", spec.CardiacLow, spec.CardiacHigh, samplingRate);
+		for (const auto& pair : pairs) {
+			unpaired.push_back(pair.First);
+			unpaired.push_back(pair.Second);
+		}
+		pairs.clear();
+	}
+
+	ThreadPool& quality_pool = pool ? *pool : ThreadPool::Get();
+	size_t num_tasks = (pairs.size() + Utils::PAIRS_PER_TASK - 1) / Utils::PAIRS_PER_TASK;
+	ProcessingScratchPool scratch_pool;
+	quality_pool.ParallelFor(0, num_tasks, 1, [&](size_t t) {
+		size_t first_pair = t * Utils::PAIRS_PER_TASK;
+		size_t num_pairs = std::min(Utils::PAIRS_PER_TASK, pairs.size() - first_pair);
+
+		// Both wavelengths of every pair of the task, in double for the filter
+		std::vector<double> band(2 * num_pairs * numSamples);
+		std::vector<double*> rows(2 * num_pairs);
+		for (size_t p = 0; p < num_pairs; p++) {
+			const auto& pair = pairs[first_pair + p];
+			size_t channel_rows[2] = { pair.First, pair.Second };
+			for (size_t i = 0; i < 2; i++) {
+				rows[2 * p + i] = band.data() + (2 * p + i) * numSamples;
+				std::copy(channels[channel_rows[i]], channels[channel_rows[i]] + numSamples, rows[2 * p + i]);
+			}
+		}
+		auto scratch = scratch_pool.Acquire();
+		FilterHemodynamicChannels<double>(rows.data(), rows.data(), rows.size(), numSamples, sections, scratch.Get());
+
+		for (size_t p = 0; p < num_pairs; p++) {
+			const auto& pair = pairs[first_pair + p];
+			Utils::pair_quality(channels[pair.First], channels[pair.Second], rows[2 * p], rows[2 * p + 1], bins,
+				quality, pair.First, pair.Second);
+		}
+	});
+	quality_pool.ParallelFor(0, unpaired.size(), 16, [&](size_t i) {
+		Utils::channel_cv(channels[unpaired[i]], quality, unpaired[i]);
+	});
+
+	// A pair without a pulse in either wavelength has no SCI, which counts as a bad window like a low one
+	std::vector<uint8_t> paired(quality.NumChannels, 0);
+	for (const auto& pair : pairs) paired[pair.First] = paired[pair.Second] = 1;
+
+	quality.GoodFraction.assign(quality.NumChannels, 0.0f);
+	quality.BadChannels.assign(quality.NumChannels, 0);
+	for (size_t c = 0; c < quality.NumChannels; c++) {
+		size_t good = 0;
+		for (size_t w = 0; w < quality.NumWindows; w++) {
+			size_t index = c * quality.NumWindows + w;
+			uint8_t flags = QualityGood;
+			if (paired[c] && !(quality.SCI[index] >= spec.MinSCI)) flags |= QualityLowSCI;
+			if (paired[c] && !(quality.PSP[index] >= spec.MinPSP)) flags |= QualityLowPSP;
+			if (!(quality.CV[index] <= spec.MaxCV)) flags |= QualityHighCV;
+			quality.Flags[index] = flags;
+			good += flags == QualityGood;
+		}
+		quality.GoodFraction[c] = static_cast<float>(good) / static_cast<float>(quality.NumWindows);
+		quality.BadChannels[c] = quality.GoodFraction[c] < spec.MinGoodWindows;
+	}
+	return quality;
+}
+
+std::vector<NIRS::Channel> NIRS::GetGoodChannels(const std::vector<Channel>& table, const SignalQuality& quality)
+{
+	if (quality.BadChannels.size() != table.size()) {
+		return table;
+	}
+	std::vector<Channel> good;
+	for (size_t c = 0; c < table.size(); c++) {
+		if (!quality.IsBad(c)) good.push_back(table[c]);
+	}
+	return good;
+}
+
+template NIRS::SignalQuality NIRS::ComputeSignalQuality<float>(const float* const*, const std::vector<Channel>&, size_t, double, const SignalQualitySpecification&, ThreadPool*);
+template NIRS::SignalQuality NIRS::ComputeSignalQuality<double>(const double* const*, const std::vector<Channel>&, size_t, double, const SignalQualitySpecification&, ThreadPool*);
@@ -1,6 +1,12 @@
 #include "pch.h"
 #include "NIRS/Snirf.h"
 #include "NIRS/Processing.h"
+#include "NIRS/MeasurementList.h"
+#include "NIRS/HDF5Lock.h"
+#include "NIRS/ProcessedDataCache.h"
+
+#include "Core/Timer.h"
+#include "Core/ThreadPool.h"
 
 #include <HighFive/H5File.hpp>
 #include <highfive/H5DataSet.hpp>
@@ -15,6 +21,9 @@ namespace Utils {
     using namespace HighFive;
     using namespace NIRS;
 
+    // measurementList dataType of continuous wave amplitude, the raw intensity MBLL applies to
+    static constexpr int DATA_TYPE_CW_AMPLITUDE = 1;
+
     std::string ProbeTypeToString(ProbeType type) {
         switch (type) {
         case SOURCE: return "SOURCE";
@@ -105,6 +114,115 @@ namespace Utils {
         }
     }
 
+    // Reads rows [firstSample, firstSample + numSamples) of a (time x channel) dataset for the given
+    // sorted, 0-indexed columns. Contiguous column runs are merged into a single hyperslab each so
+    // HDF5 only decodes the chunks that intersect the window. Output is sample-major (numSamples x columns)
+    void read_hyperslab(const DataSet& dataset, size_t firstSample, size_t numSamples,
+        const std::vector<size_t>& columns, std::vector<double>& out)
+    {
+        out.resize(numSamples * columns.size());
+        if (out.empty()) return;
+
+        HyperSlab slab;
+        size_t i = 0;
+        while (i < columns.size()) {
+            size_t j = i + 1;
+            while (j < columns.size() && columns[j] == columns[j - 1] + 1) j++;
+
+            slab |= RegularHyperSlab({ firstSample, columns[i] }, { numSamples, j - i });
+            i = j;
+        }
+        dataset.select(slab).read_raw<double>(out.data());
+    }
+
+    // Transposes a row-major (rows x cols) block into dst, where column c lands at dst[c * dstStride + row].
+    // Done in tiles so both the reads and the strided writes stay in cache
+    template<typename T>
+    void transpose_blocked(const T* src, size_t rows, size_t cols, T* dst, size_t dstStride)
+    {
+        constexpr size_t TILE = 32;
+        for (size_t r0 = 0; r0 < rows; r0 += TILE) {
+            size_t r1 = std::min(r0 + TILE, rows);
+            for (size_t c0 = 0; c0 < cols; c0 += TILE) {
+                size_t c1 = std::min(c0 + TILE, cols);
+                for (size_t c = c0; c < c1; c++) {
+                    T* out = dst + c * dstStride;
+                    for (size_t r = r0; r < r1; r++) {
+                        out[r] = src[r * cols + c];
+                    }
+                }
+            }
+        }
+    }
+
+    // Number of time rows per chunk of a chunked (time x channel) dataset, 0 for contiguous layouts
+    size_t get_chunk_rows(const DataSet& dataset)
+    {
+        size_t rows = 0;
+        hid_t plist = H5Dget_create_plist(dataset.getId());
+        if (plist < 0) return 0;
+        if (H5Pget_layout(plist) == H5D_CHUNKED) {
+            hsize_t chunk_dims[2] = { 0, 0 };
+            if (H5Pget_chunk(plist, 2, chunk_dims) == 2) {
+                rows = static_cast<size_t>(chunk_dims[0]);
+            }
+        }
+        H5Pclose(plist);
+        return rows;
+    }
+
+    // Names of the child groups called prefix{i} (nirs1, data2, ...) ordered by i. A bare prefix counts as index 1
+    std::vector<std::string> get_indexed_names(const Group& group, const std::string& prefix)
+    {
+        std::vector<std::pair<long, std::string>> indexed;
+        for (const auto& name : group.listObjectNames()) {
+            if (name.compare(0, prefix.size(), prefix) != 0) continue;
+
+            std::string suffix = name.substr(prefix.size());
+            if (!std::all_of(suffix.begin(), suffix.end(), ::isdigit)) continue;
+            if (group.getObjectType(name) != ObjectType::Group) continue;
+
+            indexed.push_back({ suffix.empty() ? 1 : std::stol(suffix), name });
+        }
+        std::sort(indexed.begin(), indexed.end());
+
+        std::vector<std::string> names;
+        for (auto& [index, name] : indexed) names.push_back(name);
+        return names;
+    }
+
+    // One element of a 1D (or N x 1) dataset, without reading the rest of it
+    double read_element(const DataSet& dataset, size_t index)
+    {
+        size_t rank = dataset.getDimensions().size();
+        std::vector<size_t> offset(rank, 0);
+        std::vector<size_t> count(rank, 1);
+        offset[0] = index;
+
+        double value = 0.0;
+        dataset.select(offset, count).read_raw<double>(&value);
+        return value;
+    }
+
+    // Scale from metaDataTags/LengthUnit to cm, probe positions are assumed to be mm when it is missing or unknown
+    double get_centimeters_per_unit(const Group& metadata)
+    {
+        std::string unit;
+        try {
+            if (!metadata.exist("LengthUnit")) return 0.1;
+            metadata.getDataSet("LengthUnit").read(unit);
+        }
+        catch (const Exception& e) {
+            NVIZ_WARN("Failed to read LengthUnit: {}", e.what());
+            return 0.1;
+        }
+        if (unit == "mm") return 0.1;
+        if (unit == "cm") return 1.0;
+        if (unit == "m")  return 100.0;
+        NVIZ_WARN("Unknown LengthUnit '{}', assuming mm", unit);
+        return 0.1;
+    }
+
     // Main parsing function
     File ParseHDF5(const std::string& filepath) {
         // Open the file in read-only mode
@@ -120,17 +238,78 @@ namespace Utils {
 
         return file;
     }
+
+    // Fingerprint of everything the preprocessed samples depend on : probe geometry, channel tables, time bases and
+    // the raw samples, given as one digest per block of dataTimeSeries as it was read. Keys the processed data cache,
+    // the samples are hashed while they are decoded so a cold load reads the file once
+    uint64_t hash_recording(const std::vector<SNIRFProbe>& probes, const std::vector<SNIRFDataBlock>& blocks, const std::vector<uint64_t>& sampleHashes)
+    {
+        NIRS::ContentHasher hasher;
+        auto update = [&](const auto& value) { hasher.Update(&value, sizeof(value)); };
+        auto update_positions = [&](const std::vector<Probe3D>& optodes) {
+            update(optodes.size());
+            for (const auto& optode : optodes) {
+                update(optode.Position.x);
+                update(optode.Position.y);
+                update(optode.Position.z);
+            }
+        };
+
+        update(probes.size());
+        for (const auto& probe : probes) {
+            update(probe.CentimetersPerUnit);
+            update(probe.FileWavelengths.size());
+            for (int wavelength : probe.FileWavelengths) update(wavelength);
+            update_positions(probe.Sources3D);
+            update_positions(probe.Detectors3D);
+        }
+
+        update(blocks.size());
+        for (size_t b = 0; b < blocks.size(); b++) {
+            const auto& block = blocks[b];
+            update(block.ProbeIndex);
+            update(block.NumSamples);
+            update(block.NumChannels);
+            update(block.DataType);
+            update(block.Channels.size());
+            for (const auto& channel : block.Channels) {
+                update(channel.ID);
+                update(channel.SourceID);
+                update(channel.DetectorID);
+                update(channel.Wavelength);
+            }
+
+            update(block.Time.GetStartTime());
+            update(block.Time.GetInterval());
+            if (!block.Time.IsUniform()) {
+                for (size_t i = 0; i < block.Time.GetCount(); i++) update(block.Time.GetTime(i));
+            }
+            update(sampleHashes[b]);
+        }
+        return hasher.Digest();
+    }
 }
 
-ChannelDataRegistry* ChannelDataRegistry::s_Instance = nullptr;
+std::recursive_mutex& NIRS::GetHDF5Mutex()
+{
+    static std::recursive_mutex mutex;
+    return mutex;
+}
 
 SNIRF::SNIRF()
 {
 }
 
-SNIRF::SNIRF(const std::filesystem::path& filepath)
+SNIRF::SNIRF(const std::filesystem::path& filepath, const SNIRFLoadSpecification& spec)
 {
-	LoadFile(filepath);
+	LoadFile(filepath, spec);
+}
+
+SNIRF::~SNIRF()
+{
+    // Closing the file is an HDF5 call as well
+    NIRS::HDF5Lock lock(NIRS::GetHDF5Mutex());
+    m_File.reset();
 }
 
 
@@ -138,9 +317,13 @@ SNIRF::SNIRF(const std::filesystem::path& filepath)
 void SNIRF::Print()
 {
     NVIZ_INFO("SNIRF File       : {}", m_Filepath.string());
-	NVIZ_INFO("Sample Rate : {} Hz", m_SamplingRate);
-    NVIZ_INFO("     Sources     : {}", m_Sources2D.size());
-    NVIZ_INFO("     Detectors   : {}", m_Detectors2D.size());
+    for (size_t p = 0; p < m_Probes.size(); p++) {
+        const auto& probe = m_Probes[p];
+        NVIZ_INFO("Probe {} : {} sources, {} detectors", p, probe.Sources2D.size(), probe.Detectors2D.size());
+        if (probe.Wavelengths.size() >= 2) {
+            NVIZ_INFO("     Wavelengths : {}, {}", probe.Wavelengths[0], probe.Wavelengths[1]);
+        }
+    }
 
     //NVIZ_INFO("Landmarks : 3D{}", m_Landmarks.size());
     //auto print_count = std::min((size_t)3, m_Landmarks.size());
@@ -150,41 +333,275 @@ void SNIRF::Print()
     //    NVIZ_INFO("    {} : ( {}, {}, {} )", lm.Name, lm.Position.x, lm.Position.y, lm.Position.z);
     //}
 
-    NVIZ_INFO("Wavelengths : {}, {}", m_Wavelengths[0], m_Wavelengths[1]);
-
-    NVIZ_INFO("Channel Data : {} channels, {} time points", m_ChannelData.rows(), m_ChannelData.cols());
+    for (const auto& block : m_Blocks) {
+        NVIZ_INFO("{} : {} channels, {} time points, {} Hz{}", block.Path, block.NumChannels, block.NumSamples,
+            block.Time.GetSamplingRate(), block.Time.IsUniform() ? "" : " (irregular)");
+        if (!block.Quality.IsEmpty()) {
+            NVIZ_INFO("    Quality : {} of {} channels bad over {} windows", block.Quality.GetNumBadChannels(),
+                block.Quality.NumChannels, block.Quality.NumWindows);
+        }
+    }
+    for (const auto& stim : m_Stims) {
+        NVIZ_INFO("{} : '{}', {} events", stim.Path, stim.Condition.Name, stim.Condition.Events.size());
+    }
+    NVIZ_INFO("Load Timings : probe {:.1f} ms, metadata {:.1f} ms, signal {:.1f} ms, quality {:.1f} ms, preprocessing {:.1f} ms, pyramids {:.1f} ms, total {:.1f} ms",
+        m_LoadTimings.Probe * 1000.0, m_LoadTimings.Metadata * 1000.0, m_LoadTimings.Signal * 1000.0,
+        m_LoadTimings.Quality * 1000.0, m_LoadTimings.Preprocessing * 1000.0, m_LoadTimings.Pyramids * 1000.0, m_LoadTimings.Total * 1000.0);
+    if (m_LoadTimings.FromCache) {
+        NVIZ_INFO("Signal and preprocessing served from the processed data cache");
+    }
+    if (m_LoadSpecification.Windowed) {
+        NVIZ_INFO("Visible Window : {} channels, samples [{}, {})", m_VisibleWindow.Channels.size(),
+            m_VisibleWindow.FirstSample, m_VisibleWindow.FirstSample + m_VisibleWindow.NumSamples);
+    }
 }
 
-void SNIRF::LoadFile(const std::filesystem::path& filepath)
+bool SNIRF::LoadFile(const std::filesystem::path& filepath, const SNIRFLoadSpecification& spec)
 {
     if(!std::filesystem::exists(filepath)) {
         NVIZ_ERROR("File does not exist: {0}", filepath.string().c_str());
-        return;
+        return false;
 	}
-    m_Sources2D.clear();
-    m_Detectors2D.clear();
-    m_Sources3D.clear();
-    m_Detectors3D.clear();
-    //m_Landmarks.clear();
-    m_Channels.clear();
-    m_Wavelengths.clear();
-    m_ChannelData.resize(0, 0);
+    Reset();
 
     m_Filepath = filepath;
-    File file(filepath.string(), File::ReadOnly); //Utils::ParseHDF5(filepath.string());
+    m_LoadSpecification = spec;
+    Timer total_timer;
+
+    // The hooks belong to this call, whatever way it returns a SNIRF that outlives its loader must not reach them
+    struct LoadHooksReset {
+        SNIRFLoadSpecification& Specification;
+        ~LoadHooksReset() {
+            Specification.OnProgress = nullptr;
+            Specification.CancelToken = nullptr;
+        }
+    } hooks_reset{ m_LoadSpecification };
 
-	Group root_group = file.getGroup("/");
-    Group nirs = root_group.getGroup("/nirs");
-    Group data1 = nirs.getGroup("data1");
+    ReportProgress(0.0f, "Opening");
+    {
+        NIRS::HDF5Lock lock(NIRS::GetHDF5Mutex());
+        m_File = CreateRef<File>(filepath.string(), File::ReadOnly); //Utils::ParseHDF5(filepath.string());
+
+	    Group root_group = m_File->getGroup("/");
+
+        ReportProgress(0.02f, "Probe");
+        Timer probe_timer;
+
+        // Every /nirs{i} carries its own probe and /data{j} blocks, single run files only have /nirs/data1
+        for (const auto& nirs_name : Utils::get_indexed_names(root_group, "nirs")) {
+            Group nirs = root_group.getGroup(nirs_name);
+            if (!nirs.exist("probe")) {
+                NVIZ_ERROR("/{} has no probe, skipping it", nirs_name);
+                continue;
+            }
 
-	Group metadata = nirs.getGroup("metaDataTags");
-    Group probe = nirs.getGroup("probe");
+            SNIRFProbe probe;
+	        ParseProbe(nirs.getGroup("probe"), probe); // THIS MUST BE FIRST
 
-    ParseMetadataTags(metadata);
-	ParseProbe(probe); // THIS MUST BE FIRST
-    ParseData1(data1);
+            if (nirs.exist("metaDataTags")) {
+	            Group metadata = nirs.getGroup("metaDataTags");
+                ParseMetadataTags(metadata);
+                probe.CentimetersPerUnit = Utils::get_centimeters_per_unit(metadata);
+            }
+            m_Probes.push_back(std::move(probe));
+
+            for (const auto& stim_name : Utils::get_indexed_names(nirs, "stim")) {
+                SNIRFStim stim;
+                stim.Path = "/" + nirs_name + "/" + stim_name;
+                stim.ProbeIndex = m_Probes.size() - 1;
+                if (ParseStim(nirs.getGroup(stim_name), stim.Condition)) {
+                    m_Stims.push_back(std::move(stim));
+                }
+            }
 
+            for (const auto& data_name : Utils::get_indexed_names(nirs, "data")) {
+                SNIRFDataBlock block;
+                block.Path = "/" + nirs_name + "/" + data_name;
+                block.ProbeIndex = m_Probes.size() - 1;
+                m_Blocks.push_back(std::move(block));
+            }
+        }
+        m_LoadTimings.Probe = probe_timer.Elapsed();
+    }
+    if (m_Blocks.empty()) {
+        NVIZ_ERROR("No /nirs/data blocks in {}", filepath.string());
+        Reset();
+        return false;
+    }
+    if (IsLoadCancelled()) {
+        Reset();
+        return false;
+    }
+
+    // Time bases and dimensions are tiny, they are read for every block before deciding anything else
+    Timer metadata_timer;
+    ReportProgress(0.05f, "Measurement lists");
+    for (auto& block : m_Blocks) {
+        NIRS::HDF5Lock lock(NIRS::GetHDF5Mutex());
+        if (!ParseDataBlock(m_File->getGroup(block.Path), block)) {
+            NVIZ_ERROR("Malformed data block {} in {}", block.Path, filepath.string());
+            Reset();
+            return false;
+        }
+    }
+
+    // The channel tables are read even when the cache is used, they are small and carry the dataType
+    for (auto& block : m_Blocks) {
+        NIRS::HDF5Lock lock(NIRS::GetHDF5Mutex());
+        ParseMeasurementLists(m_File->getGroup(block.Path), block);
+    }
+
+    bool from_cache = false;
+    if (!m_LoadSpecification.Windowed && m_LoadSpecification.UseProcessedCache) {
+        from_cache = LoadFromProcessedCache();
+    }
+    m_LoadTimings.Metadata = metadata_timer.Elapsed() - m_LoadTimings.Preprocessing;
+
+    if (!from_cache && !IsLoadCancelled()) {
+        if (m_LoadSpecification.Windowed) {
+            // Only the first visible window is read, the rest stays on disk until ReadWindow asks for it
+            Timer signal_timer;
+            const auto& block = m_Blocks.front();
+            double start = block.Time.GetStartTime();
+            m_VisibleWindow = ReadWindow(start, start + m_LoadSpecification.InitialWindowSeconds);
+            m_LoadTimings.Signal = signal_timer.Elapsed();
+        }
+        else {
+            DecodeDataBlocks();
+        }
+    }
+
+    if (IsLoadCancelled()) {
+        NVIZ_INFO("Loading cancelled : {}", filepath.string());
+        Reset();
+        return false;
+    }
+
+    // Whatever the samples came from, decoded blocks or the mapped cache, they are all in the registry now
+    if (m_LoadSpecification.BuildPyramids && !m_LoadSpecification.Windowed) {
+        Timer pyramid_timer;
+        ReportProgress(1.0f, "Pyramids");
+        m_ChannelDataRegistry.BuildPyramids(m_LoadSpecification.Pool);
+        m_LoadTimings.Pyramids = pyramid_timer.Elapsed();
+    }
+    m_LoadTimings.Total = total_timer.Elapsed();
+
+    ReportProgress(1.0f, "Done");
     Print();
+    return true;
+}
+
+SNIRFSummary SNIRF::Probe(const std::filesystem::path& filepath)
+{
+    SNIRFSummary summary;
+    summary.Filepath = filepath;
+
+    std::error_code error;
+    summary.FileSize = std::filesystem::file_size(filepath, error);
+    if (!error) {
+        summary.ModifiedTime = static_cast<int64_t>(std::filesystem::last_write_time(filepath, error).time_since_epoch().count());
+    }
+    if (error) {
+        summary.Error = error.message();
+        return summary;
+    }
+
+    try {
+        // Declared first so the HighFive handles below are released while it is still held
+        NIRS::HDF5Lock lock(NIRS::GetHDF5Mutex());
+        File file(filepath.string(), File::ReadOnly);
+        Group root_group = file.getGroup("/");
+
+        for (const auto& nirs_name : Utils::get_indexed_names(root_group, "nirs")) {
+            Group nirs = root_group.getGroup(nirs_name);
+            if (!nirs.exist("probe")) {
+                continue;
+            }
+
+            SNIRFProbe probe;
+            ParseProbe(nirs.getGroup("probe"), probe);
+            summary.Probes.push_back(std::move(probe));
+
+            for (const auto& data_name : Utils::get_indexed_names(nirs, "data")) {
+                Group data = nirs.getGroup(data_name);
+
+                SNIRFDataBlockSummary block;
+                block.Path = "/" + nirs_name + "/" + data_name;
+                block.ProbeIndex = summary.Probes.size() - 1;
+
+                auto dims = data.getDataSet("dataTimeSeries").getDimensions();
+                block.NumSamples = dims.empty() ? 0 : dims[0];
+                block.NumChannels = dims.size() > 1 ? dims[1] : 1;
+
+                // Only the endpoints, the axis itself can be as long as the recording
+                DataSet time = data.getDataSet("time");
+                size_t num_times = time.getElementCount();
+                if (num_times == 2 && block.NumSamples != 2) {
+                    double interval = Utils::read_element(time, 1);
+                    block.StartTime = Utils::read_element(time, 0);
+                    block.EndTime = block.StartTime + interval * (block.NumSamples > 0 ? block.NumSamples - 1 : 0);
+                    block.SamplingRate = interval > 0.0 ? 1.0 / interval : 0.0;
+                }
+                else if (num_times > 0) {
+                    block.StartTime = Utils::read_element(time, 0);
+                    block.EndTime = Utils::read_element(time, num_times - 1);
+                    double duration = block.EndTime - block.StartTime;
+                    block.SamplingRate = duration > 0.0 ? (num_times - 1) / duration : 0.0;
+                }
+                summary.Blocks.push_back(block);
+            }
+        }
+    }
+    catch (const std::exception& e) {
+        summary.Error = e.what();
+        return summary;
+    }
+
+    summary.Valid = !summary.Blocks.empty();
+    if (!summary.Valid) {
+        summary.Error = "No /nirs/data blocks";
+    }
+    return summary;
+}
+
+void SNIRF::Reset()
+{
+    m_Probes.clear();
+    m_Blocks.clear();
+    m_Stims.clear();
+    //m_Landmarks.clear();
+    m_ChannelDataRegistry.Clear();
+    m_VisibleWindow = {};
+    m_LoadTimings = {};
+    m_Filepath = std::filesystem::path("");
+
+    NIRS::HDF5Lock lock(NIRS::GetHDF5Mutex());
+    m_File.reset();
+}
+
+const SNIRFProbe& SNIRF::GetPrimaryProbe()
+{
+    static const SNIRFProbe empty;
+    return m_Probes.empty() ? empty : m_Probes.front();
+}
+
+const SNIRFDataBlock& SNIRF::GetPrimaryBlock()
+{
+    static const SNIRFDataBlock empty;
+    return m_Blocks.empty() ? empty : m_Blocks.front();
+}
+
+bool SNIRF::IsLoadCancelled()
+{
+    return m_LoadSpecification.CancelToken && m_LoadSpecification.CancelToken->load();
+}
+
+void SNIRF::ReportProgress(float progress, const std::string& stage)
+{
+    std::lock_guard<std::mutex> lock(m_ProgressMutex);
+    if (m_LoadSpecification.OnProgress) {
+        m_LoadSpecification.OnProgress(progress, stage);
+    }
 }
 
 
@@ -199,7 +616,57 @@ void SNIRF::ParseMetadataTags(const HighFive::Group& metadata)
 	}
 }
 
-void SNIRF::ParseProbe(const HighFive::Group& probe)
+bool SNIRF::ParseStim(const HighFive::Group& stim, NIRS::StimCondition& out)
+{
+    try {
+        if (stim.exist("name")) {
+            stim.getDataSet("name").read(out.Name);
+        }
+        if (stim.exist("dataLabels")) {
+            stim.getDataSet("dataLabels").read(out.DataLabels);
+        }
+        if (!stim.exist("data")) {
+            return true; // A condition without events
+        }
+
+        DataSet data = stim.getDataSet("data");
+        auto dims = data.getDimensions();
+        std::vector<double> values(data.getElementCount());
+        if (!values.empty()) {
+            data.read_raw<double>(values.data());
+        }
+
+        // Events are rows of [onset, duration, amplitude, ...]. A single event is sometimes written flat,
+        // and files from column-major writers have the matrix transposed
+        size_t rows = values.size() / 3, cols = 3;
+        bool transposed = false;
+        if (dims.size() == 2) {
+            rows = dims[0];
+            cols = dims[1];
+            if (cols < 3 && rows == 3) {
+                std::swap(rows, cols);
+                transposed = true;
+            }
+        }
+        if (cols < 3) {
+            NVIZ_WARN("{}/data is {} x {}, a stim needs onset, duration and amplitude columns", stim.getPath(), rows, cols);
+            return false;
+        }
+
+        auto at = [&](size_t event, size_t column) { return transposed ? values[column * rows + event] : values[event * cols + column]; };
+        out.Events.reserve(rows);
+        for (size_t e = 0; e < rows; e++) {
+            out.Events.push_back({ at(e, 0), at(e, 1), at(e, 2) });
+        }
+    }
+    catch (const Exception& e) {
+        NVIZ_WARN("Failed to read stim {}: {}", stim.getPath(), e.what());
+        return false;
+    }
+    return true;
+}
+
+void SNIRF::ParseProbe(const HighFive::Group& probe, SNIRFProbe& out)
 {
     std::vector<std::string> object_names = probe.listObjectNames();
 
@@ -219,7 +686,7 @@ void SNIRF::ParseProbe(const HighFive::Group& probe)
             double x = row_vector(0);
             double y = row_vector(1);
 
-            m_Detectors2D.push_back({ glm::vec2(x, y), DETECTOR });
+            out.Detectors2D.push_back({ glm::vec2(x, y), DETECTOR });
         }
     }
     auto detectorPos3D = probe.getDataSet("detectorPos3D"); 
@@ -237,7 +704,7 @@ void SNIRF::ParseProbe(const HighFive::Group& probe)
             double y = row_vector(1);
             double z = row_vector(2);
 
-            m_Detectors3D.push_back({ glm::vec3(x, z, y), DETECTOR });
+            out.Detectors3D.push_back({ glm::vec3(x, z, y), DETECTOR });
         }
     }
 
@@ -255,7 +722,7 @@ void SNIRF::ParseProbe(const HighFive::Group& probe)
             double x = row_vector(0);
             double y = row_vector(1);
 
-            m_Sources2D.push_back({ glm::vec2(x, y), SOURCE });
+            out.Sources2D.push_back({ glm::vec2(x, y), SOURCE });
         }
     }
     auto sourcePos3D = probe.getDataSet("sourcePos3D"); 
@@ -273,7 +740,7 @@ void SNIRF::ParseProbe(const HighFive::Group& probe)
             double y = row_vector(1);
             double z = row_vector(2);
 
-            m_Sources3D.push_back({ glm::vec3(x, z, y), SOURCE });
+            out.Sources3D.push_back({ glm::vec3(x, z, y), SOURCE });
         }
     }
 
@@ -282,8 +749,9 @@ void SNIRF::ParseProbe(const HighFive::Group& probe)
         auto dims = wavelengths.getDimensions();
         std::vector<int> wl(dims[0]);
 		wavelengths.read(wl);
-		m_Wavelengths = wl; 
-        std::sort(m_Wavelengths.begin(), m_Wavelengths.end()); // Sort in ascending order to make sure HbR is the 0th 
+		out.Wavelengths = wl; 
+        out.FileWavelengths = wl;
+        std::sort(out.Wavelengths.begin(), out.Wavelengths.end()); // Sort in ascending order to make sure HbR is the 0th 
     }
 
     //auto landmarkLabels = probe.getDataSet("landmarkLabels");
@@ -312,110 +780,550 @@ void SNIRF::ParseProbe(const HighFive::Group& probe)
     //}
 }
 
-void SNIRF::ParseData1(const HighFive::Group& data1)
+bool SNIRF::ParseDataBlock(const HighFive::Group& data, SNIRFDataBlock& block)
 {
+    DataSet dataTimeSeries = data.getDataSet("dataTimeSeries");
+    auto dims = dataTimeSeries.getDimensions();
+    if (dims.size() != 2) {
+        NVIZ_ERROR("{} : dataTimeSeries has rank {}, expected <time x channel>", block.Path, dims.size());
+        return false;
+    }
+    block.NumSamples = dims[0];
+    block.NumChannels = dims[1];
 
-    DataSet time = data1.getDataSet("time");
-    {
-        // TODO : time_data[0] - time_data[end] = Duration, 
-        // We need to make sure it ends there
-        std::vector<double> time_data(time.getDimensions()[0]);
-        time.read(time_data);
-		m_Time.resize(time_data.size());
-        for (size_t i = 0; i < time_data.size(); i++)
-        {
-            m_Time[i] = time_data[i] * 10;
+    DataSet time = data.getDataSet("time");
+    std::vector<double> time_data(time.getElementCount());
+    time.read_raw<double>(time_data.data());
+
+    // SNIRF allows a uniform axis to be stored as just [start, interval]
+    if (time_data.size() == 2 && block.NumSamples != 2) {
+        block.Time = NIRS::TimeBase(time_data[0], time_data[1], block.NumSamples);
+    }
+    else {
+        // Every time <-> index mapping would be off, so this is not something to load around
+        if (time_data.size() != block.NumSamples) {
+            NVIZ_ERROR("{} : {} timestamps for {} samples", block.Path, time_data.size(), block.NumSamples);
+            return false;
         }
-        float total_duration = time_data.back() - time_data.front();
-        size_t num_intervals = time_data.size() - 1;
-        float avg_dt = total_duration / num_intervals;
-        float sampling_rate = 1.0f / avg_dt;
-        m_SamplingRate = sampling_rate;
-		m_DurationSeconds = total_duration;
-        NVIZ_INFO("Sampling Rate (Fs): {} Hz", sampling_rate);
-        NVIZ_INFO("Duration (Seconds): {} ", total_duration);
+        block.Time = NIRS::TimeBase::FromSamples(time_data);
     }
+    NVIZ_INFO("{} Sampling Rate (Fs): {} Hz", block.Path, block.Time.GetSamplingRate());
+    NVIZ_INFO("{} Duration (Seconds): {} ", block.Path, block.Time.GetDuration());
+    return true;
+}
 
+void SNIRF::ParseMeasurementLists(const HighFive::Group& data, SNIRFDataBlock& block)
+{
+    auto entries = NIRS::ParseMeasurementLists(data);
+    if (entries.size() != block.NumChannels) {
+        NVIZ_WARN("{} : {} measurement lists for {} dataTimeSeries columns", block.Path, entries.size(), block.NumChannels);
+    }
 
-    using Map_RM = Eigen::Map<const Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>>;
-    auto dataTimeSeries = data1.getDataSet("dataTimeSeries");
+    block.Channels.reserve(entries.size());
+    for (const auto& entry : entries)
     {
-        auto dims = dataTimeSeries.getDimensions();
-        auto nd_array = std::vector<double>(dims[0] * dims[1]);
-        dataTimeSeries.read_raw<double>(nd_array.data());
-        m_ChannelData = Map_RM(nd_array.data(), dims[0], dims[1]).transpose();
-	}
+        if (entry.Index < 1 || entry.Index > block.NumChannels) {
+            NVIZ_ERROR("{} : measurementList{} has no matching dataTimeSeries column", block.Path, entry.Index);
+            continue;
+        }
 
-	std::string base_name = "measurementList";
-    for (size_t i = 1; i < m_ChannelData.rows() + 1; i++)
+		NIRS::Channel channel;
+		channel.ID = entry.Index; // Hopefully this is fine? We shouldnt actually care about this ID, its just for us to identify channels internally
+		channel.SourceID = entry.SourceIndex;
+		channel.DetectorID = entry.DetectorIndex;
+        channel.Wavelength = NIRS::MeasurementListToWavelength(entry);
+
+		block.Channels.push_back(channel);
+    }
+
+    if (!entries.empty()) {
+        const auto& entry = entries.front();
+        block.DataType = entry.DataType;
+        NVIZ_INFO("Measurement List : {0}", entry.Index);
+        NVIZ_INFO("    dataType        : {0}", entry.DataType);
+        NVIZ_INFO("    dataTypeIndex   : {0}", entry.DataTypeIndex);
+        NVIZ_INFO("    dataTypeLabel   : {0}", entry.DataTypeLabel); // Either raw-DC, or conc or something else
+    }
+}
+
+void SNIRF::DecodeDataBlocks()
+{
+    if (m_LoadSpecification.StoragePrecision == NIRS::SamplePrecision::Float32) {
+        DecodeDataBlocksAs<float>();
+    }
+    else {
+        DecodeDataBlocksAs<double>();
+    }
+}
+
+template<typename T, typename F>
+bool SNIRF::ReadRawRows(size_t block, F&& visit)
+{
+    const auto& data = m_Blocks[block];
+    if (data.NumSamples == 0 || data.NumChannels == 0) {
+        return true;
+    }
+
+    Ref<DataSet> dataTimeSeries;
+    size_t chunk_rows = 1;
     {
-		auto name = base_name + std::to_string(i);
+        NIRS::HDF5Lock lock(NIRS::GetHDF5Mutex());
+        dataTimeSeries = NIRS::MakeLockedHandle(m_File->getDataSet(data.Path + "/dataTimeSeries"));
+        chunk_rows = std::max<size_t>(Utils::get_chunk_rows(*dataTimeSeries), 1);
+    }
 
-		auto measurementList = data1.getGroup(name);
+    constexpr size_t STAGING_BYTES = 4 * 1024 * 1024;
+    size_t rows_per_read = std::max<size_t>(STAGING_BYTES / (sizeof(T) * data.NumChannels), 1);
+    rows_per_read = std::max(chunk_rows, rows_per_read / chunk_rows * chunk_rows); // Keep reads chunk aligned
 
-        auto dataType = 0;
-        measurementList.getDataSet("dataType").read(dataType);
-		auto dataTypeIndex = 0;
-        measurementList.getDataSet("dataTypeIndex").read(dataTypeIndex);
-        std::string dataTypeLabel = "";
-        measurementList.getDataSet("dataTypeLabel").read(dataTypeLabel);
+    std::vector<T> staging;
+    for (size_t first = 0; first < data.NumSamples; first += rows_per_read) {
+        if (IsLoadCancelled()) {
+            return false;
+        }
 
-        int sourceIndex = 0;
-        measurementList.getDataSet("sourceIndex").read(sourceIndex);
+        size_t count = std::min(rows_per_read, data.NumSamples - first);
+        staging.resize(count * data.NumChannels);
+        {
+            NIRS::HDF5Lock lock(NIRS::GetHDF5Mutex());
+            dataTimeSeries->select({ first, 0 }, { count, data.NumChannels }).read_raw<T>(staging.data());
+        }
+        visit(first, count, static_cast<const T*>(staging.data()));
+    }
+    return true;
+}
 
-        int detectorIndex = 0;
-        measurementList.getDataSet("detectorIndex").read(detectorIndex);
+template<typename T>
+bool SNIRF::LoadRawSamples(size_t block)
+{
+    auto& data = m_Blocks[block];
+    ChannelDataBlockT<T> raw;
+    raw.NumChannels = data.NumChannels;
+    raw.NumSamples = data.NumSamples;
+    raw.Samples.resize(data.NumChannels * data.NumSamples);
+    try {
+        ReadRawRows<T>(block, [&](size_t first, size_t count, const T* rows) {
+            Utils::transpose_blocked(rows, count, data.NumChannels, raw.Samples.data() + first, data.NumSamples);
+        });
+    }
+    catch (const Exception& e) {
+        NVIZ_ERROR("Failed to read the raw samples of {} : {}", data.Path, e.what());
+        return false;
+    }
 
-        int wavelengthIndex = 0;
-        measurementList.getDataSet("wavelengthIndex").read(wavelengthIndex);
-        
-		NIRS::Channel channel;
-		channel.ID = i; // Hopefully this is fine? We shouldnt actually care about this ID, its just for us to identify channels internally
-		channel.SourceID = sourceIndex;
-		channel.DetectorID = detectorIndex;
-        
-        if (dataTypeIndex == -1) {
-            // Parse dataTypeLabel
-            if(dataTypeLabel == "HbO") {
-                channel.Wavelength = NIRS::WavelengthType::HBO;
+    int first_index = m_ChannelDataRegistry.SubmitChannelBlock(std::move(raw));
+    for (auto& channel : data.Channels) {
+        channel.DataIndex = first_index + (channel.ID - 1);
+    }
+    NVIZ_INFO("Read the raw samples of {} for re-tuning", data.Path);
+    return true;
+}
+
+template<typename T>
+void SNIRF::DecodeDataBlocksAs()
+{
+    ThreadPool& pool = m_LoadSpecification.Pool ? *m_LoadSpecification.Pool : ThreadPool::Get();
+
+    size_t total_values = 0;
+    for (const auto& block : m_Blocks) {
+        total_values += block.NumSamples * block.NumChannels;
+    }
+    std::atomic<size_t> read_values = 0;
+
+    // Single copy ingest : dataTimeSeries is (time x channel) on disk, so it is read a few chunk rows at a time
+    // into a small staging buffer and transposed straight into the final channel-major block.
+    // The registry then takes ownership of that block, peak memory is the block plus the staging rows.
+    // HDF5 converts to T while reading, so float storage never holds a double copy of the signal.
+    // Blocks decode concurrently, HDF5 only allows one read at a time but the transposes of one block
+    // overlap the reads of the others
+    Timer signal_timer;
+    std::vector<ChannelDataBlockT<T>> raw_blocks(m_Blocks.size());
+    std::vector<uint64_t> sample_hashes(m_Blocks.size(), 0);
+    pool.ParallelFor(0, m_Blocks.size(), 1, [&](size_t b) {
+        const auto& block = m_Blocks[b];
+        auto& raw = raw_blocks[b];
+        raw.NumChannels = block.NumChannels;
+        raw.NumSamples = block.NumSamples;
+        raw.Samples.resize(block.NumChannels * block.NumSamples);
+        if (raw.Samples.empty()) {
+            return;
+        }
+
+        // Rows come in file order, so the digest matches what LoadFromProcessedCache recomputes
+        NIRS::ContentHasher hasher;
+        ReadRawRows<T>(b, [&](size_t first, size_t count, const T* rows) {
+            hasher.Update(rows, count * block.NumChannels * sizeof(T));
+            Utils::transpose_blocked(rows, count, block.NumChannels, raw.Samples.data() + first, block.NumSamples);
+
+            size_t done = read_values.fetch_add(count * block.NumChannels) + count * block.NumChannels;
+            ReportProgress(0.1f + 0.7f * done / total_values, "Signal");
+        });
+        sample_hashes[b] = hasher.Digest();
+    });
+    m_LoadTimings.Signal = signal_timer.Elapsed();
+    if (IsLoadCancelled()) {
+        return;
+    }
+
+    // Quality reads the raw intensity, so the masks are there by the time the load returns
+    if (m_LoadSpecification.ComputeQuality) {
+        Timer quality_timer;
+        ReportProgress(0.8f, "Signal quality");
+        for (size_t b = 0; b < m_Blocks.size(); b++) {
+            auto& block = m_Blocks[b];
+            if (block.DataType != Utils::DATA_TYPE_CW_AMPLITUDE || block.NumSamples == 0) {
+                continue;
             }
-            else if (dataTypeLabel == "HbR") {
-                channel.Wavelength = NIRS::WavelengthType::HBR;
+
+            std::vector<const T*> rows(block.Channels.size());
+            for (size_t i = 0; i < rows.size(); i++) rows[i] = raw_blocks[b].GetChannel(block.Channels[i].ID - 1);
+            block.Quality = NIRS::ComputeSignalQuality(rows.data(), block.Channels, block.NumSamples,
+                block.Time.GetSamplingRate(), m_LoadSpecification.Quality, &pool);
+        }
+        m_LoadTimings.Quality = quality_timer.Elapsed();
+    }
+
+    Timer preprocessing_timer;
+    ReportProgress(0.8f, "Preprocessing");
+
+    // Optical density, TDDR and the band-pass only make sense on raw intensity. Blocks that already hold processed
+    // or concentration data get no processed block, their ProcessedDataIndex stays invalid and lookups fall back to Raw
+    auto is_preprocessed = [&](size_t b) { return m_Blocks[b].DataType == Utils::DATA_TYPE_CW_AMPLITUDE; };
+
+    // Processed samples get their own block per data block, laid out in channel table order so it can be written to the cache as is
+    std::vector<ChannelDataBlockT<T>> processed_blocks(m_Blocks.size());
+    std::vector<size_t> channel_offsets(m_Blocks.size() + 1, 0);
+    for (size_t b = 0; b < m_Blocks.size(); b++) {
+        auto& processed = processed_blocks[b];
+        processed.NumChannels = is_preprocessed(b) ? m_Blocks[b].Channels.size() : 0;
+        processed.NumSamples = m_Blocks[b].NumSamples;
+        processed.Samples.resize(processed.NumChannels * processed.NumSamples);
+        channel_offsets[b + 1] = channel_offsets[b] + processed.NumChannels;
+    }
+
+    // Channels are filtered a SIMD group at a time. The groups of all blocks form one range,
+    // so a large block and a few small ones balance across the pool
+    struct ChannelGroup {
+        size_t Block;
+        size_t FirstChannel;
+        size_t NumChannels;
+    };
+    std::vector<ChannelGroup> groups;
+    constexpr size_t GROUP_SIZE = NIRS::InterleavedSOSFilter::Lanes;
+    for (size_t b = 0; b < m_Blocks.size(); b++) {
+        size_t num_channels = processed_blocks[b].NumChannels;
+        for (size_t first = 0; first < num_channels; first += GROUP_SIZE) {
+            groups.push_back({ b, first, std::min(GROUP_SIZE, num_channels - first) });
+        }
+    }
+
+    // One scratch per concurrently running group, sized by the first group it filters and reused for the rest of the load
+    size_t total_channels = channel_offsets.back();
+    std::atomic<size_t> done_channels = 0;
+    NIRS::ProcessingScratchPool scratch_pool;
+    pool.ParallelFor(0, groups.size(), 1, [&](size_t g) {
+        if (IsLoadCancelled()) {
+            return;
+        }
+        const auto& group = groups[g];
+        const auto& block = m_Blocks[group.Block];
+
+        const T* raw[GROUP_SIZE];
+        T* processed[GROUP_SIZE];
+        for (size_t c = 0; c < group.NumChannels; c++) {
+            size_t i = group.FirstChannel + c;
+            raw[c] = raw_blocks[group.Block].GetChannel(block.Channels[i].ID - 1);
+            processed[c] = processed_blocks[group.Block].GetChannel(i);
+        }
+        auto scratch = scratch_pool.Acquire();
+        NIRS::PreprocessHemodynamicChannels(raw, processed, group.NumChannels, block.NumSamples,
+            block.Time.GetSamplingRate(), m_LoadSpecification.Preprocessing, scratch.Get());
+
+        size_t done = done_channels.fetch_add(group.NumChannels) + group.NumChannels;
+        ReportProgress(0.8f + 0.2f * done / total_channels, "Preprocessing");
+    });
+    if (IsLoadCancelled()) {
+        return;
+    }
+
+    // Filtered optical density -> HbO / HbR. The conversion is linear so it commutes with the filter,
+    // doing it last lets it run over whole blocks : every pair of a block converts together, sample ranges in parallel
+    if (m_LoadSpecification.Preprocessing.ConvertToConcentration) {
+        for (size_t b = 0; b < m_Blocks.size(); b++) {
+            const auto& block = m_Blocks[b];
+            if (block.DataType != Utils::DATA_TYPE_CW_AMPLITUDE || block.NumSamples == 0) {
+                continue;
             }
-            else if (dataTypeLabel == "HbT") {
-                channel.Wavelength = NIRS::WavelengthType::HBT;
+
+            const auto& probe = m_Probes[block.ProbeIndex];
+            NIRS::BeerLambertConverter converter(block.Channels, probe.FileWavelengths, probe.Sources3D, probe.Detectors3D,
+                probe.CentimetersPerUnit, m_LoadSpecification.Preprocessing.BeerLambert);
+            if (converter.IsEmpty()) {
+                continue;
             }
-            else {
-                NVIZ_ERROR("Unknown dataTypeLabel: {0}", dataTypeLabel);
-                channel.Wavelength = NIRS::WavelengthType::HBR; // Default to something
-			}
+
+            std::vector<T*> rows(block.Channels.size());
+            for (size_t i = 0; i < rows.size(); i++) rows[i] = processed_blocks[b].GetChannel(i);
+
+            constexpr size_t RANGE = 16384;
+            pool.ParallelFor(0, (block.NumSamples + RANGE - 1) / RANGE, 1, [&](size_t r) {
+                size_t first = r * RANGE;
+                converter.Convert(rows.data(), first, std::min(RANGE, block.NumSamples - first));
+            });
+            NVIZ_INFO("{} : {} source-detector pairs converted to HbO / HbR", block.Path, converter.GetPairs().size());
         }
-        else {
-            channel.Wavelength = NIRS::WavelengthType(wavelengthIndex - 1);
+    }
+
+    // The cache only holds processed samples, a file with blocks that have none is always read from the SNIRF
+    bool all_preprocessed = true;
+    for (size_t b = 0; b < m_Blocks.size(); b++) {
+        if (!is_preprocessed(b)) {
+            NVIZ_INFO("{} is not raw intensity (dataType {}), showing it as stored", m_Blocks[b].Path, m_Blocks[b].DataType);
+            all_preprocessed = false;
         }
+    }
 
+    if (m_LoadSpecification.UseProcessedCache && all_preprocessed) {
+        std::vector<NIRS::ProcessedCacheBlock> cache_blocks(m_Blocks.size());
+        for (size_t b = 0; b < m_Blocks.size(); b++) {
+            cache_blocks[b] = { m_Blocks[b].Channels, processed_blocks[b].Samples.data(), NIRS::PrecisionOf<T>(), m_Blocks[b].NumSamples, m_Blocks[b].Time.GetSamplingRate() };
+        }
 
-        auto channel_row = m_ChannelData.row(i - 1);
-        std::vector<double> channel_data_vec(channel_row.size());
-        std::copy(channel_row.data(), channel_row.data() + channel_row.size(), channel_data_vec.begin());
+        auto key = NIRS::ProcessedDataCache::MakeKey(m_Filepath, m_LoadSpecification.Preprocessing.Hash());
+        key.ContentHash = Utils::hash_recording(m_Probes, m_Blocks, sample_hashes);
+        auto cache_path = NIRS::ProcessedDataCache::GetCachePath(m_Filepath, m_LoadSpecification.CacheDirectory);
+        NIRS::ProcessedDataCache::Write(cache_path, key, cache_blocks);
+    }
 
-        std::vector<double> processed;
-        PreprocessHemodynamicData(channel_data_vec, processed, m_SamplingRate);
+    for (size_t b = 0; b < m_Blocks.size(); b++) {
+        int first_index = m_ChannelDataRegistry.SubmitChannelBlock(std::move(raw_blocks[b]));
+        auto& channels = m_Blocks[b].Channels;
+        for (size_t i = 0; i < channels.size(); i++) {
+            channels[i].DataIndex = first_index + (channels[i].ID - 1);
+        }
+        if (!is_preprocessed(b)) {
+            continue;
+        }
 
-		channel.DataIndex = m_ChannelDataRegistry.SubmitChannelData(channel_data_vec);
+        int first_processed_index = m_ChannelDataRegistry.SubmitChannelBlock(std::move(processed_blocks[b]));
+        for (size_t i = 0; i < channels.size(); i++) {
+            channels[i].ProcessedDataIndex = first_processed_index + static_cast<int>(i);
+        }
+    }
+    m_LoadTimings.Preprocessing = preprocessing_timer.Elapsed();
+}
 
-		m_Channels.push_back(channel);
-        if (i == 1) {
-            NVIZ_INFO("Measurement List : {0}", name);
-            NVIZ_INFO("    dataType        : {0}", dataType);
-            NVIZ_INFO("    dataTypeIndex   : {0}", dataTypeIndex);
-            NVIZ_INFO("    dataTypeLabel   : {0}", dataTypeLabel); // Either raw-DC, or conc or something else
-            NVIZ_INFO("Channel : ");
-            NVIZ_INFO("    Source ID     : {0}", channel.SourceID);
-            NVIZ_INFO("    Detector ID   : {0}", channel.DetectorID);
-            NVIZ_INFO("    Wavelength    : {0}", NIRS::WavelengthTypeToString(channel.Wavelength));
-            NVIZ_INFO("    Data          : {0}", channel.DataIndex);
+bool SNIRF::LoadFromProcessedCache()
+{
+    Timer cache_timer;
+    auto cache_path = NIRS::ProcessedDataCache::GetCachePath(m_Filepath, m_LoadSpecification.CacheDirectory);
+    // Only called when the recording's modification time changed, reads the samples once more to compare fingerprints
+    auto fingerprint = [this]() {
+        auto hash_samples = [this](size_t b, auto sample) {
+            using T = decltype(sample);
+            NIRS::ContentHasher hasher;
+            ReadRawRows<T>(b, [&](size_t, size_t count, const T* rows) { hasher.Update(rows, count * m_Blocks[b].NumChannels * sizeof(T)); });
+            return hasher.Digest();
+        };
+        std::vector<uint64_t> sample_hashes(m_Blocks.size());
+        for (size_t b = 0; b < m_Blocks.size(); b++) {
+            sample_hashes[b] = m_LoadSpecification.StoragePrecision == NIRS::SamplePrecision::Float32 ? hash_samples(b, float()) : hash_samples(b, double());
         }
+        return Utils::hash_recording(m_Probes, m_Blocks, sample_hashes);
+    };
+
+    auto cache = NIRS::ProcessedDataCache::Open(cache_path, m_Filepath, m_LoadSpecification.Preprocessing.Hash(), fingerprint);
+    if (!cache) {
+        return false;
     }
+
+    if (cache->GetNumBlocks() != m_Blocks.size()) {
+        NVIZ_WARN("Processed data cache has {} blocks, the file has {}, ignoring it", cache->GetNumBlocks(), m_Blocks.size());
+        return false;
+    }
+    for (size_t b = 0; b < m_Blocks.size(); b++) {
+        const auto& cached = cache->GetBlock(b);
+        const auto& channels = m_Blocks[b].Channels;
+        bool same_channels = cached.Channels.size() == channels.size() && std::equal(channels.begin(), channels.end(), cached.Channels.begin(),
+            [](const NIRS::Channel& a, const NIRS::Channel& c) {
+                return a.ID == c.ID && a.SourceID == c.SourceID && a.DetectorID == c.DetectorID && a.Wavelength == c.Wavelength;
+            });
+        if (cached.NumSamples != m_Blocks[b].NumSamples || !same_channels || m_Blocks[b].DataType != Utils::DATA_TYPE_CW_AMPLITUDE) {
+            NVIZ_WARN("Processed data cache does not match {} ({} x {}), ignoring it", m_Blocks[b].Path, m_Blocks[b].NumSamples, m_Blocks[b].NumChannels);
+            return false;
+        }
+        if (cached.Precision != m_LoadSpecification.StoragePrecision) {
+            NVIZ_INFO("Processed data cache holds {} byte samples, reprocessing", NIRS::GetSampleSize(cached.Precision));
+            return false;
+        }
+    }
+
+    // Nothing is read here, the registry points straight into the mapping and pages come in as they are drawn.
+    // Raw samples are not part of the cache, DataIndex stays invalid until ReadWindow or GetProcessingGraphSource needs them
+    for (size_t b = 0; b < m_Blocks.size(); b++) {
+        const auto& cached = cache->GetBlock(b);
+        auto& block = m_Blocks[b];
+
+        int first_index = cached.Precision == NIRS::SamplePrecision::Float32
+            ? m_ChannelDataRegistry.SubmitExternalBlock(cache->GetMapping(), cached.GetChannelSamples<float>(0), cached.Channels.size(), cached.NumSamples)
+            : m_ChannelDataRegistry.SubmitExternalBlock(cache->GetMapping(), cached.GetChannelSamples<double>(0), cached.Channels.size(), cached.NumSamples);
+        for (size_t i = 0; i < block.Channels.size(); i++) {
+            block.Channels[i].ProcessedDataIndex = first_index + static_cast<int>(i);
+        }
+    }
+
+    m_LoadTimings.FromCache = true;
+    m_LoadTimings.Preprocessing = cache_timer.Elapsed();
+    NVIZ_INFO("Loaded preprocessed data from {}", cache_path.string());
+    return true;
 }
 
+size_t SNIRF::TimeToSample(double seconds, size_t block)
+{
+    if (block >= m_Blocks.size()) return 0;
+    return std::min(m_Blocks[block].Time.TimeToIndex(seconds), m_Blocks[block].NumSamples);
+}
+
+template<typename T>
+NIRS::ProcessingGraphSource<T> SNIRF::GetProcessingGraphSource(size_t block)
+{
+    NIRS::ProcessingGraphSource<T> source;
+    if (block >= m_Blocks.size()) {
+        return source;
+    }
+    const auto& data = m_Blocks[block];
+    if (data.DataType != Utils::DATA_TYPE_CW_AMPLITUDE) {
+        NVIZ_WARN("{} is not raw intensity (dataType {}), it has nothing to preprocess", data.Path, data.DataType);
+        return source;
+    }
+
+    // A load served from the processed data cache has no raw samples yet, they are read once on the first re-tune
+    bool has_raw = std::all_of(data.Channels.begin(), data.Channels.end(), [&](const NIRS::Channel& channel) {
+        return m_ChannelDataRegistry.HasChannelData(channel, NIRS::ChannelDataView::Raw);
+    });
+    if (!has_raw && m_File && !LoadRawSamples<T>(block)) {
+        return source;
+    }
+
+    for (const auto& channel : data.Channels) {
+        if (!m_ChannelDataRegistry.HasChannelData(channel, NIRS::ChannelDataView::Raw) ||
+            m_ChannelDataRegistry.GetPrecision(static_cast<int>(channel.DataIndex)) != NIRS::PrecisionOf<T>()) {
+            NVIZ_WARN("{} has no raw {}-bit samples in the registry, re-tune it with the precision it was loaded with", data.Path, 8 * sizeof(T));
+            return {};
+        }
+        source.Raw.push_back(m_ChannelDataRegistry.GetChannelSpan<T>(channel, NIRS::ChannelDataView::Raw).Data);
+    }
+
+    const auto& probe = m_Probes[data.ProbeIndex];
+    source.Channels = data.Channels;
+    source.NumSamples = data.NumSamples;
+    source.SamplingRate = data.Time.GetSamplingRate();
+    source.Wavelengths = probe.FileWavelengths;
+    source.Sources = probe.Sources3D;
+    source.Detectors = probe.Detectors3D;
+    source.CentimetersPerUnit = probe.CentimetersPerUnit;
+    return source;
+}
+
+template NIRS::ProcessingGraphSource<float> SNIRF::GetProcessingGraphSource<float>(size_t);
+template NIRS::ProcessingGraphSource<double> SNIRF::GetProcessingGraphSource<double>(size_t);
+
+NIRS::EpochAverage SNIRF::AverageEpochs(const SNIRFStim& stim, NIRS::EpochSpecification spec, size_t block)
+{
+    if (block >= m_Blocks.size()) {
+        return {};
+    }
+    const auto& data = m_Blocks[block];
+    if (stim.ProbeIndex != data.ProbeIndex) {
+        NVIZ_WARN("{} belongs to another nirs element than {}", stim.Path, data.Path);
+        return {};
+    }
+
+    for (const auto& channel : data.Channels) {
+        if (!m_ChannelDataRegistry.HasChannelData(channel, NIRS::ChannelDataView::Processed)) {
+            NVIZ_WARN("{} has no processed samples loaded, nothing to average", data.Path);
+            return {};
+        }
+    }
+
+    spec.Onsets = NIRS::GetOnsets(stim.Condition, data.Time.GetStartTime());
+    NIRS::EpochAverager averager(spec, data.NumSamples, data.Time.GetSamplingRate());
+
+    // Straight from the registry rows, a block is stored at one precision
+    auto average = [&](auto precision) {
+        using T = decltype(precision);
+        std::vector<const T*> rows(data.Channels.size());
+        for (size_t c = 0; c < rows.size(); c++) {
+            rows[c] = m_ChannelDataRegistry.GetChannelSpan<T>(data.Channels[c], NIRS::ChannelDataView::Processed).Data;
+        }
+        return averager.Average(rows.data(), rows.size(), m_LoadSpecification.Pool);
+    };
+    bool is_float = !data.Channels.empty() &&
+        m_ChannelDataRegistry.GetPrecision(static_cast<int>(data.Channels.front().GetDataIndex(NIRS::ChannelDataView::Processed))) == NIRS::SamplePrecision::Float32;
+    return is_float ? average(float()) : average(double());
+}
+
+NIRS::DataWindow SNIRF::ReadWindow(double t0, double t1, const std::vector<NIRS::ChannelID>& channels, size_t block)
+{
+    size_t first = TimeToSample(t0, block);
+    size_t last = TimeToSample(t1, block);
+    return ReadSampleWindow(first, last > first ? last - first : 0, channels, block);
+}
+
+NIRS::DataWindow SNIRF::ReadSampleWindow(size_t firstSample, size_t numSamples, const std::vector<NIRS::ChannelID>& channels, size_t block)
+{
+    NIRS::DataWindow window;
+    if (!m_File) {
+        NVIZ_ERROR("ReadWindow called without a loaded file");
+        return window;
+    }
+    if (block >= m_Blocks.size()) {
+        NVIZ_ERROR("ReadWindow : invalid data block {}", block);
+        return window;
+    }
+    const auto& data = m_Blocks[block];
+    std::string dataTimeSeriesPath = data.Path + "/dataTimeSeries";
+
+    firstSample = std::min(firstSample, data.NumSamples);
+    numSamples = std::min(numSamples, data.NumSamples - firstSample);
+
+    // Channel IDs are 1-indexed measurementList indices, columns in dataTimeSeries are 0-indexed
+    std::vector<size_t> columns;
+    if (channels.empty()) {
+        columns.resize(data.NumChannels);
+        for (size_t c = 0; c < data.NumChannels; c++) columns[c] = c;
+    }
+    else {
+        columns.reserve(channels.size());
+        for (auto id : channels) {
+            if (id < 1 || id > data.NumChannels) {
+                NVIZ_ERROR("ReadWindow : invalid channel ID {}", id);
+                continue;
+            }
+            columns.push_back(id - 1);
+        }
+        std::sort(columns.begin(), columns.end());
+        columns.erase(std::unique(columns.begin(), columns.end()), columns.end());
+    }
+
+    window.FirstSample = firstSample;
+    window.NumSamples = numSamples;
+    window.Channels.resize(columns.size());
+    for (size_t c = 0; c < columns.size(); c++) window.Channels[c] = static_cast<NIRS::ChannelID>(columns[c] + 1);
+
+    std::vector<double> sample_major;
+    try {
+        NIRS::HDF5Lock lock(NIRS::GetHDF5Mutex());
+        DataSet dataTimeSeries = m_File->getDataSet(dataTimeSeriesPath);
+        Utils::read_hyperslab(dataTimeSeries, firstSample, numSamples, columns, sample_major);
+    }
+    catch (const Exception& e) {
+        NVIZ_ERROR("Failed to read window [{}, {}) of '{}': {}", firstSample, firstSample + numSamples, dataTimeSeriesPath, e.what());
+        window.NumSamples = 0;
+        return window;
+    }
+
+    window.Samples.resize(numSamples * columns.size());
+    Utils::transpose_blocked(sample_major.data(), numSamples, columns.size(), window.Samples.data(), numSamples);
+    return window;
+}
@@ -0,0 +1,189 @@
+#include "pch.h"
+#include "NIRS/StreamingProcessor.h"
+
+#include <cmath>
+#include <algorithm>
+
+#include "Core/Timer.h"
+#include "NIRS/OpticalDensity.h"
+
+namespace Utils {
+
+	static constexpr double DEFAULT_HISTORY_SECONDS = 60.0;
+}
+
+NIRS::StreamingProcessor::StreamingProcessor(const StreamingSpecification& spec)
+	: m_Specification(spec)
+{
+	constexpr size_t LANES = InterleavedSOSFilter::Lanes;
+	m_NumGroups = (spec.NumChannels + LANES - 1) / LANES;
+
+	auto sections = DesignFilter(spec.Filter, spec.SamplingRate);
+	if (sections.empty()) {
+		NVIZ_WARN("Streaming processor runs without a filter");
+	}
+	m_Filters.assign(m_NumGroups, InterleavedSOSFilter(sections));
+
+	m_BaselineFrames = std::max<size_t>(static_cast<size_t>(std::round(spec.BaselineSeconds * spec.SamplingRate)), 1);
+	m_BaselineSum.assign(spec.NumChannels, 0.0);
+	m_Baseline.assign(spec.NumChannels, 0.0);
+
+	m_HistoryCapacity = spec.HistorySamples ? spec.HistorySamples
+		: std::max<size_t>(static_cast<size_t>(Utils::DEFAULT_HISTORY_SECONDS * spec.SamplingRate), 1);
+	m_History.assign(m_HistoryCapacity * spec.NumChannels, 0.0f);
+	m_Latencies.assign(LatencyWindow, 0.0);
+}
+
+void NIRS::StreamingProcessor::UpdateBaseline(const double* frame)
+{
+	m_BaselineSeen++;
+	double scale = 1.0 / static_cast<double>(m_BaselineSeen);
+	for (size_t c = 0; c < m_Specification.NumChannels; c++) {
+		m_BaselineSum[c] += frame[c];
+		m_Baseline[c] = std::max(m_BaselineSum[c] * scale, MinimumIntensity);
+	}
+}
+
+void NIRS::StreamingProcessor::Push(const double* frames, size_t numFrames)
+{
+	if (numFrames == 0) {
+		return;
+	}
+	Timer timer;
+
+	// Optical density straight into the group-interleaved layout, a row of a group is a contiguous run of a frame
+	constexpr size_t LANES = InterleavedSOSFilter::Lanes;
+	size_t num_channels = m_Specification.NumChannels;
+	m_Staging.resize(m_NumGroups * numFrames * LANES);
+	for (size_t i = 0; i < numFrames; i++) {
+		const double* frame = frames + i * num_channels;
+
+		// The baseline only moves during its window, every frame after it uses the final one.
+		// Per frame, so the result does not depend on how acquisition splits the frames into blocks
+		if (m_BaselineSeen < m_BaselineFrames) {
+			UpdateBaseline(frame);
+		}
+
+		for (size_t g = 0; g < m_NumGroups; g++) {
+			size_t first = g * LANES;
+			size_t count = std::min(LANES, num_channels - first);
+			double* row = m_Staging.data() + (g * numFrames + i) * LANES;
+			ConvertFrameToOpticalDensity(frame + first, m_Baseline.data() + first, row, count);
+			for (size_t lane = count; lane < LANES; lane++) row[lane] = 0.0;
+		}
+	}
+
+	// The filters keep their state, so consecutive pushes filter like one long signal
+	for (size_t g = 0; g < m_NumGroups; g++) {
+		m_Filters[g].Process(m_Staging.data() + g * numFrames * LANES, numFrames);
+	}
+
+	// Back to sample-major floats before taking the lock, readers only wait for the copy into the ring
+	size_t frames_to_keep = std::min(numFrames, m_HistoryCapacity);
+	size_t skipped = numFrames - frames_to_keep;
+	m_Pending.resize(frames_to_keep * num_channels);
+	for (size_t i = 0; i < frames_to_keep; i++) {
+		float* frame = m_Pending.data() + i * num_channels;
+		for (size_t c = 0; c < num_channels; c++) {
+			frame[c] = static_cast<float>(m_Staging[((c / LANES) * numFrames + skipped + i) * LANES + c % LANES]);
+		}
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(m_HistoryMutex);
+		size_t head = (m_FrameCount + skipped) % m_HistoryCapacity;
+		size_t first_run = std::min(frames_to_keep, m_HistoryCapacity - head);
+		std::copy(m_Pending.begin(), m_Pending.begin() + first_run * num_channels, m_History.begin() + head * num_channels);
+		std::copy(m_Pending.begin() + first_run * num_channels, m_Pending.end(), m_History.begin());
+		m_FrameCount += numFrames;
+	}
+
+	// Includes the wait for the lock, a reader holding it delays acquisition just like the filters do
+	double seconds = timer.Elapsed();
+
+	std::lock_guard<std::mutex> lock(m_HistoryMutex);
+	m_Latencies[m_LatencyCount % LatencyWindow] = seconds;
+	m_LatencyCount++;
+}
+
+size_t NIRS::StreamingProcessor::GetFrameCount() const
+{
+	std::lock_guard<std::mutex> lock(m_HistoryMutex);
+	return m_FrameCount;
+}
+
+size_t NIRS::StreamingProcessor::ReadLatest(size_t numFrames, std::vector<float>& out) const
+{
+	std::lock_guard<std::mutex> lock(m_HistoryMutex);
+	size_t num_channels = m_Specification.NumChannels;
+	numFrames = std::min({ numFrames, m_FrameCount, m_HistoryCapacity });
+
+	// At most two contiguous runs of the ring, the wrapped part comes second
+	out.resize(numFrames * num_channels);
+	size_t tail = (m_FrameCount - numFrames) % m_HistoryCapacity;
+	size_t first_run = std::min(numFrames, m_HistoryCapacity - tail);
+	auto first = m_History.begin() + tail * num_channels;
+	std::copy(first, first + first_run * num_channels, out.begin());
+	std::copy(m_History.begin(), m_History.begin() + (numFrames - first_run) * num_channels, out.begin() + first_run * num_channels);
+	return numFrames;
+}
+
+size_t NIRS::StreamingProcessor::ReadChannel(size_t channel, size_t numSamples, std::vector<float>& out) const
+{
+	std::lock_guard<std::mutex> lock(m_HistoryMutex);
+	size_t num_channels = m_Specification.NumChannels;
+	if (channel >= num_channels) {
+		out.clear();
+		return 0;
+	}
+	numSamples = std::min({ numSamples, m_FrameCount, m_HistoryCapacity });
+
+	out.resize(numSamples);
+	for (size_t i = 0; i < numSamples; i++) {
+		out[i] = m_History[((m_FrameCount - numSamples + i) % m_HistoryCapacity) * num_channels + channel];
+	}
+	return numSamples;
+}
+
+NIRS::StreamingLatencyStats NIRS::StreamingProcessor::GetLatencyStats() const
+{
+	std::vector<double> latencies;
+	StreamingLatencyStats stats;
+	{
+		std::lock_guard<std::mutex> lock(m_HistoryMutex);
+		if (m_LatencyCount == 0) {
+			return stats;
+		}
+		size_t count = std::min(m_LatencyCount, LatencyWindow);
+		latencies.assign(m_Latencies.begin(), m_Latencies.begin() + count);
+		stats.Blocks = m_LatencyCount;
+		stats.Last = m_Latencies[(m_LatencyCount - 1) % LatencyWindow];
+	}
+
+	double sum = 0.0;
+	for (double latency : latencies) {
+		sum += latency;
+		stats.Max = std::max(stats.Max, latency);
+	}
+	stats.Mean = sum / static_cast<double>(latencies.size());
+
+	auto p99 = latencies.begin() + static_cast<size_t>(0.99 * static_cast<double>(latencies.size() - 1));
+	std::nth_element(latencies.begin(), p99, latencies.end());
+	stats.P99 = *p99;
+	return stats;
+}
+
+void NIRS::StreamingProcessor::Reset()
+{
+	std::fill(m_BaselineSum.begin(), m_BaselineSum.end(), 0.0);
+	std::fill(m_Baseline.begin(), m_Baseline.end(), 0.0);
+	m_BaselineSeen = 0;
+	for (auto& filter : m_Filters) {
+		filter.Reset();
+	}
+
+	std::lock_guard<std::mutex> lock(m_HistoryMutex);
+	std::fill(m_History.begin(), m_History.end(), 0.0f);
+	m_FrameCount = 0;
+	m_LatencyCount = 0;
+}
@@ -0,0 +1,77 @@
+#include "pch.h"
+#include "NIRS/TimeBase.h"
+
+#include <cmath>
+#include <algorithm>
+
+NIRS::TimeBase::TimeBase(double startTime, double interval, size_t count)
+	: m_StartTime(startTime), m_Interval(interval), m_Count(count)
+{
+}
+
+NIRS::TimeBase NIRS::TimeBase::FromSamples(const std::vector<double>& time)
+{
+	if (time.empty()) {
+		return {};
+	}
+	if (time.size() == 1) {
+		return TimeBase(time.front(), 0.0, 1);
+	}
+
+	size_t count = time.size();
+	double start = time.front();
+	double interval = (time.back() - start) / static_cast<double>(count - 1);
+
+	// Writers that store float32 timestamps lose ~1e-7 relative to the time itself, that still counts as uniform
+	double tolerance = 1e-6 * std::abs(interval) + 1e-7 * std::max(std::abs(start), std::abs(time.back()));
+	bool uniform = interval > 0.0;
+	for (size_t i = 1; uniform && i < count - 1; i++) {
+		uniform = std::abs(time[i] - (start + static_cast<double>(i) * interval)) <= tolerance;
+	}
+
+	TimeBase base(start, interval, count);
+	if (!uniform) {
+		NVIZ_WARN("Time axis is not uniformly sampled, keeping all {} timestamps", count);
+		base.m_Samples = time;
+	}
+	return base;
+}
+
+size_t NIRS::TimeBase::TimeToIndex(double seconds) const
+{
+	// Times come from the UI and stim files, NaN never reaches a comparison or a cast
+	if (m_Count == 0 || std::isnan(seconds)) return 0;
+
+	if (IsUniform()) {
+		if (!(m_Interval > 0.0)) return 0;
+
+		// Clamped while still a double, casting NaN, inf or anything past SIZE_MAX is undefined
+		double index = std::round((seconds - m_StartTime) / m_Interval);
+		if (!(index > 0.0)) return 0;
+		if (index >= static_cast<double>(m_Count)) return m_Count;
+		return static_cast<size_t>(index);
+	}
+
+	if (seconds <= m_Samples.front()) return 0;
+	if (seconds > m_Samples.back()) {
+		// Same rule as the uniform case, half an interval past the last sample rounds to the end
+		return seconds - m_Samples.back() >= 0.5 * m_Interval ? m_Count : m_Count - 1;
+	}
+
+	size_t upper = std::lower_bound(m_Samples.begin(), m_Samples.end(), seconds) - m_Samples.begin();
+	size_t lower = upper - 1;
+	return seconds - m_Samples[lower] < m_Samples[upper] - seconds ? lower : upper;
+}
+
+std::vector<double> NIRS::TimeBase::ToVector() const
+{
+	if (!IsUniform()) {
+		return m_Samples;
+	}
+
+	std::vector<double> time(m_Count);
+	for (size_t i = 0; i < m_Count; i++) {
+		time[i] = GetTime(i);
+	}
+	return time;
+}
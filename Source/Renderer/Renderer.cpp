@@ -177,6 +177,13 @@ void Renderer::DrawPoints(const VertexArray* vertexArray, uint32_t vertexCount)
 	glDrawArrays(GL_POINTS, 0, vertexArray->GetVertexCount());
 }
 
+void Renderer::DrawLineStripsInstanced(const VertexArray* vertexArray, uint32_t vertexCount, uint32_t instanceCount)
+{
+	vertexArray->Bind();
+	glDrawArraysInstanced(GL_LINE_STRIP, 0, vertexCount, instanceCount);
+	vertexArray->Unbind();
+}
+
 void Renderer::OnWindowResize(uint32_t width, uint32_t height)
 {
 	SetViewport(0, 0, width, height);
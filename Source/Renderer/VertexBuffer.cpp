@@ -41,6 +41,19 @@ void VertexBuffer::SetData(const void* data, uint32_t size)
 	m_Size = size;
 }
 
+void VertexBuffer::SetSubData(const void* data, uint32_t size, uint32_t offset)
+{
+	NVIZ_ASSERT(offset + size <= m_Size, "Vertex buffer sub data out of range!");
+	glBindBuffer(GL_ARRAY_BUFFER, m_RendererID);
+	glBufferSubData(GL_ARRAY_BUFFER, offset, size, data);
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+void VertexBuffer::BindStorage(uint32_t binding)
+{
+	glBindBufferBase(GL_SHADER_STORAGE_BUFFER, binding, m_RendererID);
+}
+
 void VertexBuffer::ClearData()
 {
 }
@@ -7,6 +7,7 @@
 #include <QOpenGLContext>
 
 #include "Core/Input.h"
+#include "Events/EventBus.h"
 
 #include "Renderer/Renderer.h"
 #include "Renderer/ViewportManager.h"
@@ -82,6 +83,9 @@ void ViewportWidget::onFrameReady()
 {
     float deltaTime = m_LastTime.restart() / 1000.0f;
 
+    // Deliver events posted by worker threads (e.g. background SNIRF loads) on the main thread
+    EventBus::Instance().DispatchPosted();
+
     if (m_ViewportHovered) {
 
         // Check if right mouse button is pressed for camera control
@@ -0,0 +1,252 @@
+#include "pch.h"
+#include <glad/glad.h>
+#include "Widgets/WaveformWidget.h"
+
+#include <QWheelEvent>
+#include <QMouseEvent>
+
+#include <cmath>
+#include <limits>
+#include <algorithm>
+
+#include "NIRS/Snirf.h"
+#include "NIRS/DecimationPyramid.h"
+
+#include "Renderer/Renderer.h"
+#include "Renderer/Shader.h"
+#include "Renderer/VertexArray.h"
+#include "Renderer/VertexBuffer.h"
+
+namespace Utils {
+
+    static constexpr double MIN_WINDOW_SAMPLES = 8.0;
+    static constexpr double ZOOM_STEP = 1.25; // Per wheel notch
+    static constexpr float GAIN_STEP = 1.25f;
+    static const glm::vec4 TRACE_COLOR = glm::vec4(0.85f, 0.9f, 1.0f, 1.0f);
+
+    // One lane's envelope as a line strip : columns alternate min -> max and max -> min, so consecutive columns
+    // connect at their extremes instead of with a diagonal. Values are scaled to [-1, 1] over the visible window
+    void write_lane(const NIRS::Envelope& envelope, size_t numColumns, float* strip)
+    {
+        float lo = std::numeric_limits<float>::infinity(), hi = -lo;
+        for (size_t c = 0; c < numColumns; c++) {
+            if (std::isnan(envelope.Min[c])) continue;
+            lo = std::min(lo, envelope.Min[c]);
+            hi = std::max(hi, envelope.Max[c]);
+        }
+        float center = hi >= lo ? 0.5f * (hi + lo) : 0.0f;
+        float scale = hi > lo ? 2.0f / (hi - lo) : 0.0f;
+
+        for (size_t c = 0; c < numColumns; c++) {
+            float a = std::isnan(envelope.Min[c]) ? 0.0f : (envelope.Min[c] - center) * scale;
+            float b = std::isnan(envelope.Max[c]) ? 0.0f : (envelope.Max[c] - center) * scale;
+            strip[2 * c] = (c % 2 == 0) ? a : b;
+            strip[2 * c + 1] = (c % 2 == 0) ? b : a;
+        }
+    }
+}
+
+WaveformWidget::WaveformWidget(QWidget* parent) : QOpenGLWidget(parent)
+{
+    setMouseTracking(false);
+    setMinimumHeight(120);
+}
+
+WaveformWidget::~WaveformWidget()
+{
+    // GL objects have to go while the context is current
+    makeCurrent();
+    m_EnvelopeBuffer.reset();
+    m_VAO.reset();
+    m_Shader.reset();
+    doneCurrent();
+}
+
+void WaveformWidget::initializeGL()
+{
+    if (!gladLoadGL()) {
+        NVIZ_ERROR("Failed to initialize GLAD");
+        return;
+    }
+
+    m_Shader = CreateRef<Shader>(
+        "C:/dev/NIRSViz/Assets/Shaders/Waveform.vert",
+        "C:/dev/NIRSViz/Assets/Shaders/Waveform.frag"
+    );
+    m_VAO = CreateRef<VertexArray>();
+    m_Dirty = true;
+}
+
+void WaveformWidget::resizeGL(int w, int h)
+{
+    Renderer::SetViewport(0, 0, w, h);
+    Invalidate();
+}
+
+void WaveformWidget::paintGL()
+{
+    if (m_Dirty) {
+        StreamEnvelopes();
+    }
+
+    Renderer::SetClearColor({ 0.12f, 0.13f, 0.15f, 1.0f });
+    Renderer::Clear();
+    if (m_NumLanes == 0 || m_NumDrawnColumns < 2 || !m_EnvelopeBuffer) {
+        return;
+    }
+
+    Renderer::EnableDepthTest(false);
+    Renderer::SetLineWidth(1.0f);
+
+    m_Shader->Bind();
+    m_Shader->SetUniform1i("u_VerticesPerChannel", static_cast<int>(2 * m_NumColumns));
+    m_Shader->SetUniform1i("u_NumLanes", static_cast<int>(m_ChannelsPerPage));
+    m_Shader->SetUniform1f("u_Gain", m_Gain);
+    m_Shader->SetUniform4f("u_LineColor", Utils::TRACE_COLOR);
+    m_EnvelopeBuffer->BindStorage(0);
+
+    // Every lane is an instance, columns past the end of the recording are not drawn
+    Renderer::DrawLineStripsInstanced(m_VAO.get(), static_cast<uint32_t>(2 * m_NumDrawnColumns), static_cast<uint32_t>(m_NumLanes));
+}
+
+void WaveformWidget::StreamEnvelopes()
+{
+    m_Dirty = false;
+    m_NumLanes = 0;
+    m_NumDrawnColumns = 0;
+    if (!m_SNIRF || m_Channels.empty() || m_NumSamples == 0 || !(m_SamplingRate > 0.0)) {
+        return;
+    }
+
+    auto& registry = m_SNIRF->GetChannelDataRegistry();
+    const NIRS::Channel& first_channel = m_Channels[m_FirstChannel];
+    if (!registry.HasChannelData(first_channel, m_View) || !registry.HasPyramid(static_cast<int>(first_channel.GetDataIndex(m_View)))) {
+        return; // e.g. raw samples of a load served from the processed data cache
+    }
+
+    m_NumColumns = static_cast<size_t>(std::max(width() * devicePixelRatio(), 1.0));
+    m_NumLanes = std::min(m_ChannelsPerPage, m_Channels.size() - m_FirstChannel);
+
+    double first = m_Start * m_SamplingRate;
+    double last = (m_Start + m_Seconds) * m_SamplingRate;
+    double samples_per_column = (last - first) / static_cast<double>(m_NumColumns);
+    double drawn = std::ceil((static_cast<double>(m_NumSamples) - first) / samples_per_column);
+    m_NumDrawnColumns = static_cast<size_t>(std::clamp(drawn, 0.0, static_cast<double>(m_NumColumns)));
+
+    // Each fetch reads 1 to LevelFactor pyramid buckets per column, a page is small enough to stay on the GUI thread.
+    // Waiting on the shared pool here would let this paint pick up queued load tasks
+    size_t lane_values = 2 * m_NumColumns;
+    m_Staging.resize(m_NumLanes * lane_values);
+    NIRS::Envelope envelope;
+    for (size_t lane = 0; lane < m_NumLanes; lane++) {
+        registry.FetchEnvelope(m_Channels[m_FirstChannel + lane], m_View, first, last, m_NumColumns, envelope);
+        Utils::write_lane(envelope, m_NumColumns, m_Staging.data() + lane * lane_values);
+    }
+
+    // The buffer persists across frames and only grows, a scroll overwrites it in place
+    uint32_t bytes = static_cast<uint32_t>(m_Staging.size() * sizeof(float));
+    if (!m_EnvelopeBuffer || m_EnvelopeBuffer->GetSize() < bytes) {
+        m_EnvelopeBuffer = CreateRef<VertexBuffer>(bytes + bytes / 2);
+    }
+    m_EnvelopeBuffer->SetSubData(m_Staging.data(), bytes);
+}
+
+void WaveformWidget::Invalidate()
+{
+    m_Dirty = true;
+    update();
+}
+
+void WaveformWidget::SetSNIRF(const Ref<SNIRF>& snirf, size_t block)
+{
+    m_SNIRF = snirf;
+    m_Block = block;
+    m_Channels.clear();
+    m_NumSamples = 0;
+    m_SamplingRate = 0.0;
+    m_FirstChannel = 0;
+
+    if (m_SNIRF && block < m_SNIRF->GetNumDataBlocks()) {
+        const auto& data = m_SNIRF->GetDataBlocks()[block];
+        m_Channels = data.Channels;
+        m_NumSamples = data.NumSamples;
+        m_SamplingRate = data.Time.GetSamplingRate();
+    }
+    SetTimeWindow(0.0, m_SamplingRate > 0.0 ? static_cast<double>(m_NumSamples) / m_SamplingRate : 0.0);
+}
+
+void WaveformWidget::SetChannelDataView(NIRS::ChannelDataView view)
+{
+    m_View = view;
+    Invalidate();
+}
+
+void WaveformWidget::SetTimeWindow(double start, double seconds)
+{
+    double duration = m_SamplingRate > 0.0 ? static_cast<double>(m_NumSamples) / m_SamplingRate : 0.0;
+    double min_seconds = m_SamplingRate > 0.0 ? Utils::MIN_WINDOW_SAMPLES / m_SamplingRate : 0.0;
+    m_Seconds = std::clamp(seconds, min_seconds, std::max(duration, min_seconds));
+    m_Start = std::clamp(start, 0.0, std::max(duration - m_Seconds, 0.0));
+
+    emit TimeWindowChanged(m_Start, m_Seconds);
+    Invalidate();
+}
+
+void WaveformWidget::SetFirstChannel(size_t channel)
+{
+    m_FirstChannel = m_Channels.empty() ? 0 : std::min(channel, m_Channels.size() - 1);
+    Invalidate();
+}
+
+void WaveformWidget::SetChannelsPerPage(size_t count)
+{
+    m_ChannelsPerPage = std::max<size_t>(count, 1);
+    Invalidate();
+}
+
+void WaveformWidget::wheelEvent(QWheelEvent* event)
+{
+    double notches = event->angleDelta().y() / 120.0;
+    if (event->modifiers() & Qt::ShiftModifier) {
+        int64_t channel = static_cast<int64_t>(m_FirstChannel) - static_cast<int64_t>(std::round(notches * 4.0));
+        SetFirstChannel(static_cast<size_t>(std::max<int64_t>(channel, 0)));
+    }
+    else if (event->modifiers() & Qt::ControlModifier) {
+        m_Gain *= std::pow(Utils::GAIN_STEP, static_cast<float>(notches));
+        update(); // A uniform, the envelopes stay as they are
+    }
+    else {
+        // The time under the cursor stays where it is
+        double anchor = m_Start + m_Seconds * event->position().x() / std::max(width(), 1);
+        double seconds = m_Seconds * std::pow(Utils::ZOOM_STEP, -notches);
+        SetTimeWindow(anchor - (anchor - m_Start) * seconds / m_Seconds, seconds);
+    }
+    event->accept();
+}
+
+void WaveformWidget::mousePressEvent(QMouseEvent* event)
+{
+    if (event->button() == Qt::LeftButton) {
+        m_Panning = true;
+        m_PanStart = m_Start;
+        m_PanX = event->position().x();
+    }
+    QOpenGLWidget::mousePressEvent(event);
+}
+
+void WaveformWidget::mouseReleaseEvent(QMouseEvent* event)
+{
+    if (event->button() == Qt::LeftButton) {
+        m_Panning = false;
+    }
+    QOpenGLWidget::mouseReleaseEvent(event);
+}
+
+void WaveformWidget::mouseMoveEvent(QMouseEvent* event)
+{
+    if (m_Panning) {
+        double dx = event->position().x() - m_PanX;
+        SetTimeWindow(m_PanStart - dx * m_Seconds / std::max(width(), 1), m_Seconds);
+    }
+    QOpenGLWidget::mouseMoveEvent(event);
+}
@@ -1,13 +1,19 @@
 #include <QApplication>
+#include <QMessageBox>
 #include "Core/Log.h"
 #include "Core/Input.h"
 #include "Core/Application.h"
+#include "Core/InstructionSet.h"
 
 int main(int argc, char* argv[])
 {
     QApplication app(argc, argv);
 
     Log::Init();
+    if (!SIMD::CheckInstructionSet()) {
+        QMessageBox::critical(nullptr, "NIRS VIZ", QString("This build needs a CPU with %1.").arg(SIMD::GetBuildInstructionSet()));
+        return 1;
+    }
     Input::Init();
 
     ApplicationSpecification spec;
@@ -0,0 +1,183 @@
+#include "pch.h"
+#include "Core/Log.h"
+#include "NIRS/DecimationPyramid.h"
+
+#include <cmath>
+#include <random>
+#include <utility>
+#include <vector>
+#include <algorithm>
+
+// DecimationPyramid::Fetch against min / max / mean computed from the samples themselves, over the sample range
+// each column should cover : whole samples when zoomed in, else the column edges snapped to the buckets of the
+// coarsest level not wider than a column. Odd lengths so the last bucket of every level is partial, and views
+// hanging off either end of the channel
+
+namespace Utils {
+
+	// The pyramid folds float means of its buckets, the brute force sums the samples in double
+	static constexpr double MEAN_TOLERANCE = 1e-5;
+
+	struct View {
+		double First = 0.0;
+		double Last = 0.0;
+		size_t NumColumns = 0;
+	};
+
+	// Random walk with isolated one-sample spikes, a peak lost between two columns shows up in Min or Max
+	std::vector<double> make_signal(size_t numSamples)
+	{
+		std::mt19937 rng(24);
+		std::normal_distribution<double> step(0.0, 0.05);
+		std::uniform_int_distribution<int> spike(0, 997);
+		std::vector<double> samples(numSamples);
+		double x = 1.0;
+		for (size_t i = 0; i < numSamples; i++) {
+			x += step(rng);
+			samples[i] = x;
+			if (spike(rng) == 0) samples[i] += (i % 2 ? 5.0 : -5.0);
+		}
+		return samples;
+	}
+
+	size_t snap(double position, size_t numBuckets)
+	{
+		if (!(position > 0.0)) return 0;
+		return std::min(static_cast<size_t>(std::floor(position + 0.5)), numBuckets);
+	}
+
+	// Sample range [begin, end) of every column, empty when the column is past an end of the channel
+	std::vector<std::pair<size_t, size_t>> column_ranges(size_t numSamples, const View& view)
+	{
+		using NIRS::DecimationPyramid;
+		std::vector<std::pair<size_t, size_t>> ranges(view.NumColumns, { 0, 0 });
+		double width = (view.Last - view.First) / static_cast<double>(view.NumColumns);
+
+		if (width < static_cast<double>(DecimationPyramid::BaseBucketSamples)) {
+			for (size_t c = 0; c < view.NumColumns; c++) {
+				double a = view.First + width * static_cast<double>(c);
+				if (a + width <= 0.0) continue;
+				size_t begin = static_cast<size_t>(std::max(std::floor(a), 0.0));
+				size_t end = static_cast<size_t>(std::max(std::floor(a + width), 0.0));
+				end = std::min(std::max(end, begin + 1), numSamples);
+				if (begin < end) ranges[c] = { begin, end };
+			}
+			return ranges;
+		}
+
+		// A level exists as long as the one below has more than one bucket
+		size_t bucket = DecimationPyramid::BaseBucketSamples;
+		while ((numSamples + bucket - 1) / bucket > 1 && static_cast<double>(bucket * DecimationPyramid::LevelFactor) <= width) {
+			bucket *= DecimationPyramid::LevelFactor;
+		}
+		size_t num_buckets = (numSamples + bucket - 1) / bucket;
+		double scale = 1.0 / static_cast<double>(bucket);
+		for (size_t c = 0; c < view.NumColumns; c++) {
+			size_t begin = snap((view.First + width * static_cast<double>(c)) * scale, num_buckets);
+			size_t end = snap((view.First + width * static_cast<double>(c + 1)) * scale, num_buckets);
+			if (begin < end) ranges[c] = { begin * bucket, std::min(end * bucket, numSamples) };
+		}
+		return ranges;
+	}
+
+	template<typename T>
+	bool check_view(const char* name, const std::vector<T>& samples, const NIRS::DecimationPyramid& pyramid, const View& view)
+	{
+		NIRS::Envelope envelope;
+		pyramid.Fetch(samples.data(), view.First, view.Last, view.NumColumns, envelope);
+		auto ranges = column_ranges(samples.size(), view);
+
+		size_t wrong = 0, filled = 0;
+		double worst_mean = 0.0;
+		for (size_t c = 0; c < view.NumColumns; c++) {
+			auto [begin, end] = ranges[c];
+			if (begin == end) {
+				wrong += !std::isnan(envelope.Min[c]) || !std::isnan(envelope.Max[c]) || !std::isnan(envelope.Mean[c]);
+				continue;
+			}
+			filled++;
+			float lo = static_cast<float>(samples[begin]), hi = lo;
+			double sum = 0.0;
+			for (size_t i = begin; i < end; i++) {
+				lo = std::min(lo, static_cast<float>(samples[i]));
+				hi = std::max(hi, static_cast<float>(samples[i]));
+				sum += static_cast<double>(samples[i]);
+			}
+			double mean = sum / static_cast<double>(end - begin);
+			wrong += envelope.Min[c] != lo || envelope.Max[c] != hi;
+			worst_mean = std::max(worst_mean, std::abs(static_cast<double>(envelope.Mean[c]) - mean) / std::max(1.0, std::abs(mean)));
+		}
+
+		if (wrong || !(worst_mean <= MEAN_TOLERANCE)) {
+			NVIZ_ERROR("Pyramid {} : {} of {} columns wrong, max mean deviation {}", name, wrong, view.NumColumns, worst_mean);
+			return false;
+		}
+		NVIZ_INFO("Pyramid {} : {} of {} columns filled, max mean deviation {}", name, filled, view.NumColumns, worst_mean);
+		return true;
+	}
+
+	// The columns of a snapped view tile the samples they cover, no bucket is read twice or skipped.
+	// Zoomed in, neighbouring columns may show the same sample but still skip none
+	bool check_tiling(const char* name, size_t numSamples, const View& view)
+	{
+		double width = (view.Last - view.First) / static_cast<double>(view.NumColumns);
+		bool snapped = width >= static_cast<double>(NIRS::DecimationPyramid::BaseBucketSamples);
+
+		auto ranges = column_ranges(numSamples, view);
+		size_t previous_end = 0;
+		bool started = false;
+		for (const auto& [begin, end] : ranges) {
+			if (begin == end) continue;
+			if (started && (snapped ? begin != previous_end : begin > previous_end)) {
+				NVIZ_ERROR("Pyramid {} : a column starts at sample {}, the one before ends at {}", name, begin, previous_end);
+				return false;
+			}
+			started = true;
+			previous_end = end;
+		}
+		return true;
+	}
+
+	template<typename T>
+	bool check_signal(const char* name, size_t numSamples)
+	{
+		auto signal = make_signal(numSamples);
+		std::vector<T> samples(signal.begin(), signal.end());
+		NIRS::DecimationPyramid pyramid(samples.data(), samples.size());
+
+		double n = static_cast<double>(numSamples);
+		const View views[] = {
+			{ 0.0, n, 800 },                   // Whole channel
+			{ 0.0, n, 7 },                     // A few columns, the coarsest levels
+			{ 123.4, n - 987.6, 333 },         // Fractional edges
+			{ 0.0, 16.0 * 640.0, 640 },        // Exactly a base bucket per column
+			{ 64.0 * 3.0, 64.0 * 403.0, 400 }, // Exactly a level 1 bucket per column
+			{ n / 3.0, n / 3.0 + 25.5, 640 },  // Several columns per sample
+			{ n / 2.0, n / 2.0 + 3000.0, 500 },
+			{ n - 5000.0, n + 20000.0, 500 },  // Past the end
+			{ -3000.0, 4000.0, 200 },          // Before the start
+			{ -n, 2.0 * n, 901 },
+			{ n + 10.0, n + 1000.0, 50 },      // Nothing to show
+		};
+
+		bool passed = true;
+		for (const auto& view : views) {
+			if (view.Last <= view.First) continue;
+			passed = check_view(name, samples, pyramid, view) && passed;
+			passed = check_tiling(name, numSamples, view) && passed;
+		}
+		return passed;
+	}
+}
+
+int main()
+{
+	Log::Init();
+
+	int failures = 0;
+	failures += !Utils::check_signal<float>("float, 100003 samples", 100003);
+	failures += !Utils::check_signal<double>("double, 100003 samples", 100003);
+	failures += !Utils::check_signal<float>("float, 4097 samples", 4097);
+	failures += !Utils::check_signal<float>("float, 37 samples", 37);
+	return failures == 0 ? 0 : 1;
+}
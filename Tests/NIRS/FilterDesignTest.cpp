@@ -0,0 +1,167 @@
+#include "pch.h"
+#include "Core/Log.h"
+#include "NIRS/FilterDesign.h"
+
+#include "FilterReference.h"
+
+#include <cmath>
+#include <iterator>
+#include <vector>
+
+// DesignFilter, ComputeInitialConditions and both FiltFilt against scipy's butter / cheby1 (output='sos'),
+// sosfilt_zi and sosfiltfilt stored in FilterReference.h (Utilities/py/filter_reference.py)
+
+namespace Utils {
+
+	// Coefficients relative to the largest of their section, the numerator of a narrow band-pass is tiny
+	static constexpr double SECTION_TOLERANCE = 1e-14;
+	static constexpr double STATE_TOLERANCE = 1e-13;
+	// Relative to the largest reference sample, poles near the unit circle amplify rounding of the coefficients
+	static constexpr double SIGNAL_TOLERANCE = 1e-10;
+
+	std::vector<NIRS::Biquad> to_sections(const double* coefficients, size_t count)
+	{
+		std::vector<NIRS::Biquad> sections(count / 5);
+		for (size_t s = 0; s < sections.size(); s++) {
+			const double* c = coefficients + s * 5;
+			sections[s] = { c[0], c[1], c[2], c[3], c[4] };
+		}
+		return sections;
+	}
+
+	double max_abs(const double* values, size_t count)
+	{
+		double result = 0.0;
+		for (size_t i = 0; i < count; i++) result = std::max(result, std::abs(values[i]));
+		return result;
+	}
+
+	bool report(const char* name, const char* what, double worst, double tolerance)
+	{
+		if (!(worst <= tolerance)) {
+			NVIZ_ERROR("Filter {} : {} deviate from the reference by {}", name, what, worst);
+			return false;
+		}
+		NVIZ_INFO("Filter {} : {} deviate from the reference by {}", name, what, worst);
+		return true;
+	}
+
+	bool check_sections(const char* name, const std::vector<NIRS::Biquad>& designed, const std::vector<NIRS::Biquad>& expected)
+	{
+		if (designed.size() != expected.size()) {
+			NVIZ_ERROR("Filter {} : {} sections, the reference has {}", name, designed.size(), expected.size());
+			return false;
+		}
+		double worst = 0.0;
+		for (size_t s = 0; s < expected.size(); s++) {
+			const auto& a = designed[s];
+			const auto& b = expected[s];
+			double numerator = std::max({ std::abs(b.B0), std::abs(b.B1), std::abs(b.B2) });
+			double denominator = std::max({ 1.0, std::abs(b.A1), std::abs(b.A2) });
+			worst = std::max({ worst,
+				std::abs(a.B0 - b.B0) / numerator, std::abs(a.B1 - b.B1) / numerator, std::abs(a.B2 - b.B2) / numerator,
+				std::abs(a.A1 - b.A1) / denominator, std::abs(a.A2 - b.A2) / denominator });
+		}
+		return report(name, "sections", worst, SECTION_TOLERANCE);
+	}
+
+	// On the reference sections, so a design difference does not show up twice
+	template<size_t S>
+	bool check_initial_conditions(const char* name, const std::vector<NIRS::Biquad>& sections, const double (&expected)[S])
+	{
+		auto conditions = NIRS::ComputeInitialConditions(sections);
+		double scale = std::max(max_abs(expected, S), 1.0);
+		double worst = 0.0;
+		for (size_t s = 0; s < conditions.size(); s++) {
+			worst = std::max({ worst, std::abs(conditions[s][0] - expected[2 * s]) / scale, std::abs(conditions[s][1] - expected[2 * s + 1]) / scale });
+		}
+		return report(name, "initial conditions", worst, STATE_TOLERANCE);
+	}
+
+	template<size_t N>
+	bool check_filtfilt(const char* name, const std::vector<NIRS::Biquad>& sections, const double (&input)[N], const double (&expected)[N])
+	{
+		double scale = max_abs(expected, N);
+
+		std::vector<double> data(std::begin(input), std::end(input));
+		NIRS::SOSFilter filter(sections);
+		filter.FiltFilt(data.data(), N);
+		double worst = 0.0;
+		for (size_t i = 0; i < N; i++) {
+			worst = std::max(worst, std::abs(data[i] - expected[i]) / scale);
+		}
+		bool passed = report(name, "SOSFilter::FiltFilt samples", worst, SIGNAL_TOLERANCE);
+
+		// Lane l holds the input scaled by l + 1, which the filter is linear in
+		constexpr size_t LANES = NIRS::InterleavedSOSFilter::Lanes;
+		size_t padding = NIRS::GetFiltFiltPadding(sections, N);
+		std::vector<double> interleaved((N + 2 * padding) * LANES);
+		for (size_t i = 0; i < N; i++) {
+			for (size_t lane = 0; lane < LANES; lane++) {
+				interleaved[(padding + i) * LANES + lane] = input[i] * static_cast<double>(lane + 1);
+			}
+		}
+		NIRS::InterleavedSOSFilter interleaved_filter(sections);
+		interleaved_filter.FiltFilt(interleaved.data(), N, padding);
+		worst = 0.0;
+		for (size_t i = 0; i < N; i++) {
+			for (size_t lane = 0; lane < LANES; lane++) {
+				double lane_scale = static_cast<double>(lane + 1);
+				worst = std::max(worst, std::abs(interleaved[(padding + i) * LANES + lane] - expected[i] * lane_scale) / (scale * lane_scale));
+			}
+		}
+		return report(name, "InterleavedSOSFilter::FiltFilt samples", worst, SIGNAL_TOLERANCE) && passed;
+	}
+
+	template<size_t C, size_t S, size_t N>
+	bool check_case(const char* name, const NIRS::FilterSpecification& spec, double samplingRate, const double (&coefficients)[C],
+		const double (&initialConditions)[S], const double (&input)[N], const double (&expected)[N])
+	{
+		auto reference = to_sections(coefficients, C);
+		auto designed = NIRS::DesignFilter(spec, samplingRate);
+
+		bool passed = check_sections(name, designed, reference);
+		passed = check_initial_conditions(name, reference, initialConditions) && passed;
+		return check_filtfilt(name, designed, input, expected) && passed;
+	}
+
+	NIRS::FilterSpecification make_spec(NIRS::FilterFamily family, NIRS::FilterType type, int order, double low, double high, double ripple = 0.5)
+	{
+		NIRS::FilterSpecification spec;
+		spec.Family = family;
+		spec.Type = type;
+		spec.Order = order;
+		spec.LowCutoff = low;
+		spec.HighCutoff = high;
+		spec.RippleDb = ripple;
+		return spec;
+	}
+}
+
+int main()
+{
+	Log::Init();
+
+	using namespace FilterReference;
+	using NIRS::FilterFamily;
+	using NIRS::FilterType;
+	int failures = 0;
+
+	// Same cases in the same order as CASES in filter_reference.py
+	auto butter_bandpass = Utils::make_spec(FilterFamily::Butterworth, FilterType::Bandpass, 5, 0.01, 0.1);
+	failures += !Utils::check_case("ButterBandpass78", butter_bandpass, 7.8,
+		ButterBandpass78Sections, ButterBandpass78InitialConditions, ButterBandpass78Input, ButterBandpass78Expected);
+	failures += !Utils::check_case("ButterBandpass10", butter_bandpass, 10.0,
+		ButterBandpass10Sections, ButterBandpass10InitialConditions, ButterBandpass10Input, ButterBandpass10Expected);
+	failures += !Utils::check_case("ButterBandpass50", butter_bandpass, 50.0,
+		ButterBandpass50Sections, ButterBandpass50InitialConditions, ButterBandpass50Input, ButterBandpass50Expected);
+	failures += !Utils::check_case("ButterHighpass50", Utils::make_spec(FilterFamily::Butterworth, FilterType::Highpass, 3, 0.05, 0.0), 50.0,
+		ButterHighpass50Sections, ButterHighpass50InitialConditions, ButterHighpass50Input, ButterHighpass50Expected);
+	failures += !Utils::check_case("Cheby1Lowpass78", Utils::make_spec(FilterFamily::Chebyshev1, FilterType::Lowpass, 4, 0.0, 0.5, 0.5), 7.8,
+		Cheby1Lowpass78Sections, Cheby1Lowpass78InitialConditions, Cheby1Lowpass78Input, Cheby1Lowpass78Expected);
+	failures += !Utils::check_case("Cheby1Bandpass10", Utils::make_spec(FilterFamily::Chebyshev1, FilterType::Bandpass, 3, 0.02, 0.5, 1.0), 10.0,
+		Cheby1Bandpass10Sections, Cheby1Bandpass10InitialConditions, Cheby1Bandpass10Input, Cheby1Bandpass10Expected);
+	failures += !Utils::check_case("Cheby1Highpass10", Utils::make_spec(FilterFamily::Chebyshev1, FilterType::Highpass, 5, 0.01, 0.0, 0.5), 10.0,
+		Cheby1Highpass10Sections, Cheby1Highpass10InitialConditions, Cheby1Highpass10Input, Cheby1Highpass10Expected);
+	return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,1869 @@
+#pragma once
+
+// Generated by Utilities/py/filter_reference.py (scipy 1.17.1), do not edit
+namespace FilterReference {
+
+	static constexpr double ButterBandpass78Sections[] = {
+		5.5780411453813005e-08, 1.1156082290762601e-07, 5.5780411453813005e-08, -1.8963174917696342,
+		0.90115689305406943, 1, 2, 1,
+		-1.9540235525436471, 0.96021239681098669, 1, 0,
+		-1, -1.9293817708955103, 0.93000819214468877, 1,
+		-2, 1, -1.9867448868659388, 0.98682703163856655,
+		1, -2, 1, -1.9957683146153871,
+		0.99583482361853426,
+	};
+	static constexpr double ButterBandpass78InitialConditions[] = {
+		4.6049436474127016e-05, -4.1492253590740226e-05, 0.029752813543370622, -0.028567185988275904,
+		-0.029798918760252657, -0.029798918760259068, -0, 0,
+		-0, 0,
+	};
+	static constexpr double ButterBandpass78Input[] = {
+		0.49508404223334923, 0.51428536426884564, 0.53118580039055197, 0.52251442769418333,
+		0.51940059070334699, 0.5115118904308924, 0.49707770631122355, 0.49637430564352381,
+		0.50287865655159736, 0.51907225209481811, 0.53205577753265521, 0.53754482782130952,
+		0.54716736630128049, 0.54242622825515008, 0.54548897720663025, 0.536698575184404,
+		0.52772454480928732, 0.52654143755452876, 0.53229919353809096, 0.5310962403569699,
+		0.55286736589233243, 0.57338401557339513, 0.57980766618916513, 0.56865352683189807,
+		0.56726135013206225, 0.56083896118291487, 0.55750276743636795, 0.5404329523135929,
+		0.54670355261411552, 0.57233760488105223, 0.5904628078223656, 0.59502314309742921,
+		0.58754244840630609, 0.59556784987871469, 0.58013783976763089, 0.56520686108651519,
+		0.56879190686289305, 0.56946922112785314, 0.58146004585641298, 0.58019854921463321,
+		0.59607963910695461, 0.61363543027382317, 0.61315928508339501, 0.60751637597651142,
+		0.59177759660582341, 0.5898974770609211, 0.57972398641066514, 0.58277052423978781,
+		0.59764404355694278, 0.61865105361076289, 0.62777179612651213, 0.63588696183944293,
+		0.63964276403617781, 0.6216300601389404, 0.6065385380447601, 0.60524798161812721,
+		0.60500827012400171, 0.60600956580288601, 0.62301141365021506, 0.64090301350184686,
+		0.64681696283286605, 0.64986467009875692, 0.6535606827669983, 0.63314953414562181,
+		0.62330559955030584, 0.61854409834468826, 0.61345625379361157, 0.62427705503714359,
+		0.62974363997061966, 0.64447941298591827, 0.66123208086271512, 0.66558304216993391,
+		0.65718628615214081, 0.63892058881151104, 0.63446178440946477, 0.62092355072250793,
+		0.62398122496762642, 0.63757125930604841, 0.64555429715736634, 0.66667078091183685,
+		0.66748297058598172, 0.66749815772711396, 0.65804690062948201, 0.64762720124109596,
+		0.64247960214896349, 0.62883294137360157, 0.63938452604461837, 0.64249307438865455,
+		0.65808888016569134, 0.67717209890408814, 0.68300280551563042, 0.66944337614962623,
+		0.66339815859439699, 0.64900420582012286, 0.64014767129403172, 0.63258644086529736,
+		0.64685047040404142, 0.65887506356076075, 0.67343156053105635, 0.68275756687271605,
+		0.68012114463306605, 0.68092382738167623, 0.673773332908433, 0.65649959215105735,
+		0.64706374707820402, 0.64666303802028335, 0.64554846065878335, 0.65597509860129977,
+		0.67393409843413665, 0.67892770141443104, 0.6827564719969984, 0.68504034338715947,
+		0.67121994102331806, 0.64178599533685021, 0.64769076066899989, 0.64066503378019479,
+		0.65433886168612565, 0.66968643347333978, 0.67799645386214202, 0.68475428901770019,
+		0.68795860133254538, 0.67342786468799976, 0.66050324629106449, 0.65631937229567439,
+		0.64193249285550202, 0.64838093777694239, 0.65508438344283859, 0.66656632402199933,
+		0.68033839454611045, 0.68828251050152178, 0.67998810477988736, 0.67208018957932969,
+		0.65251864716782904, 0.65480879559730631, 0.63916977646767292, 0.65010332871204624,
+		0.66381842533280577, 0.67542430305214707, 0.68215405557322317, 0.68846035394682603,
+		0.68350354867111607, 0.6621844227614605, 0.66021720656861393, 0.66104299856232818,
+		0.64595748379647078, 0.65562248141628787, 0.66133710522903577, 0.68127527950184374,
+		0.69012737261526413, 0.69009627384996064, 0.67484175485675157, 0.67955447653380419,
+		0.6589499047324322, 0.66043649860324194, 0.65038382676756357, 0.65181844539842315,
+		0.67221071474446825, 0.67577972304987355, 0.68958832574222551, 0.68581678381100153,
+		0.68784943750907279, 0.6703241439936346, 0.66047179994051008, 0.6571058065881441,
+		0.65920635326195653, 0.66364638177410873, 0.66997740108985138, 0.68247805288790853,
+		0.69706061804377606, 0.68635286453627131, 0.67912981799019689, 0.67189323155054259,
+		0.66202509553830902, 0.65634937352576328, 0.663884849285301, 0.66363707004662398,
+		0.69412751654129545, 0.69620396092546499, 0.70861971023245973, 0.69826864550804713,
+		0.68201866408124956, 0.68176790469523285, 0.67559684129266329, 0.66693444561727533,
+		0.67484939004284827, 0.69092343502286391, 0.70321781272689254, 0.7087694342070735,
+		0.70937151715147451, 0.71596806815401748, 0.69027558097923092, 0.68341822325148727,
+		0.67893824084800103, 0.67258201540636664, 0.69329149226805775, 0.70837663074673551,
+		0.70832835586588094, 0.72201385032895471, 0.72396054413941013, 0.72191422151841311,
+		0.71021504640167965, 0.70613809694821128, 0.68786378372020129, 0.69018518247417338,
+		0.69836818195907313, 0.71638095381018063, 0.72316955810733885, 0.73921212421652049,
+		0.73601918748735407, 0.73388164118522181, 0.7091867747574232, 0.70477647534449495,
+		0.70872685545371006, 0.70646765145216683, 0.72759823558042391, 0.7350666774838589,
+		0.74939534149218179, 0.74705087848193319, 0.75479421896657506, 0.74440019460451645,
+		0.73080245838198787, 0.72460042142590519, 0.72524818014567793, 0.72986497722255539,
+		0.74154479881648272, 0.76212787751342059, 0.76643948839119236, 0.78117658439918858,
+		0.76285813613260345, 0.75826169926130715, 0.74531362417216362, 0.74208896687676418,
+		0.74629473000794133, 0.75177830908872578, 0.76219021461899594, 0.78370617154213662,
+		0.79702399550137482, 0.79750936081477541, 0.80153427995951887, 0.78314621234234683,
+		0.76075097349888687, 0.76217550866659356, 0.77207890775150323, 0.7817412836315033,
+		0.79394904304491887, 0.81114279562261538, 0.82267880186865305, 0.81387956196240252,
+		0.81322205890886867, 0.79099652742512949, 0.79724298233968716, 0.79056014555725995,
+		0.7958061056153809, 0.80908472569042333, 0.8209970718591838, 0.83223618302145663,
+		0.84724539328513704, 0.8530343962844561, 0.83422177202906034, 0.82543540235358115,
+		0.82324861865216115, 0.82013398733709342, 0.8276898589169992, 0.83827570210962687,
+		0.85995438413604308, 0.8557142647342123, 0.8653887681967124, 0.86485519466732397,
+		0.86247656811929208, 0.84605345550584832, 0.84055160296569287, 0.8355308503865625,
+		0.8576017431822609, 0.85487350083382707, 0.87460326232949026, 0.88954961114260422,
+		0.88947981548614441, 0.88508556584414899, 0.8792905899519714, 0.86554689199465207,
+		0.8556775230760203, 0.86271538334423781, 0.88259357766242297, 0.89476037473302661,
+		0.90911397852015929, 0.9170257615273778, 0.92027558499324813, 0.90574438924107881,
+		0.87991202280942482, 0.88955356627071336, 0.88424395312650317, 0.89195377307385049,
+		0.9015087249017687, 0.9157064741716141, 0.93198134695471346, 0.93422750424952683,
+		0.94022223927625648, 0.92246948651273541, 0.91583462362692536, 0.91458747084028935,
+		1.0035607196301939, 1.0225721801172081, 1.0305652816945337, 1.0358524482163372,
+		1.0514869064794343, 1.0577691720748852, 1.0505400829813694, 1.0451515459672778,
+		1.0308550978652307, 1.0192358512470843, 1.0253418868597652, 1.0290191585880202,
+		1.0419493627428191, 1.066109939996581, 1.0616268668438462, 1.0663294960414487,
+		1.0673496675656855, 1.0534043946941301, 1.0419653520712455, 1.0355782157709996,
+		1.0452030988775527, 1.0528650233737709, 1.0590430346877213, 1.0833031223068084,
+		1.0852421250112412, 1.0951371657197642, 1.0825185968722832, 1.0688350187230855,
+		1.0578314717259325, 1.0519473184373496, 1.0585686304405826, 1.0687427508162475,
+		1.0799892599619565, 1.0893175612777524, 1.0991194947271048, 1.0995366737898711,
+		1.0873075380759056, 1.0681836943927656, 1.0678727510289525, 1.0604602114250157,
+		1.0725878940873317, 1.07626090180273, 1.0940101885111981, 1.1001954260432165,
+		1.1011098427480945, 1.0957951710418974, 1.0927781575961459, 1.0785188716802445,
+		1.0696297777189812, 1.0756587697006719, 1.0686983859457815, 1.0915498878072991,
+		1.1060256949146643, 1.1082747984815662, 1.1079781821143795, 1.1072590406818306,
+		1.0905810442027621, 1.0741013709440537, 1.0590446050158362, 1.0778914613097643,
+		1.0827868489034482, 1.1025648607602103, 1.1137195233260333, 1.1279912390836149,
+		1.1091428008357049, 1.1131677340704123, 1.0905636911119694, 1.0756647928673531,
+		1.0755726712856817, 1.0819590033245736, 1.0861609247012249, 1.1024410940924292,
+		1.1222559598125772, 1.1228337303896525, 1.1134114113820832, 1.108560623963543,
+		1.0905003164643221, 1.0807955850873341, 1.0729802324727722, 1.0814297046621766,
+		1.1003513894340904, 1.0983450823342766, 1.1158147807744836, 1.1243005017787244,
+		1.1099858058151539, 1.1055782837133188, 1.0909171118970162, 1.0905191029054861,
+		1.0826857693900194, 1.0907770673418611, 1.1015891371323283, 1.1075288276891144,
+		1.1142983947258422, 1.1195046418394012, 1.1090179051465303, 1.1043988273068639,
+		1.0895639092282219, 1.0774494998801412, 1.0890937373022664, 1.1023965581142632,
+		1.0921133680550947, 1.1163933861661457, 1.1171066766272539, 1.1213087318405019,
+		1.1039665594561598, 1.0939996746399319, 1.0848923047133971, 1.078611265009257,
+		1.095926078832963, 1.0970927863303388, 1.1040746564105277, 1.1117256737119365,
+		1.117043464195272, 1.117338934684514, 1.1088763479501074, 1.0981624941110522,
+		1.0933595522121891, 1.0746550469677756, 1.0918636145881655, 1.0976843164010579,
+		1.126249200237595, 1.1305059303459151, 1.1251577937706598, 1.121017600110094,
+		1.1092256415969863, 1.088254560311736, 1.0927935442141932, 1.0969126476695104,
+		1.0859167523416815, 1.1061240866431796, 1.1261989229767875, 1.134779163382525,
+		1.1197648609988222, 1.1281800869932881, 1.1072027885022724, 1.0919103542739059,
+		1.0866273270767199, 1.0983738096229738, 1.1055671771607536, 1.1201738283038494,
+		1.1278926428485743, 1.1366467801600806, 1.1341557139573561, 1.1217977498184877,
+		1.1112651566729399, 1.1150408455515208, 1.0997465415426448, 1.1158195623167251,
+		1.1150727698755327, 1.1384190464332069, 1.1492065834999698, 1.1479765799633084,
+		1.1545156972626809, 1.1354628503997013, 1.1156646229188958, 1.1212762677481301,
+		1.1137638401845702, 1.1205204787370489, 1.1244425129115116, 1.1431127849506761,
+		1.1462899939588398, 1.1594925365822037, 1.1612153225336723, 1.1489648432268604,
+		1.1275386258536164, 1.1170444291534143, 1.1185636782219073, 1.1449270977672088,
+		1.1631657581540586, 1.1683440207478062, 1.1744504065778154, 1.1704200449922701,
+		1.1775204311434271, 1.1699761080393063, 1.145225226542701, 1.147091537373444,
+		1.1447994432694988, 1.1505808302889569, 1.1698091614868686, 1.1838277863111211,
+		1.1929366165399067, 1.2014797104072374, 1.1927296001068914, 1.1648410712592068,
+		1.1677832941745714, 1.170821183457093, 1.1727488042047007, 1.1795160976287229,
+		1.2019259187468061, 1.2131466222879377, 1.2114516695950885, 1.2075928990488107,
+		1.2044283687819493, 1.191232912750783, 1.1803315940374146, 1.1882185375892256,
+		1.1999595098041247, 1.2018108494474913, 1.2173651043487979, 1.2314134659316787,
+	};
+	static constexpr double ButterBandpass78Expected[] = {
+		-0.0015070067893431724, 0.00052284775080214778, 0.0025411070729278451, 0.0045452537094112754,
+		0.0065328727050022357, 0.0085016569789862721, 0.010449412049435065, 0.012374060107686647,
+		0.014273643435123058, 0.016146327158167748, 0.017990401341189382, 0.0198042824206804,
+		0.021586513987700451, 0.023335766929151715, 0.025050838941980982, 0.026730653437850617,
+		0.028374257859137476, 0.02998082143024923, 0.031549632371140411, 0.033080094602534554,
+		0.034571723974707397, 0.036024144053778372, 0.037437081501326783, 0.038810361084830158,
+		0.040143900357927316, 0.041437704050826404, 0.042691858212263283, 0.043906524145216473,
+		0.045081932179055019, 0.046218375320914898, 0.047316202828877184, 0.04837581374899419,
+		0.04939765045742936, 0.050382192247983376, 0.051329949004087265, 0.052241454992935164,
+		0.053117262817771578, 0.05395793756241013, 0.054764051159833058, 0.055536177014223427,
+		0.056274884903065085, 0.056980736183075892, 0.057654279320785415, 0.058296045765586599,
+		0.058906546180114649, 0.059486267039843957, 0.060035667610834606, 0.060555177311591012,
+		0.061045193462021446, 0.061506079419543079, 0.06193816309952363, 0.062341735874562335,
+		0.062717051844654426, 0.063064327468090722, 0.06338374154101438, 0.063675435511853881,
+		0.063939514115324753, 0.064176046309298795, 0.064385066496564503, 0.06456657601236232,
+		0.064720544857613388, 0.06484691365701381, 0.064945595820667112, 0.06501647988767352,
+		0.065059432030048853, 0.065074298695449978, 0.065060909367368983, 0.065019079421675827,
+		0.064948613058615323, 0.064849306289613121, 0.064720949958553597, 0.064563332777602941,
+		0.06437624435819754, 0.064159478218505289, 0.063912834749468544, 0.063636124122400203,
+		0.063329169121971507, 0.062991807889261286, 0.062623896560326131, 0.062225311786526044,
+		0.061795953123648585, 0.061335745277762151, 0.060844640196721991, 0.060322618997343667,
+		0.059769693719411772, 0.059185908898856665, 0.058571342953562679, 0.057926109376343599,
+		0.05725035773064107, 0.056544274445500697, 0.055808083407405035, 0.055042046347633135,
+		0.054246463024989727, 0.053421671204986164, 0.052568046437813959, 0.051686001638672541,
+		0.050775986475152773, 0.049838486567422159, 0.048874022507927502, 0.047883148708271032,
+		0.04686645208187714, 0.045824550572081908, 0.044758091536345662, 0.04366774999837654,
+		0.042554226781001715, 0.041418246533566738, 0.040260555668429968, 0.039081920221719565,
+		0.037883123653941565, 0.036664964606300886, 0.035428254628768321, 0.034173815896032349,
+		0.032902478927529046, 0.031615080327729972, 0.030312460562746397, 0.028995461789030987,
+		0.027664925749491552, 0.026321691751675567, 0.02496659474187302, 0.023600463488075974,
+		0.022224118883781344, 0.020838372383663272, 0.019444024581173423, 0.018041863937123117,
+		0.016632665667215638, 0.015217190795289822, 0.013796185377689422, 0.012370379902699751,
+		0.01094048886743724, 0.0095072105329963904, 0.008071226857108699, 0.0066332036020834047,
+		0.0051937906143852096, 0.0037536222708355119, 0.0023133180850661884, 0.00087348346648203137,
+		-0.00056528937740088492, -0.0020024204057473884, -0.0034373405881362859, -0.0048694906402177926,
+		-0.0062983196652720737, -0.0077232837164424202, -0.0091438442950291521, -0.01055946680069769,
+		-0.011969618949819683, -0.013373769178460507, -0.014771385046756246, -0.016161931661569907,
+		-0.017544870134343745, -0.018919656090930773, -0.020285738249865133, -0.021642557085015876,
+		-0.022989543587891313, -0.024326118144072692, -0.025651689537411797, -0.026965654094768681,
+		-0.028267394983209276, -0.029556281670719137, -0.030831669560586764, -0.032092899808631066,
+		-0.033339299331363696, -0.034570181011985571, -0.035784844109842021, -0.036982574877646855,
+		-0.038162647389480053, -0.039324324581299384, -0.04046685950449129, -0.041589496791801302,
+		-0.042691474333795602, -0.043772025162777756, -0.044830379539796461, -0.045865767239034502,
+		-0.046877420022491054, -0.04786457429649893, -0.048826473940288495, -0.049762373295534949,
+		-0.050671540304592241, -0.051553259783888424, -0.052406836817687548, -0.053231600256076109,
+		-0.054026906299597312, -0.05479214215146002, -0.055526729716744064, -0.05623012932657391,
+		-0.05690184346388847, -0.057541420466222425, -0.058148458179832455, -0.058722607538529099,
+		-0.059263576039685531, -0.05977113108907673, -0.060245103185468697, -0.060685388915270422,
+		-0.061091953727140373, -0.061464834456265736, -0.061804141568148369, -0.06211006109214634,
+		-0.062382856215710415, -0.062622868511176655, -0.062830518768088026, -0.063006307405294976,
+		-0.063150814438534097, -0.063264698980836545, -0.063348698255020305, -0.063403626099722249,
+		-0.063430370952958434, -0.063429893300068443, -0.063403222576071949, -0.06335145351588603,
+		-0.063275741949456649, -0.063177300042596668, -0.063057390988171827, -0.062917323156240823,
+		-0.062758443715855095, -0.062582131745474348, -0.062389790853343577, -0.062182841333663516,
+		-0.061962711888894788, -0.061730830952986857, -0.061488617654642738, -0.061237472463874051,
+		-0.060978767569049602, -0.060713837035399391, -0.060443966799517239, -0.060170384557813546,
+		-0.059894249610085472, -0.059616642722347034, -0.059338556075724441, -0.059060883370496621,
+		-0.058784410156182326, -0.058509804459910074, -0.058237607786153271, -0.057968226561293461,
+		-0.057701924096415426, -0.057438813141250843, -0.057178849101252878, -0.056921823988356948,
+		-0.056667361174001112, -0.056414911010383241, -0.056163747382682642, -0.055912965251067551,
+		-0.055661479236782919, -0.055408023301531308, -0.055151151563799058, -0.05488924028979969,
+		-0.054620491090333637, -0.054342935348091287, -0.054054439892733584, -0.053752713933458367,
+		-0.053435317250716471, -0.053099669640331242, -0.052743061594581898, -0.052362666195935402,
+		-0.051955552190146359, -0.051518698196461911, -0.0510490080037116, -0.050543326892151769,
+		-0.049998458912084064, -0.049411185041502173, -0.048778282136387088, -0.048096542578848836,
+		-0.047362794520212553, -0.046573922608494411, -0.045726889082631575, -0.044818755109415777,
+		-0.043846702233399072, -0.042808053805130981, -0.041700296248978391, -0.040521100028508131,
+		-0.039268340165031515, -0.037940116163492632, -0.036534771199512747, -0.035050910422163864,
+		-0.0334874182289992, -0.031843474373050254, -0.030118568765902961, -0.028312514846553113,
+		-0.026425461392460128, -0.024457902657021056, -0.022410686726539224, -0.02028502199965097,
+		-0.01808248170309585, -0.015805006369660635, -0.013454904217058337, -0.011034849380343482,
+		-0.0085478779650961512, -0.0059973819038850566, -0.0033871006142963123, -0.00072111047295880457,
+		0.0019961878635958163, 0.0047600842438139945, 0.0075655758476344277, 0.0104073859738519,
+		0.01327998469102264, 0.016177611238419147, 0.019094298047922079, 0.022023896242916039,
+		0.024960102456466179, 0.027896486798504642, 0.030826521790633707, 0.033743612077617134,
+		0.036641124716834436, 0.039512419841072927, 0.042350881486194071, 0.045149948373580287,
+		0.047903144437928841, 0.050604108893897999, 0.053246625640219994, 0.055824651806997083,
+		0.058332345260769969, 0.060764090892350173, 0.0631145255240943, 0.065378561286042997,
+		0.067551407323956064, 0.0696285897165968, 0.071605969494528104, 0.073479758668070563,
+		0.07524653418782129, 0.076903249777101904, 0.078447245591737089, 0.079876255678493158,
+		0.081188413219170141, 0.082382253562608282, 0.083456715061643719, 0.084411137746269571,
+		0.085245259877891028, 0.085959212442577579, 0.086553511653567256, 0.087029049544901788,
+		0.087387082748877298, 0.087629219559881774, 0.087757405396062915, 0.087773906778067998,
+		0.087681293950796949, 0.087482422279731797, 0.087180412557988876, 0.086778630363829851,
+		0.086280664610992236, 0.08569030543586556, 0.085011521566233358, 0.084248437316003039,
+		0.083405309349049106, 0.082486503353024404, 0.081496470760810194, 0.080439725653266639,
+		0.079320821972210673, 0.078144331167178768, 0.076914820393596081, 0.075636831373515359,
+		0.074314860023135074, 0.07295333694387901, 0.071556608865955107, 0.070128921125067883,
+		0.068674401244420369, 0.067197043685412267, 0.065700695821624827, 0.064189045181869936,
+		0.062665607999327938, 0.061133719095132225, 0.059596523116185109, 0.058056967138512217,
+		0.056517794639108332, 0.054981540831050696, 0.053450529348746834, 0.051926870262642283,
+		0.050412459395629126, 0.048908978906820666, 0.047417899102298031, 0.045940481426862807,
+		0.044477782585696034, 0.043030659740086463, 0.041599776717033403, 0.040185611168568669,
+		0.038788462613126032, 0.037408461288270523, 0.036045577741629649, 0.034699633084958326,
+		0.033370309834894404, 0.032057163263065257, 0.030759633177717731, 0.029477056058903068,
+		0.028208677469423089, 0.026953664664236095, 0.025711119321860296, 0.02448009032253699,
+		0.02325958649955126, 0.022048589292152351, 0.020846065230934064, 0.019650978189268701,
+		0.018462301337366364, 0.017279028738696224, 0.016100186531821041, 0.014924843644150377,
+		0.01375212198771918, 0.012581206090857631, 0.011411352123536384, 0.010241896278227251,
+		0.0090722624722701997, 0.0079019693419246934, 0.006730636502448567, 0.0055579900526465803,
+		0.0043838673063468798, 0.0032082207372059243, 0.0020311211271346538, 0.00085275991250258719,
+		-0.0003265492738830731, -0.0015063698632276096, -0.0026861424081138559, -0.0038651854276802664,
+		-0.0050426970280954032, -0.0062177572825892063, -0.0073893313522579926, -0.0085562733259621927,
+		-0.0097173307548420167, -0.010871149854256168, -0.012016281343291866, -0.013151186889411528,
+		-0.014274246123323626, -0.015383764186831145, -0.016477979774254609, -0.017555073626063369,
+		-0.018613177431566704, -0.019650383095878691, -0.020664752324835441, -0.021654326480080165,
+		-0.022617136655145753, -0.023551213922098978, -0.024454599697226954, -0.025325356173410522,
+		-0.026161576766280913, -0.026961396521004717, -0.027723002426564863, -0.028444643584660423,
+		-0.029124641180791899, -0.029761398205702356, -0.030353408876108663, -0.030899267704612786,
+		-0.031397678169878492, -0.031847460939638757, -0.03224756160088435, -0.032597057853659017,
+		-0.032895166127206173, -0.033141247579713914, -0.033334813445537612, -0.033475529696512026,
+		-0.033563220986800875, -0.033597873853696114, -0.033579639149908934, -0.033508833686217238,
+		-0.033385941066855836, -0.033211611703735225, -0.032986661999411714, -0.032712072692657246,
+		-0.032388986364454003, -0.032018704106252044, -0.031602681356395837, -0.031142522914788154,
+		-0.030639977150165188, -0.030096929418835332, -0.029515394718383828, -0.028897509604627197,
+		-0.028245523404948462, -0.027561788765978, -0.02684875157833317, -0.026108940325737809,
+		-0.025344954910282436, -0.024559455009852842, -0.023755148027854434, -0.022934776699287087,
+		-0.022101106420943251, -0.021256912376937675, -0.020404966533833082, -0.019548024582213528,
+		-0.018688812903616712, -0.017830015643249687, -0.016974261969891033, -0.016124113604855279,
+		-0.015282052701891653, -0.01445047015942242, -0.013631654445583502, -0.012827781015067581,
+		-0.012040902394721324, -0.011272939012147411, -0.010525670838161652, -0.0098007299098450077,
+		-0.0090995937961355911, -0.0084235800624788432, -0.0077738417850491907, -0.0071513641585093709,
+		-0.0065569622341919657, -0.0059912798179584982, -0.0054547895487992324, -0.0049477941704809698,
+		-0.0044704289992604437, -0.0040226655809207958, -0.0036043165202481035, -0.0032150414556426279,
+		-0.002854354140944748, -0.0025216305858154074, -0.0022161181951883906, -0.0019369458374350957,
+	};
+
+	static constexpr double ButterBandpass10Sections[] = {
+		1.6511905458765169e-08, 3.3023810917530339e-08, 1.6511905458765169e-08, -1.9190605514706192,
+		0.92203727775038746, 1, 2, 1,
+		-1.9650355356736098, 0.96881808297298289, 1, 0,
+		-1, -1.9446079721217786, 0.94499198785798655, 1,
+		-2, 1, -1.989660157622652, 0.98971020934155185,
+		1, -2, 1, -1.9967093045444675,
+		0.9967497874091209,
+	};
+	static constexpr double ButterBandpass10InitialConditions[] = {
+		2.2171494524276931e-05, -2.0441657141722832e-05, 0.023441372048364814, -0.022709733265577781,
+		-0.023463560054784494, -0.023463560054803372, -0, 0,
+		-0, 0,
+	};
+	static constexpr double ButterBandpass10Input[] = {
+		0.49716536589310434, 0.51402082856383224, 0.51445933799077692, 0.52328030494825883,
+		0.5290961859918818, 0.51579540882306829, 0.51041563928418876, 0.50720040582162906,
+		0.49431095752953974, 0.50695369353924313, 0.502596442951184, 0.50710216689659626,
+		0.51636113706243447, 0.53003423405626826, 0.53762412507094637, 0.55056738415430206,
+		0.55560129821653481, 0.54965543139463291, 0.54325835873358297, 0.52932276062669015,
+		0.52985771189385844, 0.52710201104184717, 0.52127142307223118, 0.5205624197586034,
+		0.54059083497852278, 0.5454517617485547, 0.56829814289535174, 0.56441378482901206,
+		0.55891822012932912, 0.55816899492957806, 0.57213491111610881, 0.55910640331776751,
+		0.56210284125327925, 0.54003362440628278, 0.54166381065653202, 0.54428713083593505,
+		0.56102287676080842, 0.56321963406629738, 0.57112018022426547, 0.58458943645942207,
+		0.59160945404098897, 0.59510946602180959, 0.59155892427320556, 0.58298636821846672,
+		0.5826932465616349, 0.56789556951837228, 0.56281098962155918, 0.56023190836327263,
+		0.56996256852320593, 0.58351234042976552, 0.58368360425723598, 0.60258693014400222,
+		0.61415047060360872, 0.61462572868118537, 0.61564731196969569, 0.60382455235127974,
+		0.58811277877105228, 0.59736782550907541, 0.59883322667227989, 0.58671594905954327,
+		0.58881367159260589, 0.59558696102097353, 0.59931433220992436, 0.60920665767338256,
+		0.6178479268027538, 0.62511197038970501, 0.63037768852019627, 0.6298945855171374,
+		0.62972138790793475, 0.61668737721339306, 0.60610697572530414, 0.60105355153154305,
+		0.60660597446262776, 0.60705546231587681, 0.61585788982112399, 0.61838019433754732,
+		0.64085395319346161, 0.64304143703874239, 0.63866780737115536, 0.6459916478620007,
+		0.64275827201903979, 0.62877625485406619, 0.61934834746397671, 0.62754730231503564,
+		0.61329995093622536, 0.61427674904317442, 0.61623456830509071, 0.63387889649759965,
+		0.6412299309551126, 0.6609763343828865, 0.65683443791084539, 0.65847143067516922,
+		0.65822201874744668, 0.64454857756665174, 0.63290275934477858, 0.62789712203081616,
+		0.62848903581716375, 0.62265126753159727, 0.63271089631589972, 0.63928517038021093,
+		0.64188954041764457, 0.66156106272135706, 0.66792628890322925, 0.66698904994595776,
+		0.680099701254119, 0.66162790674737482, 0.6463880459536383, 0.64816216377272562,
+		0.63472870676141091, 0.62930863338348964, 0.63845193563196656, 0.63761715247099437,
+		0.64531700503020573, 0.66024735219406794, 0.67174632405656709, 0.6754757774346335,
+		0.6821649534043458, 0.67390762293387763, 0.67012941454121966, 0.66037622270813745,
+		0.64679004582419231, 0.64733386570352702, 0.64204952585826613, 0.63226385559830056,
+		0.65118502012837953, 0.66144652759076172, 0.67648991300701145, 0.68600989388416811,
+		0.67559043689269238, 0.68590456525830434, 0.66695543500717236, 0.66314456113463616,
+		0.65688233502227666, 0.65170492189283324, 0.6409550149129013, 0.64971850357960848,
+		0.64726975771789974, 0.664277680593227, 0.67293473940622806, 0.67764198427905231,
+		0.67970844165631883, 0.6804993321784315, 0.67617251935679823, 0.66836464058399914,
+		0.65635155665034972, 0.65236169112744413, 0.6420172035248275, 0.64141277759582305,
+		0.64820031541800804, 0.6488623102550557, 0.66930921768139717, 0.67931300564142327,
+		0.6812522754430026, 0.68493411535555238, 0.68488820144775131, 0.67808689835927161,
+		0.66347479693553024, 0.65383053983697137, 0.65417913873775946, 0.65217980519146601,
+		0.64390582760740989, 0.6510699040137935, 0.67028217721919203, 0.67235459246553897,
+		0.67542520152901153, 0.69368614298804598, 0.68367398869759577, 0.68116663294243562,
+		0.67967983064523696, 0.65865312008364807, 0.65811198063149579, 0.65437350490543922,
+		0.65060377220063936, 0.65576138048716981, 0.65846954297008342, 0.66631296854247468,
+		0.6846191733742627, 0.69327439255536805, 0.70121490989198176, 0.68991854852782464,
+		0.67904613233310851, 0.6752700059713902, 0.67244376061018041, 0.65033560365996823,
+		0.65446008975632441, 0.64560938356571818, 0.65490284283653788, 0.66013778101641896,
+		0.66926361936558743, 0.68179318438659309, 0.68044214850711193, 0.6903537974618752,
+		0.68749821825703328, 0.67514704563200623, 0.66830452554798792, 0.66085479390592305,
+		0.64269438255271538, 0.64760990230893312, 0.65021123218916754, 0.66274133232023014,
+		0.67413576646796058, 0.68988668827007726, 0.68855248369924893, 0.69255381344105638,
+		0.69146029219946525, 0.67738839009386742, 0.68072209823228191, 0.66854255529275286,
+		0.6634027241419741, 0.6544444690954937, 0.65255050702289086, 0.65539702069315076,
+		0.66737169218423065, 0.6755457799440332, 0.68742827282326924, 0.70147963804535896,
+		0.69049835424676209, 0.70523985027153813, 0.6808103036387152, 0.67987598059193843,
+		0.66046811564738306, 0.66532279985587994, 0.65642297254591764, 0.6530925415116442,
+		0.66768273036431902, 0.68577505922133009, 0.68893420608620171, 0.7096320347782139,
+		0.71399128701024195, 0.69158042265388286, 0.69237601046701169, 0.68429476242740206,
+		0.68149733340012486, 0.66551542078574311, 0.66880701573316925, 0.66516689831089892,
+		0.67278528024545259, 0.67837194051647709, 0.69575442610673344, 0.69762639104210067,
+		0.70589626022317042, 0.71343842584393902, 0.70437095049542175, 0.69667338807415247,
+		0.6875163104327775, 0.68320342224223019, 0.66876193688033136, 0.67706573227679423,
+		0.68293887160503675, 0.69257838469694166, 0.70320452952940216, 0.71512274784466823,
+		0.71781766118330725, 0.72287481250762997, 0.71177995065005306, 0.72052411000504324,
+		0.71157586900921355, 0.69804408266611184, 0.69099701356075505, 0.69351063381983913,
+		0.69789131710465635, 0.69915156180964655, 0.71230425808860087, 0.72195474658363401,
+		0.72404840429802475, 0.73283969047051478, 0.73082398691588546, 0.73240241006325157,
+		0.72654456065078832, 0.71828283676238058, 0.70867156904886941, 0.71347510711476592,
+		0.70436005608794516, 0.71760480358157064, 0.71729084905363827, 0.72810817678123574,
+		0.74176081769462876, 0.74979449243851715, 0.75437260170658627, 0.75257710340076334,
+		0.7521337693573974, 0.74802047724270182, 0.73136750448437338, 0.72617491370225895,
+		0.72300659760213093, 0.72097227287300381, 0.72686375141693593, 0.73681100677076683,
+		0.75200190513537213, 0.75454848430671628, 0.77195731883411156, 0.76660847695359557,
+		0.78016348503658095, 0.77564676879875893, 0.75195196792511776, 0.75003428595181998,
+		0.74390717742474222, 0.74589492231000265, 0.7458876213432325, 0.75747254186291546,
+		0.87630967083805822, 0.87942725058211613, 0.88397721098401427, 0.90084929575993644,
+		0.89979372910617783, 0.88837090069313618, 0.8760359578619733, 0.87742864276903776,
+		0.87633147920737231, 0.86776493166993329, 0.87164067081110308, 0.88230278392461636,
+		0.88921852688941905, 0.90592040949163688, 0.90987397733595998, 0.91907026953071247,
+		0.91856507550586519, 0.91736607808352721, 0.91071733604796834, 0.89859355310788314,
+		0.88395682204543968, 0.88947745444141257, 0.89378307470335849, 0.89150036439181846,
+		0.90218307175135892, 0.91823218081329427, 0.92673496113392151, 0.93745175576298179,
+		0.94618303412218741, 0.94564324886062678, 0.93951017845342311, 0.93289989877750956,
+		0.91829594048021745, 0.91759311698702317, 0.90864906606456819, 0.91347770532622241,
+		0.93335364420743672, 0.93984234813386636, 0.95052960069987558, 0.95626169942517214,
+		0.95880346761946289, 0.96212157474113735, 0.96777326893410309, 0.95795122331173621,
+		0.95018186992988973, 0.94276504361255764, 0.94077991320912457, 0.93730728543720709,
+		0.94592748036987795, 0.95977623148268332, 0.9572971414713195, 0.97313654908857938,
+		0.98239088573195188, 0.98865943544611434, 0.9989552948993391, 0.98670260802637844,
+		0.97567854878792781, 0.98477357320100711, 0.96835923799323886, 0.96139521889099377,
+		0.96821901890204853, 0.96992558304223442, 0.98724122696918093, 0.99657409079702264,
+		1.0092610361491627, 1.0148565269947309, 1.0195852791944178, 1.0154796014041014,
+		1.0075125622564265, 1.0048431064410397, 0.99461404449839497, 0.9929424497005912,
+		0.99462478811562416, 0.99012771038191616, 1.0047057298361808, 1.0131246667468075,
+		1.0302512391554439, 1.0250950366352782, 1.0368968654332094, 1.04862463443508,
+		1.026886924108527, 1.0242468896682804, 1.022781531424003, 1.0035336064525309,
+		1.0073492362260024, 1.0153485221403871, 1.0213975574479797, 1.0244148044548624,
+		1.0363044720038406, 1.0500634108162354, 1.0538097688394177, 1.0612026692224596,
+		1.0531274494682719, 1.0490335725414677, 1.0417953524205628, 1.0282490057218572,
+		1.0171424630030821, 1.02553814214119, 1.0389505592742534, 1.0296024675741082,
+		1.0541813687484094, 1.056120899345272, 1.0716727221823443, 1.0689906809663203,
+		1.0699427440663167, 1.0662554041765866, 1.0604682617151415, 1.0491359225473618,
+		1.0392231927959055, 1.0390368322555155, 1.0334712176272871, 1.0445056051601898,
+		1.0551276501591556, 1.0635201313352813, 1.0804923152503014, 1.0858565883901641,
+		1.089856912205452, 1.0801769694968739, 1.0714840007367512, 1.0660927521042054,
+		1.0535509612912397, 1.0524177343785543, 1.0552000348573269, 1.0611962287638037,
+		1.0622173914544435, 1.070292984518995, 1.0873096808574707, 1.0926395763225936,
+		1.1042245553580408, 1.0897634778368204, 1.0836796974096707, 1.0799173748824511,
+		1.0627208000510093, 1.0610277114557793, 1.0556844942615762, 1.0622688713260424,
+		1.0711419399653397, 1.0809409972476025, 1.0799579129084624, 1.095649764438434,
+		1.1132615025713966, 1.1070790123904866, 1.099458041479334, 1.0887492899529012,
+		1.0843803108577417, 1.0721707022116189, 1.0751663183590976, 1.0690066933466207,
+		1.0727550384792881, 1.0814557440691863, 1.0968297573045711, 1.1015487469549263,
+		1.1121355928710051, 1.1009103871564516, 1.1068037836539995, 1.1108015181753301,
+		1.0914843564085366, 1.0895364260408655, 1.0807896116942097, 1.074880599294771,
+		1.0695380290668242, 1.0823139005756617, 1.085062969936331, 1.1030053142796594,
+		1.1040933092876095, 1.126484091168914, 1.1097683262678553, 1.1096404265049249,
+		1.1001545026867869, 1.0979533539755801, 1.0881230223071334, 1.0857432748647724,
+		1.0816612744816532, 1.084750036856799, 1.0899515872019045, 1.0996961151899189,
+		1.1049607661137446, 1.1123724867420743, 1.1226250219402438, 1.1243906911830237,
+		1.1117178949054387, 1.1104681234212026, 1.0898124923668042, 1.0835406555146376,
+		1.0753975794926556, 1.073784618356497, 1.0799034026905237, 1.0933536547661753,
+		1.1039042069617706, 1.1090412046414992, 1.1214680262581445, 1.1180735071377197,
+		1.1159924349520971, 1.1038452350172723, 1.1010094570727478, 1.0941484454327219,
+		1.0926319110144092, 1.0810637246617716, 1.0742383962535638, 1.0802882347351201,
+	};
+	static constexpr double ButterBandpass10Expected[] = {
+		-0.0095715241595057694, -0.0082873698998867547, -0.0069826999231822322, -0.005659014062970427,
+		-0.0043178308749587252, -0.0029606838645517951, -0.0015891177285403124, -0.00020468462419117586,
+		0.0011910595213224882, 0.0025965586486022332, 0.0040102601386970173, 0.0054306183091163401,
+		0.006856097822036309, 0.0082851769940916337, 0.0097163509977239836, 0.011148134944672388,
+		0.012579066842843614, 0.014007710418487408, 0.015432657796317924, 0.016852532030961907,
+		0.018265989483866957, 0.019671722040560696, 0.021068459163905536, 0.022454969779739081,
+		0.02383006399202316, 0.025192594625344601, 0.026541458593319647, 0.027875598092152443,
+		0.029194001619287875, 0.030495704817779606, 0.031779791147662911, 0.033045392386273631,
+		0.034291688960084513, 0.03551791011123296, 0.03672333390248482, 0.037907287064914329,
+		0.039069144693077887, 0.040208329792919786, 0.041324312688073468, 0.042416610290616115,
+		0.043484785242701614, 0.04452844493583806, 0.045547240414893157, 0.046540865174201355,
+		0.047509053853407028, 0.048451580840904264, 0.049368258792920991, 0.050258937076439039,
+		0.051123500144241454, 0.051961865850434906, 0.052773983714811214, 0.053559833144394414,
+		0.054319421620473735, 0.055052782859353423, 0.055759974954961634, 0.056441078511352626,
+		0.057096194773007973, 0.057725443760690255, 0.058328962420422431, 0.058906902792955462,
+		0.059459430210844537, 0.059986721529981843, 0.06048896340213418, 0.060966350594710582,
+		0.061419084363644398, 0.061847370884919289, 0.062251419749906445, 0.06263144252931202,
+		0.062987651410161882, 0.063320257909874667, 0.063629471671091523, 0.063915499340538903,
+		0.064178543534797794, 0.064418801895436639, 0.064636466235538689, 0.064831721779220336,
+		0.065004746495300691, 0.065155710525850064, 0.065284775709921042, 0.065392095202353132,
+		0.065477813187143033, 0.065542064684485063, 0.065584975450208804, 0.065606661965969537,
+		0.065607231518180389, 0.065586782363310045, 0.065545403976809982, 0.065483177382580526,
+		0.065400175559542834, 0.065296463921557898, 0.065172100866631333, 0.06502713839106658,
+		0.064861622763983467, 0.064675595257400798, 0.06446909292688921, 0.064242149437628737,
+		0.063994795930549839, 0.063727061923095213, 0.063438976239010986, 0.06313056796146288,
+		0.062801867403678491, 0.062452907091247629, 0.062083722750172328, 0.061694354294751307,
+		0.061284846809412805, 0.060855251518673902, 0.060405626739501166, 0.059936038810471444,
+		0.05944656299227695, 0.058937284334279999, 0.058408298501995914, 0.057859712560566677,
+		0.057291645709485001, 0.056704229964041251, 0.056097610779199308, 0.055471947611866225,
+		0.054827414417806829, 0.05416420007976995, 0.053482508763734463, 0.052782560200547259,
+		0.052064589890604175, 0.051328849229612547, 0.050575605553864214, 0.049805142103835867,
+		0.049017757905318246, 0.048213767567657377, 0.047393500999072247, 0.046557303039397931,
+		0.045705533010993643, 0.044838564188953406, 0.043956783192160578, 0.043060589297132218,
+		0.042150393676998452, 0.041226618568349367, 0.040289696369051692, 0.039340068670484979,
+		0.038378185227971678, 0.037404502873476908, 0.036419484374934509, 0.035423597246819691,
+		0.034417312516837897, 0.033401103453836102, 0.032375444262266739, 0.031340808748742607,
+		0.030297668966409508, 0.029246493843027112, 0.028187747798783129, 0.027121889359967673,
+		0.026049369774703242, 0.024970631636962226, 0.023886107525111742, 0.022796218661210794,
+		0.021701373597252379, 0.020601966934498388, 0.019498378082000549, 0.018390970060335986,
+		0.017280088356509168, 0.016166059835878009, 0.015049191716846787, 0.013929770613927417,
+		0.012808061654601697, 0.011684307675220711, 0.010558728500955759, 0.0094315203145727833,
+		0.0083028551185440162, 0.0071728802947416143, 0.0060417182656818964, 0.0049094662610068597,
+		0.0037761961926009932, 0.0026419546414431696, 0.0015067629589814065, 0.00037061748548848118,
+		-0.00076651011249411274, -0.0019046723838883686, -0.0030439455126447124, -0.0041844286142047084,
+		-0.0053262429083465006, -0.0064695307683242369, -0.0076144546466404492, -0.008761195878217061,
+		-0.009909953362155605, -0.011060942123703187, -0.012214391758472311, -0.013370544761405461,
+		-0.01452965474343372, -0.015691984539255553, -0.016857804210156795, -0.018027388946303853,
+		-0.019201016873463324, -0.020378966769626933, -0.021561515697542586, -0.022748936559665249,
+		-0.023941495582539735, -0.025139449738109602, -0.026343044109911739, -0.027552509212566401,
+		-0.028768058273408951, -0.02998988448553426, -0.031218158241935551, -0.032453024360814639,
+		-0.033694599312512882, -0.034942968458854334, -0.03619818331599655, -0.037460258852143401,
+		-0.038729170831682931, -0.0400048532174717, -0.041287195643095694, -0.04257604096700035,
+		-0.043871182920401652, -0.045172363860870569, -0.046479272643425211, -0.047791542620868786,
+		-0.049108749784975578, -0.05043041105994632, -0.051755982759324193, -0.053084859217277028,
+		-0.054416371604805676, -0.055749786941030943, -0.057084307309241987, -0.058419069286862316,
+		-0.059753143597909612, -0.061085534995900165, -0.062415182384482487, -0.063740959182382179,
+		-0.065061673938501555, -0.06637607120224287, -0.06768283265330928, -0.068980578494380052,
+		-0.070267869109153183, -0.071543206987299754, -0.072805038916882087, -0.074051758443760288,
+		-0.075281708596456692, -0.076493184873874742, -0.077684438492186425, -0.078853679886117453,
+		-0.079999082458775628, -0.081118786573087492, -0.082210903776832503, -0.083273521252190924,
+		-0.084304706479651825, -0.085302512105061387, -0.086264980997532104, -0.087190151484885986,
+		-0.088076062752277529, -0.088920760388642703, -0.089722302064660087, -0.090478763324995201,
+		-0.09118824347673779, -0.091848871555134923, -0.092458812346974575, -0.093016272451281912,
+		-0.093519506356355461, -0.093966822511592843, -0.094356589372039099, -0.094687241393140581,
+		-0.094957284952810569, -0.095165304177619051, -0.095309966649716138, -0.095390028970993912,
+		-0.095404342160992792, -0.095351856865166992, -0.0952316283503431, -0.09504282126453352,
+		-0.094784714138700057, -0.094456703608601991, -0.094058308335504007, -0.093589172605263532,
+		-0.093049069586165892, -0.092437904226830805, -0.091755715776578511, -0.091002679911820233,
+		-0.090179110453325786, -0.089285460660620944, -0.088322324091271637, -0.087290435014417231,
+		-0.086190668369610909, -0.085024039263801254, -0.083791702001138058, -0.082494948642196059,
+		-0.081135207091177039, -0.079714038711667767, -0.078233135473593243, -0.07669431663610829,
+		-0.075099524973310766, -0.073450822551828249, -0.071750386071518762, -0.070000501782719771,
+		-0.068203559995663396, -0.066362049199830353, -0.064478549813120845, -0.062555727582759152,
+		-0.060596326661802327, -0.058603162386976534, -0.056579113785303413, -0.054527115838592689,
+		-0.052450151536353358, -0.050351243749002961, -0.048233446954419314, -0.046099838851863702,
+		-0.043953511898091095, -0.041797564801028884, -0.039635094006732152, -0.037469185215394475,
+		-0.035302904962003251, -0.033139292296781156, -0.030981350599864888, -0.028832039563758332,
+		-0.026694267375982208, -0.024570883133046787, -0.02246466951541936, -0.020378335751561078,
+		-0.018314510897383195, -0.016275737455634681, -0.01426446535779366, -0.012283046329006207,
+		-0.010333728654511095, -0.0084186523638234423, -0.0065398448467398722, -0.004699216912991782,
+		-0.0028985593051293231, -0.0011395396719853963, 0.00057629999213878319, 0.0022475454395940175,
+		0.0038729117919582071, 0.0054512446942829584, 0.0069815210042389123, 0.0084628490213371071,
+		0.0098944682632897824, 0.011275748798391994, 0.012606190144548231, 0.013885419747228237,
+		0.015113191050203062, 0.016289381174375773, 0.017413988221372738, 0.018487128219793876,
+		0.019509031733130365, 0.020480040149346457, 0.021400601672990842, 0.022271267041457064,
+		0.023092684987656265, 0.023865597471901756, 0.024590834706235264, 0.025269309994748336,
+		0.025902014413668226, 0.02649001135508422, 0.027034430958185744, 0.027536464451768324,
+		0.027997358431539304, 0.028418409095427279, 0.028800956459674121, 0.029146378577976289,
+		0.029456085785351967, 0.029731514987751863, 0.02997412401771176, 0.030185386075571641,
+		0.030366784274960906, 0.030519806310377137, 0.030645939263765267, 0.030746664566038018,
+		0.030823453128467914, 0.030877760657831252, 0.030911023168101379, 0.030924652700380421,
+		0.030920033261636681, 0.030898516991687407, 0.030861420566743028, 0.030810021846716135,
+		0.030745556772397781, 0.030669216517517774, 0.030582144899633189, 0.030485436052729162,
+		0.03038013236336759, 0.030267222671185253, 0.030147640733524859, 0.030022263952987509,
+		0.029891912365727972, 0.029757347887383989, 0.029619273812641417, 0.029478334563594919,
+		0.029335115681269751, 0.029190144053924047, 0.029043888375050533, 0.028896759823338343,
+		0.0287491129562365, 0.02860124680817815, 0.028453406183980467, 0.028305783137430197,
+		0.028158518624605108, 0.028011704321071255, 0.027865384591739564, 0.027719558601865989,
+		0.027574182557437796, 0.027429172063002848, 0.027284404584865498, 0.027139722007485476,
+		0.026994933270869551, 0.026849817076734627, 0.026704124651241657, 0.026557582552152573,
+		0.026409895508348907, 0.026260749279774211, 0.026109813526027259, 0.025956744672040871,
+		0.025801188759533401, 0.025642784273214318, 0.025481164931057416, 0.025315962428319825,
+		0.025146809125374699, 0.024973340669834282, 0.024795198543863362, 0.024612032528017806,
+		0.024423503073389856, 0.024229283574302356, 0.024029062534272488, 0.023822545618465654,
+		0.023609457586383536, 0.023389544099077821, 0.02316257339574913, 0.022928337835173996,
+		0.022686655297994299, 0.022437370446496095, 0.022180355839092385, 0.021915512897304132,
+		0.021642772723604042, 0.021362096769050504, 0.021073477350195876, 0.020776938015307955,
+		0.020472533760496691, 0.020160351096890749, 0.019840507970558405, 0.019513153537410038,
+		0.019178467795848954, 0.018836661080447074, 0.018487973420406208, 0.018132673767021552,
+		0.017771059094790261, 0.017403453381207648, 0.017030206470669721, 0.016651692828258489,
+		0.016268310189530136, 0.015880478112757342, 0.015488636440397188, 0.015093243676862227,
+		0.014694775289960648, 0.014293721943635554, 0.013890587669867824, 0.013485887987806753,
+		0.013080147978355999, 0.012673900322569572, 0.012267683312306136, 0.011862038841653794,
+		0.011457510387675658, 0.011054640989042321, 0.01065397123111205, 0.010256037245992387,
+		0.0098613687360645259, 0.0094704870293706514, 0.0090839031751496057, 0.0087021160876541576,
+		0.0083256107461909135, 0.0079548564590914972, 0.0075903051990525031, 0.0072323900169763023,
+		0.0068815235411105301, 0.0065380965679268134, 0.006202476750803659, 0.0058750073921870708,
+		0.0055560063444951777, 0.0052457650246077233, 0.0049445475463339595, 0.0046525899747799681,
+		0.0043700997060365319, 0.0040972549750810886, 0.0038342044942339761, 0.0035810672239335773,
+		0.0033379322770023083, 0.0031048589569710235, 0.0028818769304185575, 0.0026689865326696384,
+		0.0024661592055801574, 0.0022733380655236488, 0.0020904385990746948, 0.0019173494832606752,
+		0.0017539335266196991, 0.0016000287266582241, 0.0014554494386479957, 0.0013199876500428003,
+		0.0011934143541382867, 0.0010754810159516203, 0.0009659211226710734, 0.00086445181042658318,
+		0.00077077555856620503, 0.00068458194209286137, 0.00060554943242105571, 0.00053334723615295959,
+		0.00046763716114592622, 0.00040807549874828143, 0.00035431491071811013, 0.00030600630901342926,
+	};
+
+	static constexpr double ButterBandpass50Sections[] = {
+		5.6778981327113072e-12, 1.1355796265422614e-11, 5.6778981327113072e-12, -1.9837770437500539,
+		0.98389995113708562, 1, 2, 1,
+		-1.9935281775522, 0.99368143392196373, 1, 0,
+		-1, -1.9887380399411563, 0.98875374265802374, 1,
+		-2, 1, -1.9979315365108101, 0.99793354699266512,
+		1, -2, 1, -1.9993475239799423,
+		0.99934914541669351,
+	};
+	static constexpr double ButterBandpass50InitialConditions[] = {
+		1.8478055081738478e-07, -1.8180548350587127e-07, 0.004822746332401236, -0.0047922723234383562,
+		-0.0048229311186353983, -0.0048229311186218059, -0, 0,
+		-0, 0,
+	};
+	static constexpr double ButterBandpass50Input[] = {
+		0.49559963517566191, 0.50255404297789275, 0.51011752236019448, 0.50496488783017912,
+		0.50378389368106546, 0.50306095798863049, 0.51105799484095882, 0.51708176347593771,
+		0.51790442556230798, 0.5287344672781038, 0.51587667911335378, 0.52086892284164821,
+		0.51895208141550619, 0.52049439725840285, 0.52577173786681097, 0.52686066291026779,
+		0.51694083374246158, 0.52547528387289388, 0.52779970015280808, 0.52863530649024371,
+		0.5176191860187076, 0.52501685057449021, 0.52191852073763767, 0.51703931625130384,
+		0.52872160633810328, 0.52251136731155134, 0.52845540670249658, 0.524310296087237,
+		0.51777760045705246, 0.51743121340499054, 0.52213169829756001, 0.50689693734163321,
+		0.50269664689494542, 0.50593475466189952, 0.50306780278961494, 0.4943364818991457,
+		0.50760258833432803, 0.50361254659704102, 0.50179843095421373, 0.50206767836258082,
+		0.50296827726878601, 0.49553274942297565, 0.50879350818986546, 0.49743408699713759,
+		0.49858897860404372, 0.49538205533948648, 0.50018640422638028, 0.4998282188660268,
+		0.49309976566756697, 0.49840542471463123, 0.50605892971570399, 0.50624488956259528,
+		0.51232273927442484, 0.50186956458748622, 0.51665097110634639, 0.49625239059331994,
+		0.51428579103210559, 0.51410186252655277, 0.51476942475348719, 0.51619497538951076,
+		0.5156328212793817, 0.52104955953488263, 0.52057867141953273, 0.52554384472237603,
+		0.53324341523920749, 0.53455818762638863, 0.52365493850958333, 0.54378598253056076,
+		0.53731548961288811, 0.53877371963085985, 0.53405931285744257, 0.53696998381121608,
+		0.53951322204017937, 0.54496634453570014, 0.54011668619403819, 0.53526536008490933,
+		0.55474728429958953, 0.54323009070694506, 0.54782138017425897, 0.55591568884309028,
+		0.55639668474884207, 0.55308269908648189, 0.54646305196603084, 0.55112906224371017,
+		0.54642090937861598, 0.54738310776417864, 0.54401518726924314, 0.54895344154370407,
+		0.54488424849804662, 0.53368441410982392, 0.54201346392017247, 0.54158161933215154,
+		0.53925071227106847, 0.54378639914930649, 0.54114117513849946, 0.53033788734764931,
+		0.52669200091761503, 0.52218577479433304, 0.52235737096906643, 0.52876913481273291,
+		0.53304207632554512, 0.51600957245832446, 0.52041330247343565, 0.52270178624296948,
+		0.52631052863230121, 0.52573036122160965, 0.51405265303291414, 0.51938450960431493,
+		0.51427678684450506, 0.51988713572227618, 0.5314126891902593, 0.528017368316964,
+		0.51581863332976463, 0.51759167147411489, 0.51735465087268562, 0.52153821745528395,
+		0.52660005723974135, 0.53437899039158543, 0.53289579058941716, 0.53056107712973566,
+		0.53320473212827701, 0.53649900465943356, 0.54276771681325675, 0.53721154110667435,
+		0.53897150717779518, 0.54467696751771655, 0.55012253363727759, 0.55638256515260398,
+		0.5499226708875673, 0.56350929165478525, 0.55602576441927809, 0.55323614981676406,
+		0.55101838799920611, 0.56238902202930996, 0.56255814881234745, 0.56677762671573551,
+		0.56603317027068378, 0.56504548959127687, 0.56409368693035478, 0.56935286681241937,
+		0.57764926905144265, 0.57215046321682905, 0.57844752536085442, 0.5687826440683359,
+		0.57247866893376609, 0.56547766303915803, 0.57590362464238198, 0.56095111845888979,
+		0.56635828225631846, 0.57541256025245069, 0.57117061590077778, 0.56989705795522194,
+		0.55986674875981046, 0.56450491213952259, 0.56640545926812169, 0.55930545942745846,
+		0.55479018934132907, 0.55921502468213302, 0.55944915549250551, 0.55947448675705658,
+		0.56015563092256748, 0.55306134819848751, 0.54291756514197587, 0.54401056003574444,
+		0.53599642981737727, 0.54688325706400653, 0.54970418170293833, 0.54462129358304701,
+		0.53966970584744356, 0.53952376048790951, 0.54607118225701312, 0.54876035405880419,
+		0.55300725342202106, 0.54401176664247486, 0.53737236689609458, 0.54964659611821787,
+		0.54640726066872292, 0.55686880999273136, 0.55232986121640848, 0.53969849643756962,
+		0.55525799591120406, 0.55208344905994899, 0.55688075478243204, 0.55614529368277676,
+		0.55510298409719694, 0.56183526473300982, 0.56960826982690904, 0.5704140119921014,
+		0.57502207836335562, 0.57406078073523426, 0.57935830656257015, 0.57515930629543055,
+		0.5825207802776925, 0.589872539040599, 0.59073091983769799, 0.58016851277257642,
+		0.58535790014537437, 0.59413232404119132, 0.58846328497505229, 0.58518042574978912,
+		0.59562704500912655, 0.58749024949854844, 0.59051300727601219, 0.59962763967972732,
+		0.59134588367038177, 0.60361376632372865, 0.59737528314415256, 0.60239992621660987,
+		0.58511742094214125, 0.59557406226855247, 0.59952610541276141, 0.5964173428197771,
+		0.59135290432456367, 0.59130007223880754, 0.58525339734428117, 0.58993816008043687,
+		0.57815709015875127, 0.57967906592187246, 0.58005840584334356, 0.58342972581342356,
+		0.58626009580366778, 0.58164141579874717, 0.57645798949452087, 0.56804801796017312,
+		0.57150383595387555, 0.57536703079809526, 0.57772636451249759, 0.56718675155488363,
+		0.56403606754793534, 0.57260526668859346, 0.56813548202692166, 0.56315792091554862,
+		0.5697484883190298, 0.56876086640839241, 0.57121489134448089, 0.5667078650985975,
+		0.56472259447827633, 0.56077663605837325, 0.56902663104456452, 0.57091951297201715,
+		0.57086431260736803, 0.57775667005563458, 0.57809722742790748, 0.58348677068059107,
+		0.57652434038366984, 0.58477298597000704, 0.57998764222293986, 0.59076072816050562,
+		0.5865004804941607, 0.5862056749640262, 0.59247325490717595, 0.59506583557987114,
+		0.59465415050241899, 0.59955400451899377, 0.60654419937319504, 0.6031201519977113,
+		0.59883507613769105, 0.60194610738064969, 0.61279630882903757, 0.60616079269095646,
+		0.61233325179205289, 0.61148371985066474, 0.61057218529359703, 0.60901441207265994,
+		0.61134331109106055, 0.62111273979703918, 0.60434407517205746, 0.61732648215045172,
+		0.61444219415092305, 0.60873780668518385, 0.61514536720851054, 0.6135920484667613,
+		0.62097588221286437, 0.61538431209763222, 0.61404616214657703, 0.61341222751464053,
+		0.60599712858611965, 0.60856587111561466, 0.60532635445298832, 0.60333894999429782,
+		0.61108022003800488, 0.60828337979573521, 0.60151647195121882, 0.59432379327360119,
+		0.59181085386642218, 0.59457624770205708, 0.59625122452091839, 0.59956253922238889,
+		0.58796647141247671, 0.5889493402220376, 0.58131577399800261, 0.58925894837586656,
+		0.57990786586545551, 0.58938825047620824, 0.58467056419321151, 0.59308915003736928,
+		0.58809134558164033, 0.59083499953583984, 0.58022490559803386, 0.58598590230916947,
+		0.68487319224172483, 0.68425402968749627, 0.69009074715107099, 0.69118679315265463,
+		0.69455315458405686, 0.6970068007648077, 0.69689315071420088, 0.70150405995314025,
+		0.6906729345497834, 0.701993607603281, 0.70190033585334577, 0.70786492793727473,
+		0.71311082902516532, 0.70115152275728732, 0.71297182676003357, 0.71064746952794755,
+		0.71696181583146545, 0.72064701861443947, 0.72092602709353715, 0.72960149532426588,
+		0.73313673457278916, 0.72444433101103001, 0.7263743156276129, 0.72877114632965634,
+		0.7240886228513701, 0.72956394471228458, 0.72489635056669233, 0.73215925474419485,
+		0.72910770600912345, 0.74021844457008801, 0.73388093111934727, 0.72890625187387892,
+		0.73154063278586046, 0.73263892804191888, 0.73716031960363659, 0.72952650972269661,
+		0.741733432514038, 0.73266885743958154, 0.72434816518570788, 0.71788838450975068,
+		0.71876149804643252, 0.71686009721490285, 0.71415260500159528, 0.71824853589978099,
+		0.7177861864703371, 0.71800582601534935, 0.71584747657180203, 0.70587865182424969,
+		0.70777131189165665, 0.69834673131949976, 0.71590125573686747, 0.70372722736041438,
+		0.70320329391514869, 0.69979539114465061, 0.70239580980596683, 0.69762131075241196,
+		0.6971439315482556, 0.69922815303922947, 0.70716817473805338, 0.69572830784005757,
+		0.70414511925285239, 0.70602304721424514, 0.7023281286691414, 0.69677648109341983,
+		0.7027549326770437, 0.69967644064838874, 0.70946218435752706, 0.71299522628851641,
+		0.70542888467173703, 0.70981109464785686, 0.71812794339302788, 0.71915231696862958,
+		0.71425489289882871, 0.71697708498109869, 0.72312609296519492, 0.72831145017431453,
+		0.73561680143044594, 0.72972806599009588, 0.73204335581413427, 0.7324516346517751,
+		0.73089140356525606, 0.73176626864759464, 0.73441059549002752, 0.74448933487032432,
+		0.74616414006038834, 0.74056101444520883, 0.74061758415692169, 0.74372059568742166,
+		0.75277682389163314, 0.74775512522536181, 0.74589332838012834, 0.74606433867466582,
+		0.75030118709305671, 0.74218655383362564, 0.74755699169701906, 0.73994293312070347,
+		0.74144286033141082, 0.74836849550870366, 0.7431776419088808, 0.73866345636947206,
+		0.74462970527723227, 0.74204313802248967, 0.73930476423983615, 0.74069537216135528,
+		0.73535709395212856, 0.735551094364022, 0.73140321712304945, 0.73685669744829141,
+		0.73076992491712611, 0.73212526113863019, 0.74072886192754084, 0.73163368293440989,
+		0.72305744730759725, 0.72337797712859742, 0.71312591822051929, 0.71762234986947149,
+		0.71046065946418313, 0.70846768747539834, 0.7152953881655385, 0.70676897712571263,
+		0.71794014195909106, 0.71914638911143292, 0.72504174183483239, 0.71806089705531184,
+		0.71423403276042452, 0.71636997713253747, 0.71516464605830643, 0.71882403210226697,
+		0.71772704304864443, 0.7161551026527101, 0.72625167805613489, 0.72381293619532316,
+		0.72396812072953987, 0.72874328466699256, 0.72367177624073176, 0.73438271593413285,
+		0.74387175057654153, 0.73383310580292616, 0.73366421818441552, 0.74927073430411273,
+		0.74633479563873828, 0.74927562581552098, 0.74326554264587852, 0.75130381437114568,
+		0.75479185994291242, 0.75348917308245844, 0.7560657802784897, 0.7607937579808286,
+		0.74976407290237745, 0.7627322119914195, 0.76063574898026354, 0.76243431857385668,
+		0.76364941830575095, 0.76103810038694342, 0.75217014153343664, 0.75833951586364967,
+		0.76449577857576823, 0.75851385001729243, 0.75086029314264102, 0.74776931530497615,
+		0.75783179534145539, 0.74763194236782493, 0.7478165931212376, 0.75781577308444115,
+		0.75759395465347767, 0.75766364454251611, 0.75100533104687217, 0.74271862801364075,
+		0.73771248979569293, 0.74984661212971782, 0.74109931136268659, 0.73202549970369568,
+		0.73551254574210567, 0.737157765055654, 0.73117383095676514, 0.73443170472417818,
+		0.73057530364592005, 0.73578882721808303, 0.72659431669368046, 0.72458351857600689,
+		0.72759268878483974, 0.72307991826522422, 0.72555229756516249, 0.73713318278753837,
+		0.7271604516753617, 0.72606682347321838, 0.72471274734309898, 0.72502841766345205,
+		0.72337384892650791, 0.73391385382725227, 0.73114361954343532, 0.72217237495294162,
+		0.72976193969798742, 0.7292411630408796, 0.73253676340187091, 0.73630132933673054,
+		0.74182832907077156, 0.74460591145618182, 0.74261804536149578, 0.73971800849375435,
+	};
+	static constexpr double ButterBandpass50Expected[] = {
+		-0.029770093985520107, -0.029759879748151991, -0.029748379477037311, -0.029735596044918541,
+		-0.029721532434754089, -0.029706191739413568, -0.02968957716135915, -0.029671692012313042,
+		-0.029652539712911131, -0.029632123792342886, -0.02961044788797753, -0.029587515744976534,
+		-0.029563331215892486, -0.029537898260254367, -0.029511220944139348, -0.029483303439731063,
+		-0.029454150024864539, -0.029423765082557715, -0.029392153100529721, -0.029359318670705938,
+		-0.02932526648870987, -0.029290001353341956, -0.029253528166045328, -0.029215851930358659,
+		-0.029176977751356126, -0.029136910835074557, -0.029095656487927831, -0.0290532201161087,
+		-0.029009607224977946, -0.02896482341844114, -0.028918874398312956, -0.028871765963669121,
+		-0.02882350401018622, -0.028774094529469305, -0.02872354360836744, -0.028671857428277311,
+		-0.028619042264434909, -0.028565104485195506, -0.028510050551301895, -0.028453887015141049,
+		-0.028396620519989337, -0.0283382577992463, -0.028278805675657197, -0.028218271060524287,
+		-0.028156660952907149, -0.028093982438811959, -0.028030242690369907, -0.027965448965004917,
+		-0.027899608604590672, -0.027832729034597135, -0.027764817763226698, -0.027695882380539945,
+		-0.027625930557571333, -0.027554970045434727, -0.027483008674419065, -0.027410054353074153,
+		-0.027336115067286768, -0.027261198879347227, -0.02718531392700644, -0.027108468422523672,
+		-0.027030670651705127, -0.026951928972933432, -0.026872251816188176, -0.026791647682057659,
+		-0.026710125140741968, -0.026627692831047479, -0.026544359459372956, -0.026460133798687391,
+		-0.026375024687499717, -0.026289041028820459, -0.026202191789115561, -0.026114485997252437,
+		-0.026025932743438535, -0.025936541178152358, -0.025846320511067212, -0.025755280009967799,
+		-0.025663428999659749, -0.025570776860872332, -0.025477333029154395, -0.025383106993763754,
+		-0.02528810829655008, -0.025192346530831539, -0.025095831340265298, -0.024998572417711973,
+		-0.0249005795040943, -0.024801862387250063, -0.024702430900779462, -0.024602294922887138,
+		-0.024501464375218877, -0.024399949221693279, -0.024297759467328466, -0.024194905157064003,
+		-0.024091396374578182, -0.023987243241100832, -0.023882455914221768, -0.023777044586695141,
+		-0.023671019485239742, -0.023564390869335407, -0.023457169030015781, -0.023349364288657522,
+		-0.023240986995766103, -0.023132047529758424, -0.023022556295742319, -0.022912523724293209,
+		-0.022801960270227954, -0.022690876411376147, -0.022579282647348979, -0.02246718949830584,
+		-0.022354607503718833, -0.022241547221135326, -0.022128019224938737, -0.022014034105107716,
+		-0.02189960246597385, -0.021784734924978105, -0.021669442111426143, -0.021553734665242678,
+		-0.021437623235725012, -0.021321118480296001, -0.021204231063256498, -0.021086971654537528,
+		-0.020969350928452309, -0.020851379562448334, -0.020733068235859624, -0.020614427628659372,
+		-0.020495468420213089, -0.02037620128803248, -0.020256636906530134, -0.02013678594577532,
+		-0.020016659070250888, -0.019896266937611613, -0.019775620197444017, -0.01965472949002792,
+		-0.019533605445099831, -0.019412258680618369, -0.019290699801531905, -0.019168939398548541,
+		-0.01904698804690861, -0.018924856305159901, -0.018802554713935719, -0.01868009379473598,
+		-0.018557484048711499, -0.018434735955451618, -0.018311859971775375, -0.01818886653052634,
+		-0.018065766039371312, -0.017942568879603032, -0.017819285404947059, -0.017695925940373003,
+		-0.017572500780910254, -0.01744902019046839, -0.017325494400662379, -0.017201933609642815,
+		-0.017078347980931274, -0.016954747642261011, -0.016831142684423112, -0.016707543160118288,
+		-0.016583959082814442, -0.016460400425610228, -0.0163368771201047, -0.016213399055273227,
+		-0.016089976076349849, -0.015966617983716232, -0.015843334531797336, -0.015720135427964001,
+		-0.015597030331442567, -0.015474028852231743, -0.015351140550026829, -0.015228374933151437,
+		-0.015105741457496911, -0.014983249525469545, -0.014860908484945826, -0.01473872762823576,
+		-0.014616716191054511, -0.014494883351502464, -0.014373238229053889, -0.014251789883554286,
+		-0.014130547314226678, -0.014009519458686882, -0.013888715191967993, -0.013768143325554172,
+		-0.013647812606423887, -0.013527731716102805, -0.013407909269726424, -0.013288353815112595,
+		-0.013169073831844093, -0.013050077730361388, -0.012931373851065731, -0.012812970463432697,
+		-0.012694875765136343, -0.0125770978811841, -0.012459644863062561, -0.012342524687894254,
+		-0.012225745257605593, -0.012109314398106093, -0.011993239858479009, -0.011877529310183517,
+		-0.011762190346268579, -0.011647230480598606, -0.01153265714709106, -0.011418477698966098,
+		-0.011304699408008441, -0.011191329463841522, -0.01107837497321407, -0.010965842959299253,
+		-0.0108537403610065, -0.010742074032306105, -0.010630850741566748, -0.010520077170906045,
+		-0.010409759915554231, -0.010299905483231096, -0.010190520293536297, -0.010081610677353142,
+		-0.0099731828762659458, -0.0098652430419910887, -0.0097577972358218659, -0.0096508514280872447,
+		-0.009544411497624616, -0.0094384832312666492, -0.009333072323342349, -0.0092281843751924296,
+		-0.0091238248946990536, -0.0090199992958300869, -0.0089167128981979191, -0.0088139709266329587,
+		-0.0087117785107719038, -0.0086101406846608511, -0.0085090623863733356, -0.0084085484576434007,
+		-0.0083086036435137522, -0.0082092325919991115, -0.0081104398537648163, -0.0080122298818207545,
+		-0.00791460703123072, -0.0078175755588372371, -0.0077211396230019574, -0.007625303283361657,
+		-0.0075300705005999415, -0.0074354451362346882, -0.0073414309524213236, -0.0072480316117719754,
+		-0.0071552506771905477, -0.0070630916117238023, -0.0069715577784284916, -0.0068806524402545864,
+		-0.0067903787599446572, -0.0067007397999494529, -0.0066117385223597282, -0.0065233777888543606,
+		-0.0064356603606647985, -0.006348588898555876, -0.0062621659628230332, -0.0061763940133059804,
+		-0.0060912754094188332, -0.0060068124101967492, -0.0059230071743590932, -0.0058398617603891518,
+		-0.0057573781266304289, -0.0056755581313995222, -0.0055944035331156215, -0.0055139159904466191,
+		-0.0054340970624718668, -0.0053549482088615617, -0.0052764707900727825, -0.0051986660675621809,
+		-0.005121535204015315, -0.0050450792635926365, -0.004969299212192105, -0.0048941959177284423,
+		-0.004819770150429001, -0.0047460225831462378, -0.0046729537916867661, -0.004600564255156976,
+		-0.0045288543563251817, -0.0044578243820002882, -0.0043874745234269361, -0.0043178048766970845,
+		-0.0042488154431779999, -0.0041805061299566145, -0.0041128767503002045, -0.0040459270241333311,
+		-0.0039796565785310163, -0.0039140649482280751, -0.0038491515761445625, -0.0037849158139272622,
+		-0.0037213569225071582, -0.0036584740726728223, -0.0035962663456596319, -0.0035347327337547614,
+		-0.0034738721409178549, -0.0034136833834172934, -0.0033541651904819805, -0.0032953162049685495,
+		-0.003237134984043898, -0.0031796199998829467, -0.0031227696403815291, -0.0030665822098842966,
+		-0.0030110559299275329, -0.0029561889399967634, -0.0029019792982990398, -0.0028484249825497746,
+		-0.0027955238907740061, -0.0027432738421219543, -0.0026916725776987387, -0.0026407177614081135,
+		-0.0025904069808100811, -0.0025407377479922332, -0.0024917075004546674, -0.0024433136020083224,
+		-0.0023955533436865704, -0.002348423944669898, -0.0023019225532235114, -0.0022560462476476856,
+		-0.0022107920372406767, -0.0021661568632740189, -0.0021221375999800119, -0.0020787310555512089,
+		-0.0020359339731517035, -0.0019937430319400158, -0.0019521548481033673, -0.0019111659759031329,
+		-0.0018707729087312545, -0.0018309720801773944, -0.0017917598651065985, -0.0017531325807472451,
+		-0.0017150864877890336, -0.0016776177914907826, -0.0016407226427977884, -0.0016043971394684897,
+		-0.0015686373272101926, -0.0015334392008235914, -0.0014987987053558215, -0.0014647117372617814,
+		-0.0014311741455734456, -0.0013981817330768961, -0.0013657302574967875, -0.0013338154326879657,
+		-0.0013024329298339423, -0.0012715783786519401, -0.0012412473686042036, -0.0012114354501152787,
+		-0.00118213813579495, -0.0011533509016665295, -0.00112506918840018, -0.0010972884025509577,
+		-0.0010700039178012514, -0.0010432110762072903, -0.0010169051894493985, -0.00099108154008565761,
+		-0.00096573538280864395, -0.00094086194570490152, -0.00091645643151681052, -0.00089251401890650349,
+		-0.00086902986372148236, -0.00084599910026158468, -0.00082341684254694648, -0.00080127818558660402,
+		-0.00077957820664737592, -0.00075831196652266454, -0.00073747451080081246, -0.00071706087113264827,
+		-0.00069706606649785289, -0.00067748510446977682, -0.0006583129824783363, -0.00063954468907061407,
+		-0.00062117520516879023, -0.00060319950532502543, -0.00058561255897291884, -0.00056840933167516051,
+		-0.0005515847863669976, -0.00053513388459513426, -0.00051905158775168031, -0.00050333285830276718,
+		-0.00048797266101144646, -0.00047296596415448623, -0.00045830774073268285, -0.00044399296967429983,
+		-0.00043001663703125199, -0.00041637373716764837, -0.00040305927394030988, -0.00039006826187087745,
+		-0.00037739572730912719, -0.00036503670958710962, -0.00035298626216373024, -0.00034123945375939141,
+		-0.00032979136948031506, -0.00031863711193216686, -0.00030777180232260623, -0.0002971905815523851,
+		-0.00028688861129462279, -0.00027686107506188454, -0.00026710317926069448, -0.00025761015423311475,
+		-0.00024837725528502737, -0.00023939976370075477, -0.00023067298774366135, -0.00022219226364237818,
+		-0.00021395295656229861, -0.00020595046156199378, -0.00019818020453420289, -0.00019063764313105434,
+		-0.00018331826767318014, -0.00017621760204238827, -0.00016933120455756218, -0.00016265466883346301,
+		-0.00015618362462211204, -0.00014991373863643771, -0.00014384071535587562, -0.00013796029781361574,
+		-0.00013226826836519609, -0.00012676044943814814, -0.00012143270426240524, -0.00011628093758119075,
+		-0.00011130109634210901, -0.00010648917036816936, -0.00010184119300847955, -9.7353241768351759e-05,
+		-9.3021438918571521e-05, -8.8841952083587464e-05, -8.4810994808386732e-05, -8.0924827103829125e-05,
+		-7.7179755970220614e-05, -7.357213589891489e-05, -7.0098369351740319e-05, -6.675490721805779e-05,
+		-6.35382492492634e-05, -6.0444944470559452e-05, -5.747159156982632e-05, -5.4614839263436162e-05,
+		-5.18713866388601e-05, -4.9237983473928892e-05, -4.6711430532618603e-05, -4.4288579837241461e-05,
+		-4.1966334916933248e-05, -3.9741651032338199e-05, -3.7611535376404264e-05, -3.5573047251211359e-05,
+		-3.3623298220766732e-05, -3.1759452239712955e-05, -2.9978725757905569e-05, -2.8278387800828128e-05,
+		-2.6655760025825252e-05, -2.5108216754146171e-05, -2.3633184978803104e-05, -2.2228144348261559e-05,
+		-2.0890627125991499e-05, -1.961821812592189e-05, -1.8408554623853785e-05, -1.7259326244900187e-05,
+		-1.6168274827034799e-05, -1.5133194260844165e-05, -1.4151930305592033e-05, -1.3222380381719073e-05,
+		-1.234249333991452e-05, -1.1510269206910734e-05, -1.0723758908166111e-05, -9.9810639676165683e-06,
+		-9.2803361846901708e-06, -8.6197772887948962e-06, -7.9976385715046899e-06, -7.412220496683524e-06,
+		-6.8618722888038696e-06, -6.3449914997311139e-06, -5.8600235542605731e-06, -5.4054612747114078e-06,
+		-4.9798443848960154e-06, -4.5817589938020433e-06, -4.2098370593388299e-06, -3.862755832518033e-06,
+		-3.5392372824542208e-06, -3.2380475025888496e-06, -2.9579960985580705e-06, -2.6979355581428272e-06,
+		-2.4567606037561127e-06, -2.2334075279404738e-06, -2.0268535123670655e-06, -1.8361159308455143e-06,
+		-1.6602516368715534e-06, -1.4983562362584685e-06, -1.3495633454160853e-06, -1.2130438358601983e-06,
+		-1.0880050655539511e-06, -9.7369009770138782e-07, -8.6937690763314344e-07, -7.7437757844277433e-07,
+		-6.8803748605174678e-07, -6.0973447440049705e-07, -5.3887802148248059e-07, -4.7490839695827602e-07,
+		-4.1729581210608792e-07, -3.655395628852403e-07, -3.1916716690901036e-07, -2.777334951438297e-07,
+		-2.4081989917157395e-07, -2.0803333487206239e-07, -1.7900548340377064e-07, -1.5339187038093661e-07,
+		-1.3087098416627988e-07, -1.1114339421861659e-07, -9.3930870455850025e-08, -7.8975504614904792e-08,
+	};
+
+	static constexpr double ButterHighpass50Sections[] = {
+		0.99373650235398747, -0.99373650235398747, 0, -0.99373647154161471,
+		0, 1, -2, 1,
+		-1.9936971785141078, 0.99373653316636057,
+	};
+	static constexpr double ButterHighpass50InitialConditions[] = {
+		-0.99373650235399091, 0, -0, 0,
+	};
+	static constexpr double ButterHighpass50Input[] = {
+		0.496526853936677, 0.50928162059434212, 0.50360622697819635, 0.50965666277409183,
+		0.50600530433499002, 0.51345794402114697, 0.51503123422864383, 0.51828760914255201,
+		0.51846757452922998, 0.52308162260838997, 0.51751978318378344, 0.52139557183030694,
+		0.52515486189344551, 0.52625594026907008, 0.51838286513496246, 0.5382384297516567,
+		0.53034847661564211, 0.52179834634764177, 0.52949020379052703, 0.53570541339551203,
+		0.52575693610958896, 0.51786516425089979, 0.52843340522123661, 0.52526315961154368,
+		0.52212948260027325, 0.53123763270197799, 0.51466109688229622, 0.51872141335573563,
+		0.51058473740851007, 0.52262463375104262, 0.52038141897711088, 0.50329299820654638,
+		0.51890955733908883, 0.50650692093037553, 0.51131578556975144, 0.51637515378253052,
+		0.50192159610068721, 0.49717618417687909, 0.5029130268928842, 0.5076302043578077,
+		0.50207638298709456, 0.49747261976628288, 0.50275954200504702, 0.50021577207246015,
+		0.49216382293092004, 0.50096504578660794, 0.50549684768909375, 0.49457793739111894,
+		0.50183360083446116, 0.49851039597958718, 0.50184918805223666, 0.50692529845930068,
+		0.50953887237480733, 0.50852414893376885, 0.50948258260133783, 0.51282941828050621,
+		0.51660518456775451, 0.51300948712365513, 0.51143075877714628, 0.51063204661728601,
+		0.52085203502162869, 0.52291938321896825, 0.53395210208601507, 0.52435063318800446,
+		0.53451389615776379, 0.53399834229005827, 0.52960802402742657, 0.5281156367158758,
+		0.52995514533975763, 0.54283153415186969, 0.54032091413600392, 0.54727212032305583,
+		0.54441003811366062, 0.54701869030903949, 0.55306406238288175, 0.542898393520582,
+		0.54155208729407878, 0.54938129464877583, 0.54035553108721734, 0.55021521467719681,
+		0.54869461662319352, 0.55550335884498514, 0.55090083359283459, 0.54743707004912423,
+		0.5491426630845917, 0.53655215845524062, 0.55141866477071511, 0.54796675415693252,
+		0.54057154116606476, 0.54696645877925987, 0.53437351110418652, 0.53594765420812629,
+		0.5396245454923374, 0.52926586835406741, 0.53322988247824998, 0.52984755683618312,
+		0.53716808240198877, 0.54142522247952085, 0.53778749078421906, 0.53447606383598534,
+		0.53742091617941201, 0.52683890177624459, 0.52877616552903506, 0.51909744010058556,
+		0.51919684716857195, 0.52260471768731032, 0.51824092565780722, 0.52360640876682563,
+		0.52115177267624269, 0.52458876513351593, 0.51727474263588724, 0.52436873547049478,
+		0.52546043894943562, 0.52974383822254334, 0.52561124972848527, 0.51506247979405806,
+		0.52232354241316237, 0.53700342484212871, 0.52564987013691078, 0.53424561848560426,
+		0.53645704749837742, 0.54175810453380524, 0.54148583494116931, 0.55516188207239947,
+		0.54607086671011806, 0.53913753306745649, 0.55376292941133198, 0.54107429393665241,
+		0.55972091503749033, 0.55713941130713296, 0.55516798212735918, 0.55459310082250335,
+		0.57008322516310472, 0.5608105879881552, 0.56586181334754071, 0.56367328775645054,
+		0.57068734150883726, 0.56583807718167178, 0.57938829928591684, 0.57219402695820776,
+		0.57325924439871356, 0.57055229316245082, 0.56930900044890775, 0.57139223497692815,
+		0.57283578289303438, 0.57301238380104369, 0.57295858022948931, 0.56938441416099728,
+		0.57160114205150803, 0.57766139850517551, 0.56770962654755031, 0.56369205182242499,
+		0.56069536799450559, 0.56729660385147573, 0.56816158627098423, 0.55588534556479052,
+		0.5548571193762033, 0.55708935174285112, 0.56757485749205028, 0.5548574905404402,
+		0.53762763207153674, 0.54689924633901621, 0.54519452034633908, 0.54395671950389868,
+		0.54465903712826935, 0.54808617860660647, 0.54728593165892636, 0.54880315562467596,
+		0.54797040165322319, 0.54354445701010701, 0.54872124596654615, 0.54249767742071175,
+		0.5499836155336697, 0.544860034155907, 0.54444709954905679, 0.55637047465665845,
+		0.54721231896584521, 0.54299462758379657, 0.55255151412662773, 0.54309519156239994,
+		0.55738629285163865, 0.55085591596742101, 0.55602906016876219, 0.56122828570787853,
+		0.55973391174847065, 0.56182312834305415, 0.56869436232940029, 0.57293272485562297,
+		0.57546083685423433, 0.5691286085519186, 0.57418459355245977, 0.58288488184252485,
+		0.58607917963034384, 0.58379470112060083, 0.58350845094915949, 0.59197221200917693,
+		0.59145123575809011, 0.58660393564488067, 0.58648167452173128, 0.59231694520310718,
+		0.59741189694609598, 0.60381816164900859, 0.58963396356268527, 0.60179773441989137,
+		0.60384484402691097, 0.59753483967632159, 0.6003550706813513, 0.59294306264880148,
+		0.59774640544870072, 0.5915457634518716, 0.59247032009261924, 0.59260158660497153,
+		0.59329818235004161, 0.5864622719226753, 0.58838980913321048, 0.58100741294697744,
+		0.59111631145583199, 0.58420569352059504, 0.58415132326768338, 0.57547027947694118,
+		0.58431174935675601, 0.57632053056624255, 0.57858600581892627, 0.57663741842902372,
+		0.5704256182022418, 0.56779939648633715, 0.56513824571908466, 0.56724360431084409,
+		0.55992533200923167, 0.5592309463944346, 0.55780277248820986, 0.56746089265879796,
+		0.56638529213744782, 0.57134155657872487, 0.56419439433624541, 0.57084265208250318,
+		0.57623764908793562, 0.5691202186000911, 0.56185079990550102, 0.57134366835759998,
+		0.56761046602870069, 0.5695124939304298, 0.57242530203409137, 0.57819537357051942,
+		0.57550166349629595, 0.5863650633059112, 0.59139740349670677, 0.58805104429265165,
+		0.58811159951444469, 0.58703456172901214, 0.58912012445873108, 0.58468199858513881,
+		0.59820760055792344, 0.60096840799704998, 0.59875784227224371, 0.60071488274750784,
+		0.61133937981579334, 0.60828106556456618, 0.6150963792348243, 0.6151267235011193,
+		0.61635281020501076, 0.60844978269315686, 0.61275998911337093, 0.61938079951945679,
+		0.61768754608113741, 0.61612786223210181, 0.61309105155640753, 0.61166159683699617,
+		0.607279181764113, 0.62183744063336954, 0.61959978921019099, 0.61648940957873755,
+		0.62303273765525857, 0.61343874883456273, 0.60255942278124863, 0.60429359961696816,
+		0.60509207564913781, 0.60496318699566909, 0.60160848187203553, 0.60585345341831687,
+		0.59651123816231566, 0.60248514014200139, 0.59948965380349872, 0.59932525875650855,
+		0.5890006488688504, 0.5899547640381646, 0.58872563071837669, 0.59030507499826435,
+		0.58736381837071727, 0.59095866518487661, 0.59825683210362868, 0.573479911206209,
+		0.58645232408516423, 0.5829117426594137, 0.58477232491423936, 0.59019738984775916,
+		0.58707452177173414, 0.58808872374526755, 0.5873594129157883, 0.5833709177236388,
+		0.69240618608377547, 0.68517254352770285, 0.69310347900896996, 0.68842343414918528,
+		0.68856383157917, 0.68309351090902748, 0.69035238890093653, 0.6933481407576767,
+		0.69971932411476856, 0.70433684982792488, 0.70484395137163203, 0.69310809745262136,
+		0.70420935356518499, 0.70952453438356788, 0.71372555909626711, 0.71300602007965375,
+		0.71987294600029028, 0.71440607649322052, 0.72067799684559952, 0.73305682482927381,
+		0.72018835345197618, 0.72638404035635229, 0.72086909905572183, 0.72797597804148528,
+		0.73544211472035481, 0.72539001141629, 0.73068142542509862, 0.72953465434414055,
+		0.73493662551467986, 0.74000246257986468, 0.7302688366491098, 0.72446906487072427,
+		0.73417403877261345, 0.74492666095190352, 0.72880427605954434, 0.72745065409507448,
+		0.72460326496695693, 0.72969193942658683, 0.72963122196176233, 0.72876743604118144,
+		0.72087354363660916, 0.71924831399008737, 0.72152653275617551, 0.72054900285024992,
+		0.7148364365960943, 0.71943229469182435, 0.70847270339444235, 0.70851509611694174,
+		0.70853436941351478, 0.71295310346295049, 0.7049797957649544, 0.70454358832892916,
+		0.70763265756639837, 0.69700992870352785, 0.69656398038927991, 0.7033466754808696,
+		0.69867195714167984, 0.70645598340129889, 0.69767905037683964, 0.69230922906207093,
+		0.70099358908905218, 0.70304828587257473, 0.69658490118956296, 0.7022030150655445,
+		0.69876956467521001, 0.69630902462047328, 0.70334668369058884, 0.7030658106020371,
+		0.70901538230583305, 0.70751081033891705, 0.71592663183493188, 0.71309967157884713,
+		0.70859600496965403, 0.71141676300784562, 0.71853209569742449, 0.72604985349932749,
+		0.72547163496793821, 0.72683475517109519, 0.73998456799707046, 0.74033100209482883,
+		0.73661834575743201, 0.73142956520998226, 0.74312966093610666, 0.73354056352963626,
+		0.73607696651178478, 0.73998951957650572, 0.74441576268020271, 0.75012303992158214,
+		0.744705627816862, 0.74909994496631072, 0.74877250538157969, 0.75360982900351692,
+		0.73857454783458554, 0.75432092091995395, 0.7426311548486263, 0.7466269919993761,
+		0.74306057379481683, 0.73867903074799723, 0.73746971465112598, 0.75023526314978262,
+		0.74759009864599035, 0.74234490004981557, 0.7329010481862992, 0.73107972629221496,
+		0.74051828703143718, 0.73629119559835088, 0.73178803318144192, 0.73315791944894004,
+		0.72642666311988835, 0.7270149196372433, 0.72116254189853868, 0.7191270355344842,
+		0.71789022403784197, 0.71832705786465934, 0.71440677010046905, 0.7182489889303576,
+		0.71290757615674882, 0.71157788673313416, 0.72328062739895183, 0.7084979046923513,
+		0.71297535631743558, 0.71216494487379578, 0.71010804530133498, 0.71363293540507422,
+		0.71170103764383941, 0.72137909734540751, 0.70833969128571694, 0.71056668424900882,
+		0.72216292314189512, 0.72041401447331088, 0.72199515113212642, 0.71799480870827248,
+		0.73012558107574232, 0.72342508279637541, 0.7348748370117888, 0.73693702093233393,
+		0.72974838166346989, 0.7348028260743299, 0.73939293665741579, 0.74024932800401166,
+		0.74116586608204871, 0.74943143187685379, 0.7488170193537802, 0.75181081605647082,
+		0.74643943699657334, 0.74831920945421515, 0.75326111799537643, 0.7597745449339578,
+		0.75658652598533038, 0.76085631235554518, 0.76258786643939414, 0.76025476613972398,
+		0.75699325176588783, 0.76111624872768979, 0.76411875395311724, 0.76649216425477495,
+		0.75332393205101633, 0.76033400203928814, 0.7618499854891263, 0.75307160527082884,
+		0.75658683051986397, 0.75235163543215977, 0.75818100319029524, 0.75402694299493744,
+		0.75348635223952765, 0.75602217696009621, 0.74778871322295792, 0.74223076709644309,
+		0.74557562779608988, 0.75123042627673842, 0.74053411883580234, 0.73564861803930581,
+		0.73592656023981939, 0.73624371453465565, 0.73248289756528318, 0.7326190282511883,
+		0.738097062542864, 0.72808708749518625, 0.72637802711911337, 0.73770100207759681,
+		0.72993951580117211, 0.72355757702632839, 0.72415681072921412, 0.73157681582010881,
+		0.72010000548564934, 0.72778774210407382, 0.7328446002426604, 0.72433473141026961,
+		0.7328881319023216, 0.72619243297095504, 0.72622935186866211, 0.72449522306886005,
+		0.72885405941431236, 0.72781159583655497, 0.739492686631959, 0.7400019610957892,
+		0.73857987256399382, 0.74932569894299061, 0.74281978276219152, 0.74595941905655561,
+	};
+	static constexpr double ButterHighpass50Expected[] = {
+		-0.0068492660891459299, 0.0055842184967146886, -0.0004137600315668212, 0.0053127881915580773,
+		0.0013362397238914255, 0.0084623871556638273, 0.009707883138055113, 0.012635162136349992,
+		0.012484730222225626, 0.016767079945809588, 0.010872241466358065, 0.014413730739354178,
+		0.01783742151594514, 0.018601601122735015, 0.010390328193304488, 0.029906396469049266,
+		0.021675648952380711, 0.012783426795003074, 0.02013189539582793, 0.026002419787170147,
+		0.015707961522185732, 0.0074689135502469216, 0.017688583929447589, 0.014168473932111288,
+		0.010683639443153845, 0.019439339708682779, 0.0025090624509922273, 0.0062143466663547933,
+		-0.0022786515521309499, 0.0094036333379726098, 0.0068015187875989126, -0.010647089201113354,
+		0.0046079961790463503, -0.0081573995836396653, -0.0037125789419954376, 0.00098146161232114462,
+		-0.013838706380479349, -0.018952010234284382, -0.013584340008631771, -0.0092376145104935067,
+		-0.015163166215253997, -0.020139937002948964, -0.015227298404214844, -0.018146626865020207,
+		-0.026575408212734738, -0.01815229000566624, -0.013999863933452459, -0.025299419957276435,
+		-0.018425670824001782, -0.022132057236520113, -0.019177712607169481, -0.014487314141858972,
+		-0.012260715254087638, -0.013663675371102789, -0.013094738564750607, -0.01013865844378423,
+		-0.006754904898223002, -0.010743870728757798, -0.012717121542487131, -0.01391160866117264,
+		-0.0040886460928737916, -0.0024195729692164936, 0.0082136232512724956, -0.0017886141762389479,
+		0.0079726360961664688, 0.0070538271034887266, 0.0022590130536343685, 0.00036089108309896728,
+		0.0017934279918320611, 0.014261609873327023, 0.011341549577158466, 0.01788208402508018,
+		0.014608100533651525, 0.016803623845073851, 0.02243464139906453, 0.011853394372086355,
+		0.010090288352179736, 0.017501476325878302, 0.0080564758618800643, 0.017495707119152024,
+		0.015553443418364357, 0.021939308820500318, 0.016912697742042265, 0.013023641556606083,
+		0.014302737351177127, 0.0012845331230236755, 0.01572213974807446, 0.011840131643554032,
+		0.004013625677969368, 0.0099760571738352413, -0.003050567394774795, -0.0019112895691311121,
+		0.00132955046852197, -0.0094663614430142672, -0.0059407631521907339, -0.0097626831960259137,
+		-0.0028829280836406325, 0.00093226803065521446, -0.0031485785707790186, -0.0069042887760326702,
+		-0.0044048854234122435, -0.015433511908973685, -0.013944020662865349, -0.024071676329880713,
+		-0.024422354514832913, -0.021465721520785724, -0.026281900579003578, -0.021369951209886363,
+		-0.024279264933614327, -0.02129809115968595, -0.029069070522719134, -0.022433169842346043,
+		-0.021800690888159231, -0.017977645566943291, -0.022571714471589229, -0.033583088281811314,
+		-0.026785749985186291, -0.012570709281843482, -0.024390220047287643, -0.016261538999899267,
+		-0.014518285411023828, -0.0096865087786581223, -0.010429160585173089, 0.0027754057146055153,
+		-0.0067881858785823687, -0.01419518790863844, -4.454884085389188e-05, -0.013209027187728853,
+		0.0049606687621760945, 0.0019011609442646481, -0.00054934789284436999, -0.0016043810332787463,
+		0.013404522709710688, 0.0036495996159714925, 0.0082174772008662897, 0.0055445454696558365,
+		0.012073138230935251, 0.0067373616008635541, 0.019800023654114166, 0.012117147115531846,
+		0.012692719797971538, 0.0094950868935898894, 0.0077600792634491787, 0.0093505693123804023,
+		0.010300346897286622, 0.0099821553567411188, 0.0094325409783886059, 0.0053615495283054794,
+		0.0070804412702032866, 0.012641854640311714, 0.0021902365205445987, -0.002328183564669524,
+		-0.0058267080457322599, 0.00027169579417400669, 0.00063285878605840243, -0.012148184780748177,
+		-0.013682193261170386, -0.011956718591633138, -0.0019789418947105241, -0.015205005179506955,
+		-0.032944523164121456, -0.024183527472382511, -0.026399826954242676, -0.028150152028651794,
+		-0.027961305184330296, -0.025048576815393762, -0.026364174959098423, -0.025363236009298809,
+		-0.02671320452598654, -0.031657288929070659, -0.026999560608900935, -0.033743106305029573,
+		-0.02677805747030429, -0.032423435844379567, -0.033359070732030482, -0.021959294732434607,
+		-0.031641943877527161, -0.036385018555593188, -0.027354400622425279, -0.037337872558361615,
+		-0.023574796827818413, -0.030634070859255083, -0.025990690771841841, -0.021322091668253312,
+		-0.023347949716443047, -0.021791070172372175, -0.01545302148362983, -0.011748687764408391,
+		-0.0097554433215112073, -0.016623373144643381, -0.012103918823549682, -0.0039409855422966635,
+		-0.0012848622406603991, -0.0041083298393023819, -0.004934378805111779, 0.0029887786748401257,
+		0.0019263990002177447, -0.0034630994153816673, -0.0041283487328407503, 0.0011631488714912742,
+		0.0057135476860696206, 0.011574484662687068, -0.0031558108722898603, 0.008461097911407936,
+		0.0099605859394769868, 0.003102205645748965, 0.0053733115064798116, -0.0025885656867938138,
+		0.0016641691423327429, -0.0050878144073676843, -0.0047153276521318295, -0.0051368540870317999,
+		-0.0049937690586797766, -0.01238390265864712, -0.011011295741772177, -0.018949323986727717,
+		-0.0093967539245561702, -0.016864391296298742, -0.017476466556435328, -0.02671589548512282,
+		-0.018433485413151981, -0.026984433199835796, -0.025279350629400545, -0.027788988864781511,
+		-0.034562492556899957, -0.03775106479418408, -0.040975207554679566, -0.039433476823567452,
+		-0.047316007228575999, -0.048575275544754826, -0.0505689510855655, -0.041476945798060924,
+		-0.043119268746456489, -0.038730328551920087, -0.046445411116939596, -0.040365664005599829,
+		-0.035539762164623484, -0.043226866544312625, -0.051066532036788639, -0.042144477448185835,
+		-0.046449054846793805, -0.045118957342741114, -0.042778629067754224, -0.037581580875430065,
+		-0.040848851875146433, -0.030559544620031298, -0.026101822642153657, -0.030023319728881843,
+		-0.030538416052918908, -0.032191613022943641, -0.030682711074528156, -0.035697993266571568,
+		-0.022750037072453232, -0.02056735877805442, -0.023356530902422207, -0.02197856795340284,
+		-0.011933613393122633, -0.015571928972573592, -0.0093370692727510231, -0.009887625424785957,
+		-0.0092428793766470112, -0.017727681555206178, -0.013999677570339226, -0.007961491110248721,
+		-0.010237783731693074, -0.012380915712100355, -0.016001577163324822, -0.018015278983293095,
+		-0.022982331147745262, -0.0090090930123357983, -0.011832142448349106, -0.015528290993943436,
+		-0.0095710963409617322, -0.01975157668862812, -0.031217745952484756, -0.030070757577295749,
+		-0.029859808808506402, -0.030576557067683047, -0.034519447665619124, -0.03086298097546564,
+		-0.040794013969791251, -0.035409236098316775, -0.03899414639010762, -0.039748258698336057,
+		-0.05066287260592385, -0.050299041654027654, -0.052118732815765775, -0.051130113417843806,
+		-0.054662455371491253, -0.051658947720522153, -0.044952367184043121, -0.070321115054056332,
+		-0.057940763098705765, -0.062073632749428828, -0.060805559361182426, -0.055973217266189451,
+		-0.059689015473355179, -0.059267944234795589, -0.060590579705085065, -0.065172586736902433,
+		0.04326898930043057, 0.035441480662642764, 0.0427783830357669, 0.037504144781911657,
+		0.037050195280174641, 0.030985380896472875, 0.037649625156099834, 0.040050610032017119,
+		0.045826899936762706, 0.049849412509672675, 0.049761388015235546, 0.037430301956339444,
+		0.047936226629367119, 0.052655983516368583, 0.056261498619146005, 0.05494637113266123,
+		0.061217636547144981, 0.055155041326180237, 0.060831177590128453, 0.07261416994851233,
+		0.059149818251013293, 0.064749586986307561, 0.058638696517639394, 0.065149602190043288,
+		0.072019748267395975, 0.061371643934175199, 0.066067053349888702, 0.064324280978610066,
+		0.069130261031166929, 0.07360012402296065, 0.063270547938192936, 0.056874856802342333,
+		0.065983949022717897, 0.076140734077940475, 0.059422563502406579, 0.057473214180916728,
+		0.054030162908880491, 0.05852324732619639, 0.057867018810598317, 0.056407807722031994,
+		0.047918582924705772, 0.045698120554186289, 0.047381213159528715, 0.04580867055146965,
+		0.039501211949913184, 0.043502304949753504, 0.031948082705331698, 0.031395985527443861,
+		0.030820916868455003, 0.034645463805605708, 0.026078130737242119, 0.025048066571509368,
+		0.027543454618689338, 0.016327227003638572, 0.015287969273859271, 0.021477551184875637,
+		0.01620992279806888, 0.023401249040636018, 0.014031832926832157, 0.008069752347025224,
+		0.016162083829255491, 0.017624989683602901, 0.010570058581514566, 0.015596877442202861,
+		0.011572390333133205, 0.0085210787480133419, 0.01496823836684159, 0.014097144795722365,
+		0.019456781874106089, 0.017362568026113058, 0.025189047271243416, 0.021773051278935789,
+		0.016680662331198377, 0.018913018310025211, 0.025440276099342667, 0.032370293038373327,
+		0.031204674558089465, 0.031980742601163348, 0.044543857928889978, 0.044303956061392633,
+		0.040005332160975259, 0.034230959320016449, 0.045345844887407519, 0.035171926320187494,
+		0.037123904000679664, 0.040452434481809171, 0.044295064576776795, 0.049419145238876631,
+		0.043418959836672939, 0.047230933820509323, 0.046321588049815295, 0.050577449310895528,
+		0.034961156449327437, 0.050126975351033623, 0.037857119443397341, 0.041273337941182278,
+		0.037127779100594664, 0.032167580265870313, 0.030380100057994273, 0.042567982948909615,
+		0.039345658164588959, 0.033523811436635853, 0.023503830409220036, 0.021106905135841531,
+		0.029970395094706642, 0.025168772292147753, 0.020091624726224777, 0.020888078872380846,
+		0.013583950254526498, 0.013599901118155127, 0.0071757911610236241, 0.0045691328117690956,
+		0.0027617563588034858, 0.0026286190515655656, -0.0018610392332593069, 0.0014124164783481568,
+		-0.0044971452244552358, -0.0063943626036251436, 0.0047414778626686934, -0.010607510507173139,
+		-0.0066956832309188821, -0.0080710709329512888, -0.010692291899425412, -0.0077310615534444257,
+		-0.010225950666355121, -0.0011102071425839188, -0.014711247440410476, -0.013045200011809855,
+		-0.0020092111883690577, -0.0043176677013195292, -0.0032953699039100478, -0.007853835450268189,
+		0.0037195362876163568, -0.0035376333763114144, 0.0073561854497733248, 0.00886317672454515,
+		0.0011200942999153151, 0.0056208517896117905, 0.0096580384288878652, 0.0099622755499500087,
+		0.010327435859837697, 0.018042407081187043, 0.016878189914877603, 0.0193229786383117,
+		0.013403394995148078, 0.014735772995794694, 0.019131103934801847, 0.025098776852950214,
+		0.021365834190822768, 0.025091533878037069, 0.026279845031330261, 0.023404352273899007,
+		0.019601302633877472, 0.023183628238311597, 0.025646332730920339, 0.027480819638562033,
+		0.013774548092398187, 0.020247469501272534, 0.021227201844742576, 0.011913474701789568,
+		0.014894263915264837, 0.010125550387218109, 0.015422324005129863, 0.010736600673388063,
+		0.0096652844880174404, 0.011671328186535823, 0.0029090345356936201, -0.0031767836967516215,
+		-0.00035883059679845883, 0.0047700314879371344, -0.0064512344484619847, -0.011860709144132195,
+		-0.012105749551449125, -0.012310579878787264, -0.016592376791062596, -0.016976214675827987,
+		-0.012017130890241586, -0.022545031687649944, -0.024770986365847805, -0.013963867571128594,
+		-0.022240165182654901, -0.029135863774053024, -0.029049331679670887, -0.022140963300072734,
+		-0.034128338759780011, -0.026950088991997266, -0.022401632741143065, -0.031418811810281486,
+		-0.023371623216118249, -0.030572429018817959, -0.031039505278346976, -0.033276510833880696,
+		-0.029419426155363835, -0.030962509624066829, -0.019780900256508385, -0.0197699620703835,
+		-0.021689235042761719, -0.01143943458029141, -0.018440211466665933, -0.015794263980062725,
+	};
+
+	static constexpr double Cheby1Lowpass78Sections[] = {
+		0.00046899105897534597, 0.00093798211795069193, 0.00046899105897534597, -1.6589056323327029,
+		0.70893308852380632, 1, 2, 1,
+		-1.7127982025263391, 0.87168072476270131,
+	};
+	static constexpr double Cheby1Lowpass78InitialConditions[] = {
+		0.037029702233269152, -0.026115073392302488, 0.90656218299368019, -0.78542097556878121,
+	};
+	static constexpr double Cheby1Lowpass78Input[] = {
+		0.50423071126171182, 0.51694283156441456, 0.52535415649301653, 0.51708078322991913,
+		0.53049135870712283, 0.51326388619189978, 0.49543433323073977, 0.50024028048552716,
+		0.49779093822098308, 0.51381382259948083, 0.52731002408714567, 0.53996681677000846,
+		0.54960213792246815, 0.54840256784372288, 0.53900043719287882, 0.5371511952833401,
+		0.52120850106787153, 0.51682594484897681, 0.52920543745248982, 0.54040069459409223,
+		0.55580869389215548, 0.56346536453931195, 0.57721684022838049, 0.56272146149086444,
+		0.56803709162564109, 0.54780946956835419, 0.55052408551871646, 0.55530117965149484,
+		0.54564417596408854, 0.5616103398186526, 0.58626828828198463, 0.5942255897139519,
+		0.59484809367901414, 0.58822230285504251, 0.58317104159440991, 0.57531570423794054,
+		0.55906246515887881, 0.56529241642686567, 0.57756956929451742, 0.59306779638074902,
+		0.59532254738778601, 0.61345778574204646, 0.61824424471372952, 0.6090220292847085,
+		0.60560619482855549, 0.5973126133065495, 0.5712015367807125, 0.58889680887895335,
+		0.60498151937771671, 0.61509523152686696, 0.62546856461719613, 0.6383815617527272,
+		0.63165252845834186, 0.6288224498213093, 0.61911872821623293, 0.60900320157806387,
+		0.60309214744099904, 0.60660715052447334, 0.61813542502483565, 0.62525751375967908,
+		0.64758588996001099, 0.64917265473992525, 0.64172650437801526, 0.63845678703216269,
+		0.62425621513708152, 0.61298005489369711, 0.61702249717312552, 0.62490255748232415,
+		0.63923155713164592, 0.65878283568990559, 0.66040818264100765, 0.65752271977416143,
+		0.64528005327611748, 0.6510310884170678, 0.63743287986308128, 0.63443538647068853,
+		0.62582520424526289, 0.63403323722196103, 0.64499646308575076, 0.66684100641270316,
+		0.66900323439771237, 0.66749892924118803, 0.6583577495993016, 0.65310933214237821,
+		0.638229994365485, 0.63606779109145073, 0.63463653012600008, 0.64619431870537025,
+		0.65563231727988769, 0.67317007571626153, 0.67815048163448877, 0.67738921739540625,
+		0.66432828770122843, 0.65744838590925836, 0.6521112050712905, 0.64070043606571625,
+		0.64025138598150066, 0.64785430253699261, 0.67630790999979973, 0.67450864907184505,
+		0.69056430545783309, 0.68484859474011106, 0.66107554947872005, 0.65070436206921911,
+		0.64257872086581491, 0.65031169101466091, 0.65047987712543764, 0.65876374375932356,
+		0.66740243656023002, 0.68782537506694152, 0.68326943538343499, 0.67574741401064298,
+		0.66550933017106806, 0.65420224634890856, 0.65082045829072044, 0.64842364281313725,
+		0.64776554414663157, 0.6606188609953294, 0.68302667956105323, 0.68455804425852507,
+		0.68681842711609542, 0.6873360578045522, 0.66571328558177012, 0.65183873359188094,
+		0.65598241856590322, 0.64336378656820059, 0.65824722606798047, 0.65937491464168896,
+		0.67763442542761443, 0.68912630712697209, 0.68990448106769131, 0.68072302954802055,
+		0.66144186361759028, 0.65114604867063453, 0.63872543246745495, 0.6505947027645429,
+		0.66875885184821549, 0.66906132388802153, 0.67890535054166312, 0.68980775735981736,
+		0.68049030490205697, 0.67258518317756444, 0.65679713760707636, 0.65512356397189875,
+		0.64512452525860831, 0.65072713133679694, 0.66445868342611492, 0.67295122834687171,
+		0.69024716907936079, 0.68812863115016909, 0.68539218916611666, 0.67720928232289967,
+		0.65466309127731248, 0.65723191985030394, 0.64918761100640099, 0.65497108829719042,
+		0.66677334955530376, 0.68225932264696665, 0.6918139815089932, 0.68953237646265164,
+		0.68239173522689833, 0.67326068773817249, 0.6684089237260773, 0.65056975190948918,
+		0.65084921638683879, 0.66531464417701314, 0.67346329860573961, 0.68351471542745246,
+		0.6999550870930723, 0.70058770771893386, 0.68449963591612495, 0.66534518274297372,
+		0.65921020810340047, 0.66950062886141892, 0.65739930581545336, 0.68049481929610478,
+		0.68835465627795289, 0.68978826621198508, 0.71161687212690883, 0.69311783650595715,
+		0.68497028959456929, 0.67130594294750856, 0.6673707451541232, 0.67255939867387837,
+		0.6672958567329409, 0.6894494507734138, 0.69430966259126381, 0.70961073754953008,
+		0.7111341976075144, 0.70154017201980545, 0.69309776336486939, 0.68700009907500403,
+		0.67475571031344728, 0.67172291340467827, 0.68911323841990724, 0.69521624052560005,
+		0.70940079199012396, 0.71502465228117695, 0.72538186128155557, 0.71986531678855858,
+		0.7069212874919294, 0.69071690100369132, 0.68737581514046053, 0.68806999772565447,
+		0.70509447694441618, 0.72300199915631891, 0.72612942721503038, 0.73925044269228535,
+		0.73647710297990832, 0.73124392550811856, 0.71925993443498004, 0.70393016465951319,
+		0.71227961564402464, 0.70964947570222714, 0.71881363268167586, 0.73615221103871076,
+		0.74869585870958977, 0.75322772526736625, 0.75524328285048381, 0.7356785796505193,
+		0.73769265192404432, 0.72259466749611712, 0.72574690259149555, 0.73075635637269476,
+		0.73997037976691538, 0.75572768157086168, 0.76967675758708531, 0.78189161425408882,
+		0.77250773439186293, 0.76422582555212148, 0.74814922271259365, 0.74997619411370986,
+		0.7474121329400677, 0.75565032534298149, 0.76297398120174054, 0.78581640516702866,
+		0.791997288005728, 0.79189462229222407, 0.78175330310478686, 0.77867635522013967,
+		0.77164396020330583, 0.77569345587045113, 0.77420758388978572, 0.784167370915134,
+		0.79499610822898381, 0.81536436672057044, 0.81092680933526018, 0.81351493301041777,
+		0.81569599981008678, 0.80706113205101593, 0.79753219560448818, 0.79478856852660107,
+		0.79822780123181802, 0.81141100491952356, 0.82994383840146024, 0.84122620341875487,
+		0.8371046818311163, 0.8381102601251863, 0.82659792481462158, 0.82754823795495369,
+		0.81987711378238981, 0.81783626936033416, 0.82520439588272232, 0.84224366961524555,
+		0.85063444387533582, 0.85983667708294143, 0.87289911292708267, 0.86573055006519717,
+		0.84845773345029918, 0.8489386565185989, 0.83818911428777254, 0.84592807807115022,
+		0.85393867612899232, 0.86562801496810415, 0.88072470756412302, 0.88254328666772308,
+		0.88781658182117529, 0.89420169854843501, 0.88100495183459282, 0.85693882135395327,
+		0.86524217649332646, 0.86642544679154632, 0.88518220361601208, 0.89292418814956653,
+		0.90587495744050084, 0.90545015242401727, 0.91345859623432468, 0.89418212799062469,
+		0.8973305738483135, 0.89057266055298812, 0.87795666369502146, 0.8907949634072253,
+		0.90742023396494365, 0.90933860832463753, 0.92519114317718576, 0.9383012975728855,
+		0.92594357793069848, 0.92818576084254212, 0.91172261548763933, 0.90774762434588374,
+		1.0027593354401474, 1.0169431671190676, 1.0330465555146573, 1.0436491098924443,
+		1.053494284293963, 1.0636486515083174, 1.0548263354165832, 1.0334973689267215,
+		1.0271624583160093, 1.025446596133327, 1.0203730716725901, 1.0356536352199137,
+		1.0423491399808138, 1.0598218166308755, 1.064877039591495, 1.0720828566457794,
+		1.0697243346657765, 1.0605132185797854, 1.0385077231016384, 1.0458977268891645,
+		1.0401773122103195, 1.0523359986955718, 1.0671724006599412, 1.0847885665536179,
+		1.0829084143637622, 1.0840467697720548, 1.0884348152995942, 1.0674699909224337,
+		1.0589798158949362, 1.0510688444718734, 1.060562838161049, 1.0620546056000246,
+		1.0833166458077237, 1.0885350863574967, 1.0997829037436471, 1.0893062339874735,
+		1.083195867324402, 1.0702315880286051, 1.0530480515041278, 1.0605840943032028,
+		1.054444313530623, 1.0787054177813487, 1.1010285037133696, 1.1152564210062577,
+		1.1045067456425461, 1.1047687149929974, 1.0866348579435103, 1.078731474650368,
+		1.066737341148611, 1.0683079387047851, 1.0796958832561607, 1.0879825820874185,
+		1.1022965236242757, 1.1131672814213847, 1.1206435337279723, 1.1027439911569281,
+		1.0889929765956996, 1.0795672251075608, 1.0811652102478604, 1.0771051775626619,
+		1.0905800342734084, 1.108287957557031, 1.1095608644265256, 1.1092167977068597,
+		1.1089782724348205, 1.1073490637657322, 1.092738895893596, 1.0723777117053546,
+		1.0846029213270345, 1.0808577652310485, 1.0995281362965381, 1.1135550664950009,
+		1.1129476571833845, 1.1206891814438789, 1.1142315596389329, 1.1034921189642106,
+		1.1035697255121943, 1.0782762945915196, 1.0763765572058406, 1.0810432020198331,
+		1.0905119178802194, 1.0960922647255249, 1.1231309589429392, 1.1115001955332819,
+		1.1146453171320347, 1.0968753867408125, 1.0857442759660476, 1.0825122770951014,
+		1.0819262820343465, 1.0877804810974088, 1.0974743600139361, 1.1168264201442948,
+		1.1180504323815266, 1.1217814692304582, 1.1083333404751745, 1.0983330598066721,
+		1.0832376660141656, 1.0736223362442578, 1.0856536312305836, 1.0884642794394761,
+		1.1038234827300168, 1.1169867943556711, 1.1159177782749319, 1.1203778391533006,
+		1.1138120211904177, 1.1021050051082726, 1.082695066372549, 1.0880535520499621,
+		1.0974752294089474, 1.1045833217119085, 1.1088318876409382, 1.1208790078206576,
+		1.124506445998277, 1.1233355814346906, 1.1105009145254627, 1.0984256129420618,
+		1.0890752923886937, 1.0741096677146906, 1.0900500383795311, 1.0974547696585524,
+		1.1157109610130633, 1.1286683195183556, 1.1238372886154038, 1.1240830410208771,
+		1.1059338287552891, 1.0944969686468362, 1.0866083927319841, 1.0908422510668785,
+		1.0932015163190638, 1.1045391006531615, 1.1272961432135857, 1.1387741137634597,
+		1.1331363549965576, 1.1243526976384055, 1.1215407015244996, 1.1024899362833107,
+		1.0961805506309186, 1.0940318635163973, 1.1013358058995695, 1.112945205423135,
+		1.1334384851610619, 1.1430992389201429, 1.1290379732916247, 1.1401991791287038,
+		1.1150722810617648, 1.110986370030018, 1.1104996641590752, 1.1113769197693113,
+		1.1256527265504728, 1.1222215414356873, 1.1428038467735093, 1.1439048249460231,
+		1.1462671046731321, 1.1329918752644366, 1.1265693000287451, 1.1196915109672914,
+		1.1164849196273885, 1.1294425197647673, 1.1339072494376592, 1.1490509341449011,
+		1.1599208795391311, 1.1678204529380736, 1.1495877950432993, 1.1472526014790394,
+		1.1282905049667413, 1.1269490124647583, 1.1324036817802203, 1.1381860776941044,
+		1.1488648034533075, 1.1645939393879159, 1.1681469916374323, 1.1742604909979786,
+		1.1710888273122253, 1.1664926829672737, 1.1472050525767157, 1.1467313317780219,
+		1.1492020119690154, 1.1505516273235654, 1.1694199929264035, 1.191120725175641,
+		1.1943140129827898, 1.1921024506896538, 1.1855921243473324, 1.1765317713440329,
+		1.1653450422405536, 1.1655132337709377, 1.1745049877157832, 1.1784736933639428,
+		1.2034338424729105, 1.2155038828223226, 1.206746055359692, 1.2123064015780476,
+		1.2066632011938827, 1.1939318560145464, 1.1835551576124337, 1.1811648297447188,
+		1.2005171717805532, 1.2136478178779786, 1.2168902051266246, 1.236272223593978,
+	};
+	static constexpr double Cheby1Lowpass78Expected[] = {
+		0.44861189771286469, 0.44959789070998635, 0.45079685567177324, 0.45223655565452026,
+		0.45392223767568263, 0.45584147269661918, 0.45796586808331075, 0.46025085102668239,
+		0.46263636947775894, 0.46505140421497837, 0.46742355625341792, 0.46969240574419069,
+		0.47182302248552077, 0.47381502521409147, 0.47570345676346282, 0.47755022195809416,
+		0.4794280170248299, 0.4814013537445393, 0.4835104047495265, 0.48576248157245316,
+		0.48813329514915155, 0.49057675493932007, 0.49303926290840883, 0.49547329597069212,
+		0.49784589597865903, 0.50014007592791432, 0.50235010201985009, 0.50447394629861519,
+		0.50650704841929195, 0.50844063004173523, 0.51026557704572273, 0.51198021294778173,
+		0.51359822496074248, 0.51515253242105652, 0.51669232715686464, 0.51827328496395497,
+		0.51994386183174579, 0.52173244543035102, 0.52364015747194848, 0.52564220142292928,
+		0.52769750630851142, 0.52976327405606571, 0.53180913741068203, 0.53382569202525754,
+		0.53582417216133427, 0.53782731322862343, 0.53985481762067566, 0.54190902910528793,
+		0.54396650555949111, 0.54597902594695147, 0.54788400795844638, 0.54962082550616631,
+		0.55114747492008964, 0.55245211180259479, 0.55355599399067923, 0.55450748033334329,
+		0.55536976724553688, 0.55620689626367115, 0.55707261339516034, 0.55800498011777333,
+		0.55902697722061567, 0.56015083979107982, 0.5613825697287449, 0.56272352509541046,
+		0.56416793829866618, 0.56569772908361571, 0.5672778602291747, 0.56885582647396404,
+		0.57036743714679761, 0.57174841532595477, 0.57294864152896374, 0.57394434057881893,
+		0.57474386449968928, 0.5753848309452777, 0.57592335184975441, 0.57641877949366327,
+		0.57691889143884423, 0.5774502680779543, 0.57801680167867964, 0.57860634501307628,
+		0.57920247907386979, 0.5797964584412868, 0.58039442656817974, 0.58101699972560061,
+		0.58169145280253398, 0.58243972476825467, 0.58326714746236397, 0.58415656786966386,
+		0.58507047492570696, 0.5859606392453246, 0.58678182699069648, 0.58750452067862746,
+		0.5881219345779759, 0.58864882253606943, 0.58911274879395914, 0.58954135936086394,
+		0.58995066031286436, 0.59033885368747652, 0.59068805886233688, 0.59097306218217949,
+		0.59117335303561647, 0.59128336582350671, 0.59131667083797379, 0.59130250006870833,
+		0.59127629318889219, 0.59126843607409818, 0.59129596821310004, 0.59136059916785499,
+		0.59145362328915474, 0.59156540183979256, 0.59169509618591898, 0.59185605816018005,
+		0.59207391146931077, 0.5923773252921668, 0.59278460019418422, 0.59329117877145077,
+		0.59386326201660278, 0.59444080838234414, 0.59494995775002291, 0.59532147101947297,
+		0.59550938161305811, 0.59550369725729291, 0.5953328879653047, 0.59505536499927181,
+		0.59474289566515526, 0.5944615134050093, 0.59425603398933768, 0.59414267046889624,
+		0.59411115192271591, 0.59413436051021373, 0.5941810361454033, 0.59422646246246447,
+		0.5942574695709073, 0.5942709439402839, 0.59426804226286101, 0.59424809759097152,
+		0.59420599318997402, 0.59413473980016385, 0.59403216759732125, 0.59390837951130215,
+		0.59378988599673721, 0.5937174234543029, 0.59373693085908641, 0.5938860714773263,
+		0.59418085525073894, 0.59460740566740167, 0.59512244413385995, 0.59566311596245503,
+		0.59616341476018109, 0.59657194867629926, 0.59686513820479492, 0.59705145602514675,
+		0.59716548365785949, 0.59725418506108829, 0.59736050954594455, 0.59751021493441725,
+		0.59770638721088787, 0.59793310521380483, 0.59816622401060271, 0.59838664987939505,
+		0.59859074301347015, 0.59879385163044074, 0.59902583139909915, 0.59932056067975481,
+		0.5997037159687979, 0.60018360718249852, 0.60074850797336199, 0.60137120506789787,
+		0.60201856259697539, 0.60266197805755284, 0.60328448236376409, 0.6038819502544106,
+		0.60445868252295931, 0.60502019310565514, 0.60556716502546482, 0.60609377196639291,
+		0.60659136016420701, 0.60705586797265032, 0.60749543052067279, 0.60793418730420756,
+		0.60840962599728587, 0.60896340587954734, 0.60962846875354981, 0.61041712557953087,
+		0.61131485145019537, 0.61228267334986153, 0.61326799492238249, 0.61422059059069856,
+		0.6151084697600453, 0.61592816403135231, 0.61670585429381253, 0.61748897358844723,
+		0.61833129015744381, 0.61927673403836903, 0.62034755539116637, 0.62154068020903952,
+		0.6228330057311473, 0.62419305351557197, 0.62559414204324737, 0.62702386912568864,
+		0.6284863098366813, 0.62999633504694963, 0.63156869523756809, 0.63320667319034929,
+		0.63489524998261126, 0.63660178172324222, 0.63828401644067079, 0.63990227730639948,
+		0.64143104210645974, 0.64286553033599214, 0.64422102399415915, 0.64552561563730237,
+		0.64680970829308693, 0.648096813068468, 0.64939949637743333, 0.6507220188455608,
+		0.65206823366714561, 0.65345087299530624, 0.65489746146103633, 0.65644920192477718,
+		0.65815192003310008, 0.66004146047962609, 0.66212846819095317, 0.66438824038521149,
+		0.66675997910837148, 0.66915676610276043, 0.67148397094024714, 0.67366086578730267,
+		0.67563903035982886, 0.67741217123326913, 0.6790149000838005, 0.68051169412034684,
+		0.68198026617110941, 0.68349481699912129, 0.68511384237373751, 0.68687484276336386,
+		0.68879545301472367, 0.69087830026877428, 0.69311614676501387, 0.695494758566649,
+		0.69799287519911535, 0.70058061324931198, 0.70321870694595856, 0.70586076119826657,
+		0.70845932847434923, 0.71097471067034079, 0.71338374127039372, 0.71568518594638775,
+		0.71789919444057959, 0.72006021420270794, 0.72220519417856632, 0.72436085043831633,
+		0.72653445969356689, 0.72871169702195837, 0.73086264091313302, 0.73295407400622337,
+		0.73496380601264821, 0.73689194364587429, 0.73876515050366365, 0.74063246564105645,
+		0.74255414361845129, 0.74458717912097649, 0.74677198289592606, 0.74912389940879853,
+		0.75163126017249737, 0.7542592631239956, 0.75695713608908877, 0.75966550094042729,
+		0.76232176035931254, 0.76486321405040059, 0.76722953384145298, 0.76936715283389068,
+		0.77123745721071479, 0.77282858518337283, 0.77416799493434352, 0.77533092904075473,
+		0.77643948638529581, 0.77764866746472339, 0.77911920403797585, 0.78098129773408176,
+		0.78329725434685238, 0.78603301006614834, 0.78904772232647225, 0.79210693035379276,
+		0.79491934060216651, 0.79719168489384828, 0.79869183033566704, 0.79930831667430535,
+		0.79909498737284967, 0.79829197255011153, 0.79731818398651166, 0.79673481313384542,
+		0.79718336539001133, 0.79930510420782075, 0.8036513377282728, 0.81059584822753716,
+		0.82026188433405278, 0.83247613502192497, 0.84676037362124035, 0.86236737207793834,
+		0.87836097822385129, 0.89373160083478986, 0.90752978190875977, 0.91899492666562144,
+		0.92765582866482421, 0.93338467957386251, 0.9363953521798184, 0.93718768824790122,
+		0.93644996909786704, 0.93493944789819106, 0.93336402826571985, 0.93228622590262877,
+		0.93206416597502195, 0.93283536864462624, 0.93453979110481478, 0.93697123775000968,
+		0.93984235137967354, 0.94284845266592487, 0.94571891450398105, 0.94825010641765406,
+		0.95031940049046104, 0.95188371717582587, 0.95296783327042123, 0.95364736720341547,
+		0.95402988122169174, 0.95423598512649133, 0.95438148865395456, 0.95456171983724913,
+		0.95483973008069345, 0.95524057674620988, 0.95575354382677336, 0.95634268192430338,
+		0.95696368111628594, 0.95758269451326528, 0.95819138360209499, 0.95881295564646896,
+		0.95949644828427993, 0.96030032775140506, 0.96127032298524029, 0.96241887882636845,
+		0.96371363789630216, 0.96507973872245345, 0.96641620492723357, 0.96762182657984985,
+		0.96862249471535011, 0.96939129768239551, 0.96995509469164187, 0.97038578453846869,
+		0.97077938243766682, 0.97122961548227804, 0.97180394657281188, 0.9725285198375927,
+		0.97338517508446532, 0.97431970902809606, 0.97525737387050948, 0.97612020966042401,
+		0.97684149760528705, 0.97737485865618345, 0.97769813314167553, 0.97781392593924688,
+		0.97774892655774992, 0.97755298368692856, 0.97729722427077459, 0.97706927436782887,
+		0.97696364816701409, 0.97706679089892112, 0.97743857526849487, 0.97809434737061807,
+		0.97899293073984084, 0.98003557054375245, 0.98107841292466869, 0.98195735311050869,
+		0.98252021501628017, 0.98265864676723924, 0.98233177172214692, 0.98157565904201649,
+		0.98049641775645802, 0.9792490187766334, 0.97800753532195772, 0.97693431680159715,
+		0.97615515113937157, 0.97574495186280352, 0.97572490287400993, 0.97606866137751735,
+		0.97671333543497707, 0.9775710526877377, 0.97853869877221156, 0.97950579353231904,
+		0.9803622507657348, 0.98100808394152561, 0.98136587172082701, 0.98139460292759961,
+		0.98110142214210794, 0.98054684816634619, 0.97983988902550823, 0.97912205297117405,
+		0.97854270971332113, 0.97823129741146209, 0.97827328843248174, 0.97869598939938807,
+		0.97946738954567503, 0.98050740801806235, 0.98170740957003844, 0.98295194070032232,
+		0.98413683831709631, 0.9851799540733176, 0.98602384529202025, 0.98663270824432936,
+		0.98698745447629876, 0.98708257515736708, 0.9869265737589229, 0.98654525795076597,
+		0.98598520949332458, 0.98531409152132166, 0.98461536340473499, 0.98397714848596574,
+		0.98347761665415878, 0.98317120295683358, 0.9830803518972645, 0.98319591431172482,
+		0.98348629296154011, 0.98391209474613195, 0.984440808625756, 0.98505590723180558,
+		0.98575691453454906, 0.98655059092970787, 0.98743704545357369, 0.98839683535630751,
+		0.98938503496965935, 0.9903358279340686, 0.9911772685297815, 0.99185187925598195,
+		0.99233617437989563, 0.99265206066513501, 0.99286551955802915, 0.99307214439414682,
+		0.99337347015552879, 0.99385107695660979, 0.99454617179014815, 0.9954505432994778,
+		0.99651109119671, 0.99764586972922475, 0.99876625763473381, 0.99979858225757923,
+		1.0006995392411353, 1.001462412991176, 1.0021142428202849, 1.0027065272947771,
+		1.0033030898010737, 1.0039682934649441, 1.0047574395382586, 1.0057097013507601,
+		1.0068430175898908, 1.0081503542417782, 1.0095975567417248, 1.0111240973863975,
+		1.0126485793655939, 1.0140802785390883, 1.0153362304669455, 1.0163609746552948,
+		1.0171440271626917, 1.0177294489177398, 1.0182130991336285, 1.0187262311881322,
+		1.0194081643665289, 1.02037446440454, 1.0216889985936752, 1.023347608297873,
+		1.0252781015873069, 1.027356789258431, 1.0294372813702672, 1.0313840784486377,
+		1.0331025145042847, 1.0345580160174763, 1.0357808826501269, 1.0368567913523086,
+		1.037906706487187, 1.0390618136471508, 1.0404390885969588, 1.0421215390703105,
+		1.044144942989585, 1.0464911191394477, 1.0490871339783772, 1.0518103728356796,
+		1.0545003580752219, 1.0569785717930724, 1.0590766044406172, 1.0606706138716473,
+		1.0617169872121173, 1.0622814350237668, 1.0625528029543339, 1.0628345318433188,
+		1.0635109456545406, 1.0649914327221435, 1.067641505556771, 1.0717139807743823,
+		1.0772947806635249, 1.0842755443488457, 1.0923598232663829, 1.1011025398243501,
+	};
+
+	static constexpr double Cheby1Bandpass10Sections[] = {
+		0.0014601251853283486, 0.0029202503706566973, 0.0014601251853283486, -1.7780499045593443,
+		0.86826331176395821, 1, 0, -1,
+		-1.8566117740465975, 0.86031075083950248, 1, -2,
+		1, -1.9940445181867761, 0.99420416538898171,
+	};
+	static constexpr double Cheby1Bandpass10InitialConditions[] = {
+		0.063280814352256132, -0.054752057384284937, -0.064740939537585918, -0.064740939537583211,
+		-0, 0,
+	};
+	static constexpr double Cheby1Bandpass10Input[] = {
+		0.50540204918718823, 0.51700460044550478, 0.52671763175670572, 0.52833280018131135,
+		0.52669366189281575, 0.51319981890238364, 0.51461966616773225, 0.50808567956924799,
+		0.50105306178048636, 0.50736524647114645, 0.50058278810882217, 0.51293424611333471,
+		0.52398119586442982, 0.5310694895388467, 0.53138413971453657, 0.55079901556361344,
+		0.55490005234848228, 0.54917262679781165, 0.54270963611180401, 0.53905613689147869,
+		0.52480580360261231, 0.52766463522042306, 0.51104593369923157, 0.52751443081166072,
+		0.54115566385752822, 0.55141015279330807, 0.5543966301580846, 0.55813482977121642,
+		0.57363886387955132, 0.57191345210726074, 0.56746702895537615, 0.56402934747371025,
+		0.54964497929216272, 0.54739744081250752, 0.53848903544561599, 0.5436353669551045,
+		0.54795381525965381, 0.5736469644246156, 0.58046680118297955, 0.58817294732472603,
+		0.59100888382284145, 0.59685437109028427, 0.59072205074264816, 0.59459329258688742,
+		0.58247260548027679, 0.56552431223398503, 0.56753364040052467, 0.56895968910358385,
+		0.5738757997356192, 0.57444599920902351, 0.59557537931130644, 0.59125798984004219,
+		0.61049037808897577, 0.61610055655143203, 0.61325981488795955, 0.60282171330916456,
+		0.60248410308324174, 0.58862735115791476, 0.58193135333774804, 0.58518844939810322,
+		0.58559739018517021, 0.58934173983647409, 0.60747060214693227, 0.60429409049974481,
+		0.62016684517435172, 0.62962916881759001, 0.63983652663876966, 0.6323382635536865,
+		0.62288372076187015, 0.60981787486780537, 0.61361414494291144, 0.59390622782353941,
+		0.60298228486601091, 0.60010691396451066, 0.61416007672550288, 0.63127716560811453,
+		0.63660067758519534, 0.64498958854600175, 0.65241641654769245, 0.64667596460957488,
+		0.63715380248867182, 0.62926267535155278, 0.62946244877722168, 0.61346049395092861,
+		0.60987060200581611, 0.62615583968652944, 0.62697935330089993, 0.63105354324156382,
+		0.64009497101109547, 0.64955517312200517, 0.66073224867012215, 0.65256610903039147,
+		0.66335052094938918, 0.64319190034739482, 0.63458229406123168, 0.63516519224271095,
+		0.63001845672355261, 0.6195500284455473, 0.61748574374945653, 0.62920661930861732,
+		0.63973872144450605, 0.65892511263313058, 0.66550683895698548, 0.67244864050700492,
+		0.67540796770870104, 0.65748340002267658, 0.65335192659217967, 0.64033231020638914,
+		0.63841566916068704, 0.63956848177243253, 0.64007067984412669, 0.64140191686116188,
+		0.65550480896014374, 0.66211573075565378, 0.67081853124682433, 0.67558976726397957,
+		0.67325625482669371, 0.66860109520994293, 0.66504768892336896, 0.65560482504030471,
+		0.64654095961533531, 0.6427267234290176, 0.63789837315213693, 0.6504441401093437,
+		0.66008190072111139, 0.65420902920495805, 0.67010260765965712, 0.67311669942496777,
+		0.68236227382168468, 0.68243393492072235, 0.67067467182040108, 0.65282164744335025,
+		0.65405858783638571, 0.64774798259556665, 0.63870209848850445, 0.64616195892340167,
+		0.63988688171018482, 0.65908717256353067, 0.66721362731755918, 0.67957710282228423,
+		0.67363381182332593, 0.67771902467351741, 0.6781363859863504, 0.67389207018402686,
+		0.66728237217858555, 0.66513114633494708, 0.64629232562950722, 0.64142457954933207,
+		0.65265890411619143, 0.6547074097829092, 0.65672258322094601, 0.67859713197723193,
+		0.67789071186692784, 0.68349915107493908, 0.6900271209334079, 0.67906352609494058,
+		0.67217991059494364, 0.66320690143418104, 0.65687379409327828, 0.65346384523393297,
+		0.64366720343868367, 0.66794200862319719, 0.66107962098707473, 0.67020410323495938,
+		0.68435733540864585, 0.6844063897198811, 0.68760670262143575, 0.68090539041298237,
+		0.66765033954755426, 0.67161254574527007, 0.66127284613031712, 0.64811069761944595,
+		0.63903893504378095, 0.6492407359784117, 0.65593207134303433, 0.66758421787159372,
+		0.67797384170979047, 0.67817986690022203, 0.69030740677959734, 0.68933769440912129,
+		0.67753138494446419, 0.66072525157505002, 0.65275488902673584, 0.64676021378867388,
+		0.65668547453229775, 0.64960073140499586, 0.65340223606117331, 0.66702425743295979,
+		0.66954135486543986, 0.6801348425394953, 0.68750455322399129, 0.68693107699319422,
+		0.68177986253365508, 0.67893271933133803, 0.66742067054993992, 0.65421077899852209,
+		0.64768575995040834, 0.6413918157383689, 0.6473348654903861, 0.66612413308176877,
+		0.66273902643713878, 0.67515716873105192, 0.69045705584444106, 0.68199907023910056,
+		0.69338349232149921, 0.68181420347309285, 0.6726576647340915, 0.66287981231636928,
+		0.65568841895702401, 0.64903377575300836, 0.64714050845015181, 0.65376507392366279,
+		0.67437541538980905, 0.67553777225940048, 0.69328122235215217, 0.69267970226051168,
+		0.69865984789523938, 0.68666479940609948, 0.68521450576714893, 0.67876455877839181,
+		0.67348010652140611, 0.65546549874672222, 0.65316252237072803, 0.65876702750736538,
+		0.66719893216648529, 0.68849226922476714, 0.68880296257392459, 0.70175230414390355,
+		0.69847168822397832, 0.69742397574011794, 0.70021481250141737, 0.68254699162065824,
+		0.675437020671109, 0.66530986796185521, 0.66461681077787704, 0.66855151010567793,
+		0.67846816285280265, 0.68814482028503865, 0.69467005757433675, 0.70741390651263547,
+		0.71029136447653418, 0.69357837939545219, 0.70685787857456728, 0.69407954481918577,
+		0.68927151163221156, 0.68870637701330439, 0.67795065936393883, 0.67973592318352394,
+		0.67998968449445274, 0.68337985556059133, 0.70316239439768857, 0.70958773798039876,
+		0.72438427597123967, 0.73000824853674828, 0.71994987332826976, 0.71297067555808158,
+		0.70783238596646314, 0.70040826200417272, 0.6931522184879757, 0.68539278639007872,
+		0.68988182175722612, 0.69528957594138985, 0.70814498097874978, 0.71866634983346445,
+		0.72815035844857523, 0.72928989220445584, 0.73558644756182734, 0.73867353214842013,
+		0.73294015173205873, 0.71760737308940226, 0.7070721043814977, 0.70334822282587517,
+		0.70433905204535363, 0.72202216650895479, 0.72340791279970085, 0.73262969366587449,
+		0.74498616304562726, 0.74111256722516894, 0.7479114874363525, 0.75930231980243934,
+		0.75161550122921761, 0.7487916371020843, 0.72683860787644206, 0.72358845524801763,
+		0.73090689809280684, 0.73012890351711013, 0.73611890052096507, 0.74135366266704261,
+		0.76108212037280698, 0.76660540857170401, 0.7679686701680416, 0.76838997407420906,
+		0.77772702047577746, 0.7727535358505524, 0.75386621444106339, 0.74882141513792067,
+		0.74161961210643446, 0.74886085128978863, 0.75579603252750316, 0.7551830327547242,
+		0.86891712056487724, 0.8764258930604899, 0.88592945212121199, 0.9019009834810916,
+		0.90474516180424225, 0.8922112525517768, 0.88458590988753516, 0.87262414331751892,
+		0.87454910636153282, 0.86652340320505861, 0.86798730343191655, 0.87781048485066215,
+		0.87826177800634497, 0.90964764939409226, 0.91055662429245077, 0.90629312336449508,
+		0.91279543446903189, 0.92416613509159151, 0.9144454453569778, 0.90493438124393422,
+		0.90140396325753103, 0.88217986183436603, 0.89624276629693034, 0.89090828277805834,
+		0.90536482503707749, 0.91431453039990085, 0.93803723061680988, 0.93316806365568961,
+		0.9355085908935421, 0.94496423654720718, 0.93837757907662211, 0.93062914387479001,
+		0.91651448257488255, 0.91227395405654998, 0.91565400117173978, 0.91256980454075609,
+		0.92935177914315437, 0.92950141827225119, 0.95075046944536468, 0.95558829150575786,
+		0.96538153559250961, 0.96488206286635403, 0.96208007104446047, 0.95386377925598853,
+		0.95828329244438326, 0.94685134764899093, 0.93956307253990246, 0.93778502026496469,
+		0.94125277686804221, 0.95379551563150589, 0.95681927431840785, 0.97376821441228045,
+		0.98401768023694902, 0.98655366937880284, 0.99876344188307131, 0.97948141167024139,
+		0.97530802307370934, 0.96984496010877286, 0.96267852750054272, 0.96031980300265651,
+		0.96850654562074745, 0.97026140574811193, 0.98320292938681986, 1.0006038105250381,
+		1.0010598270565401, 1.0113986519060192, 1.013458791003921, 1.0078048866756226,
+		1.0053758419817569, 0.99275497186827932, 0.99323014543438426, 0.99238811648197445,
+		0.98810149856478702, 0.98254908610389968, 1.0054768349344554, 1.0079622632165066,
+		1.0275711180686835, 1.0371920844153264, 1.0326666134189948, 1.0320507625623461,
+		1.0317631978518513, 1.0201440330833775, 1.0168192536418139, 1.0099603076587025,
+		1.0118648722952945, 1.0112437252445463, 1.015427077423164, 1.0197126962343677,
+		1.0409001225293184, 1.0560178248033592, 1.0474746391135523, 1.0609035238932203,
+		1.0574042304915936, 1.0394143220992396, 1.0341249809612203, 1.0258963605161096,
+		1.023860678922347, 1.0224653415807519, 1.0288799762804623, 1.0372302571275624,
+		1.0462717492212246, 1.0577281150027795, 1.0560723427711991, 1.0698932151885134,
+		1.0676044235124276, 1.0744870034193896, 1.0609036790346085, 1.0448901140191214,
+		1.0340576074825376, 1.0337216735701482, 1.042038198221916, 1.043813804116396,
+		1.0648645409380579, 1.0654923568405323, 1.0741201800577536, 1.0876667959231348,
+		1.0869098428471478, 1.0873657171181472, 1.0825323213722842, 1.0714947111758293,
+		1.0540087055859493, 1.0546379379163877, 1.0527527744890892, 1.0598752678715586,
+		1.0633794747647118, 1.0721989834759191, 1.0838990342008565, 1.0903807164271582,
+		1.0935211148106136, 1.096164328247125, 1.0835759947818151, 1.075699361421566,
+		1.0783598543166417, 1.0693358479465322, 1.0515850984125519, 1.0608540223002236,
+		1.0704468776769129, 1.0787993118628958, 1.0936039262228523, 1.098802650688699,
+		1.1026195198967008, 1.1040214567498723, 1.1052828825036389, 1.0942184746504084,
+		1.0820250706003989, 1.0783680451382425, 1.0732095824372243, 1.0709137115059226,
+		1.0697178807428345, 1.0810659015425559, 1.0875480298492668, 1.1084586216606951,
+		1.1029562412876557, 1.1121738818087901, 1.1095671065525203, 1.1004553791372755,
+		1.0995269766227727, 1.0890992834847484, 1.0733146006208092, 1.0781028607327936,
+		1.0792818287289894, 1.0752258404655879, 1.0992526066038284, 1.0941597130110008,
+		1.113411137342305, 1.1224922424427284, 1.1183970272726185, 1.1138644241711395,
+		1.1034005799673487, 1.0956865765717401, 1.0944214496783338, 1.0712131037394601,
+		1.0775424387780055, 1.0760416763808662, 1.0860869911620039, 1.0923096817220559,
+		1.0964501841719976, 1.1149402048881221, 1.113452528621083, 1.1164433020228697,
+		1.1032111607972266, 1.1011495504979352, 1.08569481023876, 1.078198686034316,
+		1.0832705844526447, 1.0791617484525711, 1.0972754503040787, 1.0999596065237043,
+		1.0995885879395064, 1.1169353398480346, 1.1262766933894424, 1.1173172595622247,
+		1.1165916530042659, 1.1121619665125004, 1.092595875302071, 1.0815375527787974,
+		1.0828488867563972, 1.0782034121137609, 1.0856650954291553, 1.0925623417625367,
+	};
+	static constexpr double Cheby1Bandpass10Expected[] = {
+		-0.016952555347642784, -0.01651246839146539, -0.016008362174344808, -0.015424448754176777,
+		-0.014740247526275086, -0.013929144849164053, -0.012961488873504116, -0.011811274293197744,
+		-0.010464438248968064, -0.0089264369217704771, -0.0072269215169873053, -0.005419888952391194,
+		-0.0035786240798793062, -0.0017859729206240339, -0.00012170279100543087, 0.0013505719354167315,
+		0.0025943222830350039, 0.0036065309205310907, 0.0044178547843773666, 0.0050861200666645744,
+		0.005684477161545666, 0.0062868704247647624, 0.0069540842576217435, 0.0077235533126341783,
+		0.0086053200792296745, 0.009584901077834683, 0.010631798072483673, 0.011710966433066114,
+		0.0127942729950269, 0.013869349862184945, 0.014943758366444827, 0.016043232352378645,
+		0.017204199992991599, 0.018462376488557065, 0.019840381750757845, 0.02133773977005456,
+		0.022926151588492334, 0.024551659867362834, 0.02614345379057488, 0.02762711559756071,
+		0.028938918510104772, 0.030037812483235359, 0.030912603908598006, 0.031582977320478059,
+		0.032094222145870273, 0.032506788614470788, 0.032883040248890119, 0.03327446052786448,
+		0.033712483778716773, 0.034204954826497366, 0.034738674258451438, 0.035287100432236221,
+		0.035821147669966406, 0.036320300082422582, 0.036781114644175564, 0.037220699040300162,
+		0.037674043277227912, 0.038185850310466923, 0.038799008065128551, 0.039542678623520608,
+		0.040423086295607494, 0.041419392572443758, 0.042485756244107484, 0.043559213199539468,
+		0.044571699901358078, 0.045463668034452703, 0.046196361761088656, 0.04675985583401545,
+		0.047174622245413828, 0.047485979443125846, 0.047752820997775322, 0.048033555811427306,
+		0.048372720031073846, 0.048791432749667484, 0.049283959133970906, 0.049821130853513688,
+		0.050359528184252891, 0.050853754865626072, 0.051268422125561722, 0.05158672799213665,
+		0.051813495877028951, 0.0519720272070089, 0.052095838553482252, 0.052217659481894454,
+		0.052358618464687506, 0.052520509061966245, 0.052683347364212478, 0.052808963299868089,
+		0.052849732099132532, 0.052760493377327133, 0.052511130508664683, 0.052096940409167361,
+		0.051544110470196663, 0.050908587861172451, 0.050268145656908486, 0.049709134304252584,
+		0.049310743665968784, 0.049130054856975136, 0.049190862206515765, 0.049478684275694032,
+		0.049943416593468556, 0.050509374071886798, 0.051090458528774342, 0.051606755694145724,
+		0.051998563053088816, 0.052234664134807325, 0.05231330365936103, 0.052256363304636094,
+		0.052099027627919861, 0.051878123331261107, 0.051622175029988254, 0.05134536532091212,
+		0.051046447367329481, 0.050712465596032721, 0.050325943394049777, 0.049873250985042542,
+		0.049351569618726096, 0.04877233668984092, 0.048160105402524876, 0.047547037681214419,
+		0.0469644018417655, 0.04643326997818676, 0.045956990520818079, 0.045517762535832756,
+		0.045078644670945134, 0.044590804817676563, 0.044004400046880915, 0.043280728989627482,
+		0.042403081661805321, 0.041383721595812654, 0.040264884326476832, 0.039112894653050193,
+		0.038006356266717577, 0.037021094182456749, 0.036215275302967219, 0.035617850233303869,
+		0.035222689632203513, 0.03498972703498314, 0.034852999717561735, 0.034733865916138855,
+		0.034556358390039989, 0.034261225200516117, 0.033815862542817265, 0.033218508834958478,
+		0.032496203294360385, 0.031697086635628036, 0.030878685245477069, 0.030094726195349333,
+		0.029383558711126464, 0.028760992316905168, 0.028219078109160731, 0.027730662680449578,
+		0.0272581628494541, 0.026764073672153683, 0.026220358398129494, 0.025614279941946365,
+		0.024949251663605267, 0.024240665144793883, 0.023508109060577542, 0.022766400575316065,
+		0.022018102938990335, 0.021249799877038376, 0.020433400690951713, 0.019532280109237875,
+		0.018510694873150116, 0.017344135672953405, 0.016027978136137697, 0.014582017949601197,
+		0.013049437669623628, 0.011490238294144773, 0.0099705629965066208, 0.0085501716479459214,
+		0.0072706827116920426, 0.0061473430316366234, 0.0051666632621198815, 0.0042908204748235718,
+		0.0034677440165824351, 0.0026442266728123002, 0.0017787509113678102, 0.00085091597612855716,
+		-0.00013487799359874694, -0.0011525386930595176, -0.0021633809881701094, -0.0031285461988450995,
+		-0.0040211453931542802, -0.0048349523372790901, -0.0055877339196554188, -0.0063186297881501468,
+		-0.0070801412273217307, -0.007926421402349967, -0.0089004909712817812, -0.010023359748353932,
+		-0.011287714518513696, -0.012657856328860377, -0.014076115827670595, -0.015474461203921687,
+		-0.016788753697220736, -0.017972301851827816, -0.019005329776772009, -0.01989792034208188,
+		-0.020685763996045298, -0.021420005473670553, -0.022153840267528323, -0.022929063420019716,
+		-0.023765738624034048, -0.024657487618474302, -0.025573589986737356, -0.026467446538337224,
+		-0.02728935224170435, -0.02800039003094899, -0.028583958506063201, -0.029051965903302304,
+		-0.029443934934249835, -0.029819071685141457, -0.030243294115443901, -0.030774522314910017,
+		-0.031449823073159702, -0.032277416599852012, -0.033235302472864367, -0.034276631358807527,
+		-0.035340452184055515, -0.03636545260115312, -0.037303691059325184, -0.038131050534097155,
+		-0.038851652895125988, -0.039495045947565824, -0.040107116318787751, -0.040737458035200916,
+		-0.041426677115957225, -0.042196782585711468, -0.043046785819386674, -0.043954323264431827,
+		-0.044882752256719699, -0.045791816387510398, -0.046648922641048959, -0.04743784377199272,
+		-0.048162456231619286, -0.048844631582144693, -0.049517078162294108, -0.050213251407693629,
+		-0.050957130489941813, -0.051755637996665056, -0.052595681173880283, -0.05344642067030507,
+		-0.054266094024748877, -0.055011872244681487, -0.055650633861228059, -0.056168233803080551,
+		-0.05657500231292005, -0.056905846426961906, -0.057214413624711205, -0.057562206807536855,
+		-0.058005004966392777, -0.058579942832997139, -0.05929668521653611, -0.060135156100104649,
+		-0.061050472899898858, -0.061983773953202981, -0.062876277566804736, -0.063683342807832652,
+		-0.064385290284842328, -0.06499229635278761, -0.065541943229830285, -0.066089796792131436,
+		-0.066695142318842437, -0.067405181287056054, -0.068241272700383479, -0.069190254001272128,
+		-0.070202851969503682, -0.071199906331961021, -0.072085499964233385, -0.072764305362927828,
+		-0.073159258574863467, -0.073225719649281165, -0.072959533105975805, -0.072398190661951717,
+		-0.071615808241998827, -0.070713510755656711, -0.069807191164648424, -0.069014592819062831,
+		-0.068443425366059851, -0.068181915239264035, -0.068292542666068851, -0.068808540552392772,
+		-0.069731599651986775, -0.071029037993289051, -0.072629658833777005, -0.074418879456272083,
+		-0.076234717269965543, -0.077866868789431026, -0.079061475689522431, -0.079533801412379174,
+		-0.078989693211859877, -0.077154918709180703, -0.073809832421117549, -0.068825241122722966,
+		-0.062193759748240533, -0.054050177382984288, -0.044675176925287934, -0.034478995706858459,
+		-0.023964729618037844, -0.013675123201545712, -0.0041314716954560377, 0.0042240402800033452,
+		0.011072756826536884, 0.016244893918244539, 0.019723873636115795, 0.02163118034397362,
+		0.022196255553107308, 0.021717723587298045, 0.020522555693662514, 0.018929041092965802,
+		0.017217995659915032, 0.015614652996939718, 0.014281378369424891, 0.013319231130593689,
+		0.012775257923343199, 0.012652516375622272, 0.012920427165532614, 0.013523548928352114,
+		0.014387727872819715, 0.015423977264975682, 0.016531673751837159, 0.017603055646462931,
+		0.018530444840582017, 0.019216405913501929, 0.019585712213119499, 0.019596842907534849,
+		0.019250160175273472, 0.018590359316360616, 0.017702017136745168, 0.016698362731177793,
+		0.015704618679490256, 0.014838601560213334, 0.014192304360875915, 0.013818209755128714,
+		0.013723019157390447, 0.013869830780906207, 0.014188060873237842, 0.014588878364077313,
+		0.01498285308201202, 0.015296142383444351, 0.015482021166810231, 0.01552579875008922,
+		0.015442778869904993, 0.015270389081885431, 0.015056599960254297, 0.014847348273829261,
+		0.014675928422508415, 0.01455689738208775, 0.014485790125169366, 0.014444315220741952,
+		0.014409296408102002, 0.014362714682619827, 0.014299897938520399, 0.014233343532348921,
+		0.014190862879136776, 0.014208473808889888, 0.014320117914944256, 0.014547147502027555,
+		0.014890482473044048, 0.015327621706408213, 0.015815472959424735, 0.016298502794876251,
+		0.016720337993817218, 0.017035999846630217, 0.017221780903031413, 0.017280407770984951,
+		0.017240257609012658, 0.017148779448540846, 0.017061678759768096, 0.017030432472404808,
+		0.017090974351630765, 0.017256004657138901, 0.017512677860859017, 0.017826414043894092,
+		0.018150071768016533, 0.0184361199722217, 0.018648513691988382, 0.018771100423723274,
+		0.018810499385107746, 0.018792994635693352, 0.018756433308910997, 0.018739209951943888,
+		0.018769082441839072, 0.018854586728620781, 0.018981168435333966, 0.019113096615723447,
+		0.019201012943587888, 0.019193632364177156, 0.019050790571038624, 0.018754379194327306,
+		0.018314249673737917, 0.017767513912235366, 0.017171264972015089, 0.016590447629466529,
+		0.016083965809854862, 0.01569247409467725, 0.015430692852882821, 0.015285923452092327,
+		0.015222980334779104, 0.015194259137394509, 0.015152497844023076, 0.015063270074040607,
+		0.014914412626826161, 0.01472020307690791, 0.014519007172951237, 0.014364408918096259,
+		0.014311549843289509, 0.014402059926747363, 0.014651661257225073, 0.015043754027325225,
+		0.015530493542160149, 0.016040888863539611, 0.016493869793058981, 0.016813368065370756,
+		0.016942249173473416, 0.016852208251590912, 0.016547517293966894, 0.01606185377351765,
+		0.015449081701380278, 0.01477039856321566, 0.014081253428646473, 0.01342137042841063,
+		0.012810067002389073, 0.012247467060927386, 0.011720762807483976, 0.011213556087368137,
+		0.010715589234111837, 0.01023006599382623, 0.0097763964732358599, 0.0093874590447937372,
+		0.0091020341875812597, 0.0089543631855770814, 0.0089633855017417843, 0.009124334298453508,
+		0.0094052031511645921, 0.0097496439707953891, 0.010086018260973873, 0.010340493343215003,
+		0.010451048538739743, 0.010379166415798927, 0.010116654646997802, 0.0096861653304057341,
+		0.0091353162460014441, 0.0085257891504757072, 0.0079200506792421986, 0.0073688604285137285,
+		0.0069023722636773633, 0.0065267342315312345, 0.006226867229424741, 0.0059746062512232101,
+		0.0057399108684797985, 0.005501961932667913, 0.0052570756095991671, 0.005021341641296184,
+		0.0048272695453148986, 0.004715168627166073, 0.0047212456439727716, 0.0048652910176563259,
+		0.0051411519288248417, 0.0055126566085609415, 0.0059163316042316399, 0.0062706556788044128,
+		0.0064900864870809007, 0.006500938777146816, 0.0062556425750526813, 0.0057421191707257438,
+		0.0049861300775074016, 0.0040462665344410294, 0.0030030103079850584, 0.0019444308011146154,
+		0.00095160039960742542, 8.6858754931575357e-05, -0.00061257423654428943, -0.0011345780025746935,
+		-0.0014863700847064225, -0.0016850088702169874, -0.0017469363557792482, -0.001679582362517807,
+		-0.0014775814667741765, -0.0011248339140039173, -0.00060187606407927021, 0.0001035310226056318,
+		0.00098563455634563101, 0.0020129030415289738, 0.0031255731035032029, 0.0042394199131008895,
+		0.0052550611641073094, 0.00607094229066572, 0.0065975629478529944, 0.0067702146718842653,
+		0.0065575757772641657, 0.005964407849865511, 0.0050281103847266868, 0.0038103647950105974,
+		0.0023862692560315821, 0.00083392585627811841, -0.00077302680560586631, -0.0023687216181903659,
+	};
+
+	static constexpr double Cheby1Highpass10Sections[] = {
+		0.98688863076874034, -0.98688863076874034, 0, -0.98280746216063275,
+		0, 1, -2, 1,
+		-1.9922214066866049, 0.99230389130929275, 1, -2,
+		1, -1.9986044818620536, 0.99864257040792948,
+	};
+	static constexpr double Cheby1Highpass10InitialConditions[] = {
+		-0.98688863076874234, 0, -0, 0,
+		-0, 0,
+	};
+	static constexpr double Cheby1Highpass10Input[] = {
+		0.50248619617215506, 0.51397579434436236, 0.524431935776001, 0.52249554264408882,
+		0.52330662308288955, 0.52076772422394568, 0.51388495179076299, 0.50357705319138069,
+		0.50094808940439506, 0.50595597114108382, 0.50720959357265905, 0.5175016335988375,
+		0.52505086470322204, 0.53146290167348254, 0.53500038906779701, 0.55213053146667967,
+		0.5498188868259879, 0.55624243888187064, 0.5393628247196891, 0.52912968424462481,
+		0.51427456100650404, 0.52620272720037053, 0.52091674913309627, 0.52222641366349642,
+		0.5410858313894753, 0.54471615133901352, 0.56391120788536842, 0.56698525828076829,
+		0.57798617770403982, 0.56882937060332783, 0.57483765455856339, 0.56823964010849526,
+		0.55718603157188962, 0.54312158902267127, 0.53633176747402289, 0.54174676642876518,
+		0.55865574635540571, 0.56948251568919628, 0.57914568757462137, 0.58194612806980472,
+		0.59204017802647535, 0.59590859556832321, 0.58977239369972567, 0.58771885711430905,
+		0.57684634330340467, 0.56193016560023212, 0.56397030033801199, 0.57001739139116969,
+		0.57980346749741996, 0.58173928982017287, 0.58969795089654231, 0.59887335809069875,
+		0.61334543012169784, 0.61468597823444349, 0.61626534789595322, 0.60684665249342984,
+		0.59939997326149852, 0.59534939790925745, 0.59431493973502469, 0.5888546351478875,
+		0.58327438599616122, 0.58711101263331122, 0.59673114640333302, 0.61105908230936978,
+		0.62019432463282276, 0.63519486383487411, 0.63873257670124683, 0.6373475966225105,
+		0.6127446309357153, 0.60893941259435791, 0.60470895848471851, 0.59990779801286021,
+		0.60042866198952116, 0.60149083401021664, 0.62140795459456544, 0.61783888858303049,
+		0.64019353922778133, 0.64578749265035951, 0.64555474770422816, 0.65755253430885197,
+		0.62951117424416847, 0.62572080702185884, 0.62992529527166119, 0.61305116457132913,
+		0.61711226854073631, 0.62281131186082839, 0.61922288360263833, 0.62976228631196873,
+		0.64705116082323477, 0.65311603141146612, 0.65654996680806221, 0.65521601184341649,
+		0.64898087750753986, 0.65095202449927303, 0.64901614350638726, 0.62956693131810437,
+		0.62267510665722003, 0.62580213551824793, 0.63826205395236457, 0.63595819787530594,
+		0.65200784157465297, 0.65371724151441379, 0.65654242655848583, 0.67867671548501707,
+		0.67535065365402036, 0.66937416383870707, 0.65039385353084789, 0.6499047569164893,
+		0.63701295364623589, 0.63226227452672701, 0.63830461959166795, 0.64338731681937122,
+		0.65331787973270983, 0.6560380593999845, 0.67737391736280539, 0.66983716439291419,
+		0.68501869990131103, 0.67620412228408344, 0.66313191583748121, 0.66273197844926679,
+		0.65538199419819565, 0.64210145064977442, 0.63930733954698027, 0.64965399617042707,
+		0.65518879230361204, 0.65809004244448055, 0.66549563544610524, 0.66858409100213256,
+		0.67888961417594895, 0.68622914274930158, 0.67057000962809499, 0.67197426229024937,
+		0.64793852563791454, 0.65481578533065909, 0.64423161187256861, 0.64827768556201981,
+		0.64443035710188412, 0.65825494130296069, 0.67595450383947275, 0.68271553537885621,
+		0.68770289845897259, 0.68712902441786416, 0.68046957395711738, 0.67207474601499417,
+		0.67009335527278502, 0.65212488257814116, 0.64842682241722682, 0.64379105393950853,
+		0.6493880475968602, 0.65619679791578622, 0.66599237598609118, 0.67979129100450142,
+		0.68352330536680728, 0.68421184369886701, 0.68620155533463811, 0.68060045405244685,
+		0.66483601008971893, 0.65671181876548679, 0.64753829075514313, 0.63867552293234386,
+		0.65846887567867707, 0.65093692840245909, 0.65749381578846289, 0.67401175845702355,
+		0.67930892362097628, 0.68711725720550887, 0.69109001980895624, 0.67749199392505766,
+		0.66704492890719735, 0.6629611138314937, 0.65212748867478632, 0.6495295634991034,
+		0.64475190148881245, 0.6485561035266536, 0.65938731985550492, 0.6697664112274142,
+		0.66716449736372252, 0.68774067376180592, 0.68775477030025045, 0.68333126516604215,
+		0.67640060634505794, 0.6763033130767121, 0.65882414692400215, 0.64827934321207814,
+		0.65210749614747776, 0.64826914006013647, 0.65796403410388682, 0.66305799428977241,
+		0.67378863286597879, 0.68510525317142468, 0.68918902139515192, 0.69072062229640641,
+		0.68092443727765728, 0.67443904210229522, 0.66455587618423029, 0.66329295677506617,
+		0.64190663314286567, 0.65555992541690356, 0.65374998863438472, 0.66840068375451178,
+		0.67010130060568029, 0.683816877061864, 0.69132029829057173, 0.68578305946140095,
+		0.67905628960887443, 0.67997893472324333, 0.6741336223527522, 0.66312848323629103,
+		0.65519491823094655, 0.66257163644849959, 0.65819545788103506, 0.65649151501156411,
+		0.66165828532842652, 0.68387652487191819, 0.69218624390301131, 0.69384897447777394,
+		0.69620956922358623, 0.68925361016694353, 0.68232435226865151, 0.672357671411419,
+		0.66628450822591145, 0.65898878673267214, 0.66896354233096711, 0.65931299240745633,
+		0.66631049907865558, 0.67594602646144253, 0.69442679091354598, 0.69161872526095391,
+		0.70498031854038368, 0.70192825719863006, 0.69777454388394167, 0.67908915653508339,
+		0.67273772175228919, 0.66711504302813185, 0.66922602584120139, 0.67128471702655834,
+		0.67035587490564685, 0.68663846165879927, 0.6886985454945197, 0.71158841885736057,
+		0.71712103771260072, 0.70309431807889933, 0.70553239501984932, 0.69858514919375159,
+		0.70293091482136683, 0.67989517422695867, 0.67269744086189676, 0.67660676965212907,
+		0.67986680413661171, 0.69896421424277333, 0.69558455369640215, 0.70403907061345072,
+		0.72646846725441383, 0.72558530720833025, 0.72342832337970719, 0.710723936085769,
+		0.71614589532579986, 0.70103195541284491, 0.69145077221003204, 0.68995773616406364,
+		0.68742722978297299, 0.69378701713942081, 0.70770043946456562, 0.72859944930011022,
+		0.72923000444257036, 0.73569880661324349, 0.74256667584978686, 0.73678879211052029,
+		0.73492740701529391, 0.72900584776990751, 0.70783229413835624, 0.70186829900598247,
+		0.70630058945560115, 0.71336559917137066, 0.71595715822291661, 0.73168439322709966,
+		0.73259571061422235, 0.75298795262221052, 0.74670386442545988, 0.76013675495528943,
+		0.74905598590225364, 0.74205012957473127, 0.73736727949705272, 0.71914235704739216,
+		0.72337819828617456, 0.71647064912982394, 0.72841026320835167, 0.74990576805431242,
+		0.75370571882360771, 0.76576284109474424, 0.78207168730114374, 0.7760374768599364,
+		0.76969818347521424, 0.76193231902708725, 0.75394169659071508, 0.75902151463905454,
+		0.75227094847714326, 0.74207690999908227, 0.75736953527339301, 0.75474840381194142,
+		0.8693683224675548, 0.88424230106132762, 0.8922374535674753, 0.88877213611726291,
+		0.89848085734195438, 0.87802380575628203, 0.87886721548353464, 0.87389342381448087,
+		0.88427893075018715, 0.86881182749396213, 0.87227150521368768, 0.87584196743862708,
+		0.87919631532057574, 0.89145027519485798, 0.91447288107366587, 0.92724159922769234,
+		0.92219712135300835, 0.91376895960342841, 0.91267567433287844, 0.90882990895059379,
+		0.90140380993073266, 0.88604540506919138, 0.88752601343699999, 0.89643046708808294,
+		0.90392259005289843, 0.91473008900866992, 0.93854180574077772, 0.93408766626662343,
+		0.94490294979066047, 0.94057952382670873, 0.9363354484433698, 0.92614093234736883,
+		0.93155536358426849, 0.9161030600726987, 0.90344011469457752, 0.91104513779336693,
+		0.92551516174599047, 0.93998470691948754, 0.95235754533097972, 0.96166657342294637,
+		0.96386640042974647, 0.97453307442943349, 0.96060567481007619, 0.95551917158318,
+		0.95166215575657698, 0.95271165673119806, 0.93872410293320552, 0.94842973853785306,
+		0.9397391810340644, 0.95028942351706813, 0.96771171459822158, 0.98185529464671917,
+		0.98580302413061871, 1.0012634380515451, 0.98638147627283257, 0.98778991232427238,
+		0.96657533510797988, 0.98182906798661662, 0.95949830084449061, 0.97357909742925242,
+		0.96065355908189409, 0.96969494167270009, 0.98421668799304951, 0.98677872496825236,
+		1.0099745167571934, 1.0138627931115027, 1.020952536027036, 0.99971577890270269,
+		1.0034357735874795, 0.99631145819368983, 0.99050313602747253, 0.98764678066017819,
+		0.98560205873862439, 0.98608738467448442, 1.0114540081939196, 1.016645957145043,
+		1.0170223525090609, 1.0303853189709853, 1.031303441614102, 1.0368795270011115,
+		1.0217914471122627, 1.0323461207914093, 1.0189935406455795, 0.99931396209315249,
+		1.0082941990290868, 1.0048527689930395, 1.0097261628450735, 1.0208868448761235,
+		1.027496888626694, 1.045540633653729, 1.0544600583840402, 1.0525865472494962,
+		1.0481606849951512, 1.0387309587885019, 1.0395752464578802, 1.0284304956744952,
+		1.0268487113079627, 1.0149143722940144, 1.0336870545480865, 1.0310339227288923,
+		1.048242601625812, 1.0692781360331529, 1.0664506206466315, 1.0778793851447632,
+		1.0706557211552801, 1.0725911843390141, 1.054280865473912, 1.0456879733193716,
+		1.0443640278638266, 1.0441690831141333, 1.0359375887257256, 1.0336792788935136,
+		1.0496322619894678, 1.0715522462178573, 1.0714768372560126, 1.0901934006788205,
+		1.0863762829030401, 1.0833546247388066, 1.072082327154926, 1.0699498911643883,
+		1.057246850424062, 1.0565545483452423, 1.0584432637925869, 1.0474590754372,
+		1.05996141708195, 1.0811222011176447, 1.0911206387777377, 1.0972208006176283,
+		1.099531662212945, 1.0892860321068636, 1.0851984297347341, 1.0779096038769422,
+		1.0744684279975429, 1.06596480120702, 1.0729147122576073, 1.0592125783150281,
+		1.0833388354201123, 1.0804200903948764, 1.0847178738341732, 1.0967209138429326,
+		1.1043955031560095, 1.1040214484392243, 1.0978271662221122, 1.0904977446821587,
+		1.0921083711148194, 1.0734826767540435, 1.0699747271650277, 1.0728650706088678,
+		1.0716060731584849, 1.0807634686050884, 1.0942064676394634, 1.0924317147580915,
+		1.1120190862189374, 1.1152255423510229, 1.1008592458414355, 1.1078524192739971,
+		1.1003368719074427, 1.0857361029503148, 1.0687903939222476, 1.0735857362374002,
+		1.0752842899380353, 1.0821976645384281, 1.0917061087075524, 1.0929118119309724,
+		1.1026363853667258, 1.1080358552680392, 1.117100457770055, 1.1110339087075884,
+		1.0944067920431297, 1.0989951839019887, 1.0779971378405813, 1.0821087773933589,
+		1.065566146123375, 1.0859028774575559, 1.0838238178973798, 1.0946132364460202,
+		1.1054691015229305, 1.1124982969538781, 1.1141887065581142, 1.1223368057086456,
+		1.1191850464709565, 1.0976842778506064, 1.0865700151544824, 1.0910329531195615,
+		1.0755891485157427, 1.085762349197364, 1.0852198009142149, 1.0831315141471061,
+		1.1046431862844774, 1.1125430623728141, 1.125360429706397, 1.119133454352065,
+		1.115939548333803, 1.1097424608625164, 1.0964671432865614, 1.0840738544356712,
+		1.0830828406482482, 1.0822835677608489, 1.0826870410318092, 1.0909705741145017,
+	};
+	static constexpr double Cheby1Highpass10Expected[] = {
+		-0.0026457831826103926, 0.0082176182817556443, 0.018043169762784424, 0.015472555499393442,
+		0.015645850803873013, 0.012465361267739786, 0.0049367010196652572, -0.0060223401648405788,
+		-0.009308765630104264, -0.0049651410350505304, -0.0043824709941495572, 0.0052322961968442952,
+		0.012098656254240728, 0.017823018023439895, 0.0206685819517613, 0.037103310154377706,
+		0.034093664791160536, 0.039817035779105038, 0.022234706028882112, 0.011295021618712616,
+		-0.0042722083236667232, 0.0069372814626988159, 0.00092600458844390929, 0.0015036624374323362,
+		0.019624686229640427, 0.022511341471729118, 0.04095865845723444, 0.043282083714366454,
+		0.053530418755563913, 0.043619380315946039, 0.048871580767348211, 0.041515353193868565,
+		0.029700688699305082, 0.014870896224807501, 0.0073098832392924657, 0.011947015979765885,
+		0.028071920774628938, 0.038109747681951925, 0.046980396081117225, 0.048985558828937806,
+		0.058282175663878541, 0.061351649794030724, 0.054415184130729155, 0.051559587726107484,
+		0.039882422775318525, 0.024157678342073552, 0.025384008369477764, 0.03061175416789829,
+		0.039573506048054916, 0.040680696140072588, 0.047806909391439015, 0.056146709027120746,
+		0.069781084522379688, 0.070282879358047418, 0.071022848856027665, 0.060763806015002149,
+		0.05247493774544882, 0.047579328719005651, 0.045696344908960573, 0.039383526757834061,
+		0.032946101351626858, 0.035920357583765439, 0.044673132983613903, 0.058129702449266331,
+		0.06639085201638073, 0.080515860685241525, 0.083177747195006979, 0.080917127186730831,
+		0.055437851983523974, 0.050753880395571424, 0.045640997019461359, 0.039953083182197813,
+		0.039582335192469766, 0.039747822030791205, 0.058763730367179724, 0.054289916209139269,
+		0.07573720879988198, 0.080422470837145821, 0.079280575391185285, 0.090369141547109122,
+		0.061418238162926561, 0.056716441428414963, 0.060006547834553968, 0.042214594973607453,
+		0.045353551174778406, 0.050125911783682094, 0.04560650639189482, 0.055210794089952976,
+		0.071561347305938494, 0.076686116893318182, 0.079179047973440567, 0.076903423912289798,
+		0.069725682525878949, 0.070752821811423339, 0.067871300618318253, 0.047474070169301705,
+		0.039630310891454121, 0.041800481836169134, 0.053298874937850745, 0.050029501630121521,
+		0.06511025704854706, 0.065848248472306442, 0.067700079638009336, 0.088859862663975331,
+		0.084559368039784311, 0.077608714565867917, 0.057653390604078245, 0.056187007214847096,
+		0.04231457098536838, 0.036578895704978083, 0.041631306775616654, 0.045719424078963337,
+		0.054651466662102369, 0.056369937819908809, 0.076701924688637207, 0.068160199742334615,
+		0.082336231934544979, 0.072515967651336888, 0.058437352351791171, 0.057029149861483872,
+		0.048668337498132458, 0.034373481845256126, 0.030560403914740977, 0.039883117250845014,
+		0.044389634354744648, 0.04625893756143714, 0.052629416507969082, 0.054680154649593228,
+		0.063946015013939705, 0.07024481019228121, 0.053544095995653997, 0.053905184276102525,
+		0.028823535030049828, 0.034650882720093298, 0.023012117058899256, 0.025998557609158944,
+		0.021086312043055819, 0.033840949410655699, 0.05046673293043339, 0.056151787510082179,
+		0.060062015772637256, 0.058410287257564926, 0.050672131242139859, 0.041197030909475477,
+		0.038132992076827139, 0.019078540478506656, 0.014289876260217981, 0.0085579341428993205,
+		0.013052921202302326, 0.018754192658240968, 0.027437651050003679, 0.040120974006315119,
+		0.042735120836111161, 0.042304136833136552, 0.043172846124383157, 0.036449196841967985,
+		0.019559870971452301, 0.010307066026560086, -8.2263999034645763e-08, -0.010002575954955567,
+		0.0086446956769257455, -3.9026163559715416e-05, 0.0053606959752591325, 0.020716710645220255,
+		0.024848499036279045, 0.031489021253617105, 0.034292250756461105, 0.019522999570880023,
+		0.0079019689419352786, 0.002640252750339623, -0.0093761293026127027, -0.013162554665510588,
+		-0.019135121318510299, -0.016532515474373437, -0.0069092124186505245, 0.0022566899865878592,
+		-0.00156285426525005, 0.017791986892876897, 0.016582165754919571, 0.010932609454120952,
+		0.0027732537530963837, 0.0014440272686057146, -0.017271086245118139, -0.029057261657807899,
+		-0.026476988788880648, -0.031569975146171977, -0.023136326270882135, -0.019309646642562673,
+		-0.0098514455281382349, 0.00018867664747426651, 0.0029929691941197462, 0.0032427053336214675,
+		-0.0078378572800175683, -0.0156109256803608, -0.026786087348902789, -0.029346197850543952,
+		-0.052035970799978584, -0.0396933476185862, -0.04282109811132602, -0.029494668539052825,
+		-0.029123942135709003, -0.016742977779020327, -0.010577841346985521, -0.017456394122483752,
+		-0.025527871868738131, -0.025953927698915927, -0.03315231273767863, -0.0455156083316463,
+		-0.054813548870636303, -0.048808071532300358, -0.054562343965429382, -0.057651389598232718,
+		-0.053876874983364624, -0.033057182606147706, -0.026150627564402916, -0.025894528519476954,
+		-0.02494368220202773, -0.033312595027821176, -0.041658640209731132, -0.053046941204672585,
+		-0.060547622843948518, -0.069277722097030786, -0.060744603089170866, -0.071844038012968708,
+		-0.066302817252999108, -0.058130640584398409, -0.041119031392225364, -0.045400827301912333,
+		-0.033516839821688488, -0.03804984552083697, -0.043687840272373872, -0.063861843557752401,
+		-0.07170776433014793, -0.078832009423016436, -0.078230238020533208, -0.077688484583486678,
+		-0.080141935106969819, -0.065391237741517172, -0.064869418941382651, -0.043522994215248918,
+		-0.039537513774604814, -0.055114575882298025, -0.054230765400468291, -0.062736802833346761,
+		-0.059954686017422806, -0.084559693334763653, -0.093333906055180105, -0.09100940294374428,
+		-0.089342551165309828, -0.071845922533854287, -0.076832950595002336, -0.06999189738419434,
+		-0.049181116428407064, -0.051686605861898764, -0.05546921724700056, -0.069803212088015015,
+		-0.06601565136272762, -0.082769437867654352, -0.093997099234019527, -0.097144472739673346,
+		-0.10133778433032818, -0.096649433071268581, -0.084415512801103029, -0.065202576413514596,
+		-0.066263136354106869, -0.061489797571376653, -0.056321295072659247, -0.063802186388077664,
+		-0.067370590372260716, -0.075003819024640886, -0.097894919459685315, -0.10558415083905173,
+		-0.10288583159804016, -0.097563413920261438, -0.096722620336478188, -0.082753674859726414,
+		-0.083607314609909944, -0.064985753809665675, -0.073045382313097429, -0.061392454426785044,
+		-0.07425752749590632, -0.083052709884553905, -0.089531013606519383, -0.10955877056692249,
+		-0.10713447038383117, -0.11586298721744218, -0.10575391881195403, -0.086097605920404191,
+		-0.084143955231158279, -0.073939235317944621, -0.059487798035724904, -0.067383498458653657,
+		-0.075588665764323923, -0.085225826882776634, -0.095094311710856264, -0.091899730480519734,
+		-0.10054329561728882, -0.1126389088410962, -0.099257047546353935, -0.10379785787635891,
+		0.008896956344971868, 0.021847409525214401, 0.027924937261941972, 0.022548457248072043,
+		0.030352541963967843, 0.0079969866650511506, 0.0069468564019925828, 8.3520902080665496e-05,
+		0.0085832679423575899, -0.0087660504151810571, -0.007185805021657608, -0.0054923883942554659,
+		-0.004012524262372745, 0.006369948303136877, 0.02752535295962303, 0.038433055270678917,
+		0.031534819371620386, 0.021259749721495916, 0.018325482744186723, 0.012643997498239377,
+		0.0033867257365905509, -0.013799554780918086, -0.014144852018557112, -0.0070646613302366209,
+		-0.0013945737904695263, 0.0075939414629629352, 0.029591100422656696, 0.023328237093464373,
+		0.032341190338975742, 0.026222002708714935, 0.020188462636003227, 0.0082098796774718822,
+		0.011844859075042687, -0.0053829295945442626, -0.019818742759221269, -0.013985168375223803,
+		-0.0012848605904187474, 0.011418038767454321, 0.022028784293670504, 0.029581538339316947,
+		0.030031716752578264, 0.038955911534315414, 0.023293304245667175, 0.016478010140389514,
+		0.010897596969847457, 0.010228561009713371, -0.0054733208113682038, 0.0025215013949771289,
+		-0.0078766277484602337, 0.00096919806607468836, 0.016690953459818664, 0.029139500675302937,
+		0.031399026618940867, 0.045179029311701743, 0.028624887375785169, 0.028368826253416593,
+		0.0054962759467343117, 0.019097629578111688, -0.0048804679051227687, 0.0075574351501587781,
+		-0.0070069226502648841, 0.00039948458907509629, 0.013290545577058572, 0.0142272658663413,
+		0.035804256134727541, 0.038081696052518349, 0.043569575408638171, 0.020739697231021325,
+		0.022874228205199652, 0.014171347444807143, 0.0067907396313304797, 0.0023676033715964596,
+		-0.001238926129848425, -0.0023107505278125995, 0.021503991092373876, 0.025150906363305553,
+		0.023990087482497487, 0.035824126495771859, 0.035222340945691918, 0.039288054748752278,
+		0.022698944069211198, 0.031761403025298195, 0.016925104540968024, -0.0042308710434162955,
+		0.0032788793452498653, -0.0016273746638705705, 0.0017869765463301331, 0.011494833452570713,
+		0.016659199320439688, 0.033265604924305324, 0.040757499135802851, 0.037467209703995127,
+		0.031635266577273786, 0.020809476152639839, 0.020266969702445053, 0.0077440580788740998,
+		0.004791987023461456, -0.008505618463953488, 0.0089105543122779251, 0.0049083005940398529,
+		0.020776109826139505, 0.040480559687410496, 0.036333390418216246, 0.046454688048845089,
+		0.037936082587971959, 0.038589053635377013, 0.019007999943530224, 0.0091547907777746913,
+		0.0065798038307435065, 0.0051427173533212522, -0.004322347870553649, -0.0078062548078545024,
+		0.0069291753536717196, 0.027641178998211037, 0.026369137528194912, 0.04390161605235271,
+		0.038913954770336323, 0.03473552482929701, 0.022319582335788297, 0.019055789239149377,
+		0.0052328269218740913, 0.0034311894850348147, 0.0042207914776354258, -0.0078525212062830526,
+		0.0035704640710246954, 0.023662727795943528, 0.032605444008325969, 0.037664120218161637,
+		0.038948487605345597, 0.027691390555947649, 0.02260670337375028, 0.014334429614363708,
+		0.0099228091774498164, 0.00046109333902779465, 0.006464901833109547, -0.0081715585345235719,
+		0.015032300743381815, 0.01120408302154375, 0.014606045654282973, 0.025727498611027716,
+		0.032535870521017404, 0.031311836443711862, 0.024283894859021011, 0.016136592688476212,
+		0.016944605084480049, -0.0024690507284080522, -0.0067514145090346719, -0.004622547178149753,
+		-0.006629974180184163, 0.0017924052677486119, 0.014514802431502084, 0.012034978477760534,
+		0.030933785192663359, 0.033469496821619996, 0.018450721512216543, 0.02480922302809601,
+		0.016676675908322888, 0.0014760044100178248, -0.016054015658656919, -0.011828595842212518,
+		-0.010685631553411058, -0.0043129415568368126, 0.0046705956819150293, 0.0053681083494655536,
+		0.014601983844239868, 0.019529160617946486, 0.028140896924856496, 0.021641569508085219,
+		0.0046013085452486016, 0.0087952874980570389, -0.012579150094569627, -0.0088267336159589399,
+		-0.025712149987053644, -0.0057018713099749267, -0.0080902304127951838, 0.0024080128616317253,
+		0.012991902907271789, 0.019769679006707834, 0.021230195000842726, 0.029170658125016673,
+		0.025834144582733254, 0.0041710935775278388, -0.0070845175196482431, -0.0027429862609391915,
+		-0.018288593623527961, -0.0081978850050983681, -0.0088032845570886649, -0.0109343694025805,
+		0.010555268035978751, 0.018455550978759488, 0.031297487699451648, 0.025120282626714459,
+		0.022001483601896073, 0.015904499368101763, 0.002753642857760346, -0.009491951276530396,
+		-0.010312973751471294, -0.010920173468756364, -0.010302365646984944, -0.001781738449543083,
+	};
+
+}
@@ -0,0 +1,109 @@
+#include "pch.h"
+#include "Core/Log.h"
+#include "NIRS/GLM.h"
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+// GLMSolver conditioning and t-values of both solver methods
+
+namespace Utils {
+
+	static constexpr size_t NUM_SAMPLES = 2000;
+	static constexpr double SAMPLING_RATE = 10.0;
+
+	// QR recovers the betas of the near collinear design to about 1e-10, both methods agree to about 1e-13 on a well posed one
+	static constexpr double COLLINEAR_BETA_TOLERANCE = 1e-9;
+	static constexpr double AGREEMENT_TOLERANCE = 1e-12;
+
+	static NIRS::GLMDesign task_design()
+	{
+		NIRS::GLMDesignSpecification spec;
+		NIRS::GLMCondition condition;
+		for (double onset = 10.0; onset < 180.0; onset += 30.0) {
+			condition.Events.push_back({ onset, 10.0, 1.0 });
+		}
+		spec.Conditions.push_back(condition);
+		return NIRS::BuildDesignMatrix(spec, NUM_SAMPLES, SAMPLING_RATE);
+	}
+
+	static std::vector<double> simulate(const NIRS::GLMDesign& design, const Eigen::VectorXd& betas, double noise, unsigned seed)
+	{
+		std::mt19937 rng(seed);
+		std::normal_distribution<double> normal(0.0, noise);
+		Eigen::VectorXd y = design.X * betas;
+		std::vector<double> channel(y.data(), y.data() + y.size());
+		for (auto& value : channel) value += normal(rng);
+		return channel;
+	}
+
+	// A second condition that is the first plus a trace of noise, X'X is singular to working precision
+	static bool near_collinear_design()
+	{
+		NIRS::GLMDesign design = task_design();
+		Eigen::Index p = design.X.cols();
+		std::mt19937 rng(7);
+		std::normal_distribution<double> normal(0.0, 1e-7);
+		design.X.conservativeResize(Eigen::NoChange, p + 1);
+		for (Eigen::Index i = 0; i < design.X.rows(); i++) design.X(i, p) = design.X(i, 0) + normal(rng);
+		design.Regressors.push_back("Collinear");
+
+		NIRS::GLMSolver cholesky(design, NIRS::GLMSolverMethod::Cholesky);
+		NIRS::GLMSolver qr(design, NIRS::GLMSolverMethod::QR);
+		if (cholesky.IsValid() || !qr.IsValid()) {
+			NVIZ_ERROR("Near collinear design : Cholesky valid {}, QR valid {}, expected false and true", cholesky.IsValid(), qr.IsValid());
+			return false;
+		}
+
+		Eigen::VectorXd betas = Eigen::VectorXd::LinSpaced(p + 1, 1.0, 2.0);
+		auto channel = simulate(design, betas, 0.0, 1);
+		const double* channels[] = { channel.data() };
+		auto result = qr.Fit(channels, 1);
+
+		double error = (result.Betas.col(0) - betas).cwiseAbs().maxCoeff();
+		if (!(error < COLLINEAR_BETA_TOLERANCE) || !result.TValues.col(0).allFinite()) {
+			NVIZ_ERROR("Near collinear design : QR betas off by {}", error);
+			return false;
+		}
+		NVIZ_INFO("Near collinear design : Cholesky rejects it, QR betas off by {}", error);
+		return true;
+	}
+
+	// Both methods agree where both apply, the QR t-values come from R and its column permutation
+	static bool methods_agree()
+	{
+		NIRS::GLMDesign design = task_design();
+		Eigen::VectorXd betas = Eigen::VectorXd::LinSpaced(design.X.cols(), 0.5, -0.5);
+		auto channel = simulate(design, betas, 0.1, 2);
+		const double* channels[] = { channel.data() };
+
+		NIRS::GLMSolver cholesky(design, NIRS::GLMSolverMethod::Cholesky);
+		NIRS::GLMSolver qr(design, NIRS::GLMSolverMethod::QR);
+		if (!cholesky.IsValid() || !qr.IsValid()) {
+			NVIZ_ERROR("Task design : Cholesky valid {}, QR valid {}", cholesky.IsValid(), qr.IsValid());
+			return false;
+		}
+
+		auto a = cholesky.Fit(channels, 1);
+		auto b = qr.Fit(channels, 1);
+		double beta_error = (a.Betas - b.Betas).cwiseAbs().maxCoeff();
+		double t_error = ((a.TValues - b.TValues).array() / a.TValues.array().abs().max(1.0)).abs().maxCoeff();
+		if (!(beta_error < AGREEMENT_TOLERANCE) || !(t_error < AGREEMENT_TOLERANCE)) {
+			NVIZ_ERROR("Task design : QR and Cholesky differ by {} in betas, {} in t-values", beta_error, t_error);
+			return false;
+		}
+		NVIZ_INFO("Task design : QR and Cholesky differ by {} in betas, {} in t-values", beta_error, t_error);
+		return true;
+	}
+}
+
+int main()
+{
+	Log::Init();
+
+	int failures = 0;
+	failures += !Utils::near_collinear_design();
+	failures += !Utils::methods_agree();
+	return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,212 @@
+#include "pch.h"
+#include "Core/Log.h"
+#include "Core/SIMD.h"
+#include "Core/InstructionSet.h"
+#include "NIRS/OpticalDensity.h"
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+
+// SIMD::Log against std::log over the positive normal range, and the optical density conversions on dropouts
+// (zero, negative, subnormal, below MinimumIntensity and NaN). Built with the flags of the kernels, so SIMD::Log
+// here is the one of the build's instruction set
+
+namespace Utils {
+
+	static constexpr int64_t MAX_LOG_ULPS = 1;
+	// Optical density is a difference of two logs, its error scales with the logs and not with the result
+	static constexpr double OD_TOLERANCE = 1e-14;
+
+	int64_t ordered_bits(double value)
+	{
+		int64_t bits = 0;
+		std::memcpy(&bits, &value, sizeof(bits));
+		return bits < 0 ? std::numeric_limits<int64_t>::min() - bits : bits;
+	}
+
+	int64_t ulp_distance(double a, double b)
+	{
+		int64_t distance = ordered_bits(a) - ordered_bits(b);
+		return distance < 0 ? -distance : distance;
+	}
+
+	std::vector<double> log_inputs()
+	{
+		std::vector<double> inputs = { std::numeric_limits<double>::min(), std::numeric_limits<double>::max(), 1.0 };
+
+		// Every binade, at the edges of the reduction to [sqrt(2) / 2, sqrt(2))
+		const double sqrt2 = std::sqrt(2.0);
+		const double mantissas[] = { 1.0, std::nextafter(1.0, 2.0), 1.1, std::nextafter(sqrt2, 0.0), sqrt2, std::nextafter(sqrt2, 2.0), 1.5, std::nextafter(2.0, 0.0) };
+		for (int exponent = -1022; exponent <= 1023; exponent++) {
+			for (double mantissa : mantissas) {
+				inputs.push_back(std::ldexp(mantissa, exponent));
+			}
+		}
+
+		// Around 1, where the result is small and a cancellation would show first
+		double below = 1.0, above = 1.0;
+		for (int i = 0; i < 1000; i++) {
+			below = std::nextafter(below, 0.0);
+			above = std::nextafter(above, 2.0);
+			inputs.push_back(below);
+			inputs.push_back(above);
+		}
+
+		// Log-uniform over the range of raw intensities
+		std::mt19937_64 rng(17);
+		std::uniform_real_distribution<double> exponent(-12.0, 12.0);
+		for (int i = 0; i < 1000000; i++) {
+			inputs.push_back(std::pow(10.0, exponent(rng)));
+		}
+		return inputs;
+	}
+
+	bool check_log()
+	{
+		using SIMD::DoubleVec;
+		constexpr size_t WIDTH = DoubleVec::Width;
+
+		auto inputs = log_inputs();
+		inputs.resize((inputs.size() + WIDTH - 1) / WIDTH * WIDTH, 1.0);
+		std::vector<double> outputs(inputs.size());
+		for (size_t i = 0; i < inputs.size(); i += WIDTH) {
+			SIMD::Log(DoubleVec::Load(inputs.data() + i)).Store(outputs.data() + i);
+		}
+
+		int64_t worst = 0;
+		double worst_input = 1.0;
+		for (size_t i = 0; i < inputs.size(); i++) {
+			int64_t distance = ulp_distance(outputs[i], std::log(inputs[i]));
+			if (distance > worst) {
+				worst = distance;
+				worst_input = inputs[i];
+			}
+		}
+		if (worst > MAX_LOG_ULPS) {
+			NVIZ_ERROR("SIMD::Log ({}) : {} ulp from std::log at {}", SIMD::InstructionSet, worst, worst_input);
+			return false;
+		}
+		NVIZ_INFO("SIMD::Log ({}) : at most {} ulp from std::log over {} inputs", SIMD::InstructionSet, worst, inputs.size());
+		return true;
+	}
+
+	// Dropouts, each of which has to come out as 0, and valid intensities close to them
+	std::vector<double> intensity_inputs()
+	{
+		const double nan = std::numeric_limits<double>::quiet_NaN();
+		const double denormal = std::numeric_limits<double>::denorm_min();
+		const double minimum = NIRS::MinimumIntensity;
+		const double dropouts[] = { nan, -nan, 0.0, -0.0, -1.0, -1e-300, denormal, 1000.0 * denormal, std::numeric_limits<double>::min() / 2.0,
+			std::numeric_limits<double>::min(), 1e-300, 1e-12, std::nextafter(minimum, 0.0) };
+		const double valid[] = { minimum, std::nextafter(minimum, 1.0), 2e-9, 1e-6, 0.5, 1.0, 3.7, 1e4, 1e9 };
+
+		// Every value in every lane of the vector body and again in the scalar tail
+		std::vector<double> inputs;
+		for (size_t shift = 0; shift < SIMD::DoubleVec::Width; shift++) {
+			inputs.insert(inputs.end(), shift, 1.0);
+			inputs.insert(inputs.end(), std::begin(dropouts), std::end(dropouts));
+			inputs.insert(inputs.end(), std::begin(valid), std::end(valid));
+		}
+		inputs.insert(inputs.end(), std::begin(dropouts), std::end(dropouts));
+		return inputs;
+	}
+
+	double expected_od(double raw, double baseline)
+	{
+		if (!(raw >= NIRS::MinimumIntensity)) return 0.0;
+		return std::log10(std::max(NIRS::MinimumIntensity, baseline) / raw);
+	}
+
+	bool check_od(const char* name, const std::vector<double>& raw, const std::vector<double>& baselines, const std::vector<double>& od)
+	{
+		double worst = 0.0;
+		size_t unmasked = 0;
+		for (size_t i = 0; i < raw.size(); i++) {
+			double expected = expected_od(raw[i], baselines[i]);
+			if (expected == 0.0 && od[i] != 0.0) {
+				unmasked++;
+				continue;
+			}
+			double error = std::abs(od[i] - expected);
+			worst = std::isnan(error) ? std::numeric_limits<double>::infinity() : std::max(worst, error);
+		}
+		if (unmasked || !(worst <= OD_TOLERANCE)) {
+			NVIZ_ERROR("{} : {} dropouts not zeroed, max deviation from std::log10 {}", name, unmasked, worst);
+			return false;
+		}
+		NVIZ_INFO("{} : dropouts zeroed, max deviation from std::log10 {}", name, worst);
+		return true;
+	}
+
+	bool check_optical_density()
+	{
+		auto raw = intensity_inputs();
+		bool passed = true;
+
+		for (double baseline : { 1.0, 2e-9, 1e6 }) {
+			std::vector<double> od(raw.size());
+			NIRS::ConvertToOpticalDensity(raw.data(), od.data(), raw.size(), baseline);
+			passed = check_od("ConvertToOpticalDensity", raw, std::vector<double>(raw.size(), baseline), od) && passed;
+
+			// In place like the pipeline runs it
+			std::vector<double> in_place = raw;
+			NIRS::ConvertToOpticalDensity(in_place.data(), in_place.data(), in_place.size(), baseline);
+			passed = check_od("ConvertToOpticalDensity in place", raw, std::vector<double>(raw.size(), baseline), in_place) && passed;
+
+			// One sample at a time only runs the scalar tail
+			for (size_t i = 0; i < raw.size(); i++) {
+				NIRS::ConvertToOpticalDensity(raw.data() + i, od.data() + i, 1, baseline);
+			}
+			passed = check_od("ConvertToOpticalDensity tail", raw, std::vector<double>(raw.size(), baseline), od) && passed;
+		}
+
+		// Float storage, the samples are rounded to float after the double computation
+		std::vector<float> raw_float(raw.begin(), raw.end());
+		std::vector<float> od_float(raw.size());
+		NIRS::ConvertToOpticalDensity(raw_float.data(), od_float.data(), raw_float.size(), 1.0);
+		size_t mismatches = 0;
+		for (size_t i = 0; i < raw.size(); i++) {
+			float expected = static_cast<float>(expected_od(static_cast<double>(raw_float[i]), 1.0));
+			float tolerance = std::numeric_limits<float>::epsilon() * std::max(1.0f, std::abs(expected));
+			mismatches += !(std::abs(od_float[i] - expected) <= tolerance);
+		}
+		if (mismatches) {
+			NVIZ_ERROR("ConvertToOpticalDensity (float) : {} samples off by more than a float ulp", mismatches);
+			passed = false;
+		}
+		else {
+			NVIZ_INFO("ConvertToOpticalDensity (float) : dropouts zeroed, within a float ulp of std::log10");
+		}
+
+		// A baseline per element, the dropout values as baselines too
+		std::vector<double> baselines(raw.size());
+		for (size_t i = 0; i < raw.size(); i++) {
+			baselines[i] = raw[(i * 7 + 3) % raw.size()];
+		}
+		std::vector<double> od(raw.size());
+		NIRS::ConvertFrameToOpticalDensity(raw.data(), baselines.data(), od.data(), raw.size());
+		passed = check_od("ConvertFrameToOpticalDensity", raw, baselines, od) && passed;
+
+		for (size_t i = 0; i < raw.size(); i++) {
+			NIRS::ConvertFrameToOpticalDensity(raw.data() + i, baselines.data() + i, od.data() + i, 1);
+		}
+		return check_od("ConvertFrameToOpticalDensity tail", raw, baselines, od) && passed;
+	}
+}
+
+int main()
+{
+	Log::Init();
+	if (!SIMD::CheckInstructionSet()) {
+		return 1;
+	}
+
+	int failures = 0;
+	failures += !Utils::check_log();
+	failures += !Utils::check_optical_density();
+	return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,724 @@
+#pragma once
+
+// Generated by Utilities/py/tddr_reference.py (transcription of MNE's _TDDR, not MNE itself), do not edit
+namespace TDDRReference {
+
+	static constexpr double ShiftSamplingRate = 10.0;
+	static constexpr double ShiftInput[] = {
+		0.99977519959909766, 1.0038486618700138, 1.000677181620143, 1.0017366227215525,
+		1.0032654731497905, 1.0047808369850364, 1.0053337627790042, 1.0078516402201414,
+		1.0106083171407718, 1.0100475513920899, 1.0116182718125724, 1.0125665444072844,
+		1.0135270073224902, 1.0165108134501355, 1.0159916512401859, 1.0139053929372739,
+		1.0201286881316067, 1.0184428286628706, 1.0201569408416336, 1.0172558746828038,
+		1.0222039230703819, 1.0156470375669455, 1.0199542923456266, 1.0181133643108218,
+		1.0198490459622986, 1.0203259070481006, 1.0208476557461643, 1.0219159347125732,
+		1.0171855092031206, 1.0190051144861929, 1.0211332240885473, 1.0175233591490025,
+		1.0160837573021135, 1.0185231245969792, 1.0120840554877772, 1.0148084963677777,
+		1.0108039797587107, 1.0202242049434138, 1.0088912678422184, 1.0127300592360826,
+		1.0097719477995672, 1.010405343954264, 1.0085420853127605, 1.0090373349075374,
+		1.0103398762277818, 1.0079788597100601, 1.0033026230659667, 1.0080952765940381,
+		0.99915503708491571, 1.0007075640541678, 0.99921544133976226, 0.99554238380004889,
+		0.99813445481566554, 0.99577007648424232, 0.99511542540856279, 0.99498411030439682,
+		0.99286305790474327, 0.99147151242713838, 0.99135666572241954, 0.98868823557619478,
+		0.98863659754311073, 0.9849687055384706, 0.98519519753201901, 0.98694638238075583,
+		0.98517704728198763, 0.98015633980623151, 0.98312736183877236, 0.98164979529236207,
+		0.98117346235995462, 0.97958925871426661, 0.98353330826363883, 0.97921134696164858,
+		0.98292277569013842, 0.98098821574096562, 0.98077134906106778, 0.98117667146705267,
+		0.97837258359163204, 0.98095878459212993, 0.98108599721323009, 0.97968253530283866,
+		0.98065039256859365, 0.98171154806432559, 0.98178519767857497, 0.98507470381023587,
+		0.98275744577215796, 0.98090586021102921, 0.98107889347477029, 0.9848084477301009,
+		0.98640072414485569, 0.98867315272323431, 0.98627404962279663, 0.98489371622974597,
+		0.99244715824837026, 0.99274003062362282, 0.99021052528997922, 0.99375560405050667,
+		0.99425466166886778, 0.99601081602544628, 0.99414805727404709, 0.99992335983603675,
+		1.0033380988415803, 1.0016414913689875, 1.0026379013175379, 1.0035707691512865,
+		1.0044760693861889, 1.0060160432338801, 1.0047364466246884, 1.0099625090363566,
+		1.0122551113971097, 1.0148187959387069, 1.009321489377252, 1.0123515094073057,
+		1.012955584964556, 1.0126603295277128, 1.0192015983704446, 1.0147746305686616,
+		1.0149681302621383, 1.0174424155897381, 1.017040280004144, 1.0182253993367529,
+		1.0201634869297975, 1.0167014713310289, 1.0192373745757846, 1.0190701339469515,
+		1.0208157434365246, 1.0161659497619462, 1.0205569846638158, 1.0224381302653873,
+		1.0228608775878827, 1.0182201091809302, 1.0219131905825491, 1.0214733777808613,
+		1.0167774571456496, 1.0199087791417267, 1.0151904100081239, 1.0137832772627358,
+		1.0154225173750682, 1.0138674019609897, 1.0143248632679254, 1.0133442183591741,
+		1.0103629308786901, 1.0092189409992018, 1.0083200009157396, 1.0058370247812976,
+		1.007565085269152, 1.0072046796673721, 1.0012567854979686, 1.0034664459129587,
+		1.0032927978467432, 1.0051973374888556, 1.0003277139193836, 0.9981161725917862,
+		0.99651816624966816, 0.99773456740666366, 0.99382142286968611, 0.99417485030968067,
+		0.99073911733297415, 0.99123663233456338, 0.99122959469903582, 0.98858936114655405,
+		0.98771039783870285, 0.98380991617396674, 0.98609359561342858, 0.98866060302631564,
+		0.9836297408834318, 0.98427046238143534, 0.98384534117523814, 0.98365649293549107,
+		0.98194965108633858, 0.98437485563953708, 0.98191685199796352, 0.97941915956324954,
+		0.97928220777846686, 0.97912234133278253, 0.98160249629037633, 0.98108437529141801,
+		0.97785160473810295, 0.98264188433871857, 0.98360753376256227, 0.97996349194778376,
+		0.98389738806546356, 0.98092587590829394, 0.9835481384240895, 0.97826900313018239,
+		0.98487964438585462, 0.98821514111731734, 0.98680684611429315, 0.98495771711757285,
+		0.98806965803422153, 0.98790443282115759, 0.98914511847947673, 0.98709308190556611,
+		0.98935871403266806, 0.99119368052477208, 0.9932345131522502, 0.99405811644825026,
+		0.99682915904389735, 0.99676955005075663, 0.99978817541527298, 0.99905563930353436,
+		0.9991302059285263, 1.0006993705766223, 1.0058756797643384, 1.0034353978862702,
+		1.0060551833642304, 1.0066877183550627, 1.0078598802223164, 1.0110119687240371,
+		1.0056699959291628, 1.0124108462199892, 1.0121892652073412, 1.0120801397743378,
+		1.0157269281643515, 1.0126174886496697, 1.0169877533952039, 1.0176422658347137,
+		1.0212762186104056, 1.0145005953905635, 1.0159112422153591, 1.0190715077223276,
+		1.0196397592179536, 1.0188449533645634, 1.0196755106462203, 1.0207043110663978,
+		1.0193141584512873, 1.0212766551635113, 1.0240754832578263, 1.0206559426356521,
+		1.0193576140071166, 1.0192086132293345, 1.0191703860116332, 1.0192685994461061,
+		1.0174857473576593, 1.0153545527567556, 1.0125451968964094, 1.0176477579363923,
+		1.0136853444175804, 1.0141018181586661, 1.016095367633064, 1.014539465626497,
+		1.0071570837958268, 1.0083377927053612, 1.00796945392827, 1.0065841917513731,
+		1.0076449075546972, 1.0056934908265507, 1.0064484401697227, 1.0047813889318593,
+		1.0001524180185102, 0.99796711335947619, 0.99980990967229333, 1.0018475768838702,
+		0.99561771330384985, 0.99615528166627876, 0.99373377388927964, 0.99062183945145543,
+		0.99660940606770509, 0.99232793855688006, 0.99003045833448977, 0.99069928382936256,
+		0.9872641440205423, 0.98547062724036094, 0.98558198385765294, 0.98480210840847859,
+		0.98221254203311448, 0.98482768095642781, 0.98333112587209215, 0.98119209275810393,
+		0.98260694931888681, 0.98029047068251784, 0.98022618390760197, 0.98255380661152614,
+		0.9812280507122717, 0.98132715718756602, 0.97961132940272844, 0.97992865104485183,
+		0.98178030485589163, 0.98109395714489311, 0.9804862454273684, 0.97807055502902429,
+		0.97867391924383607, 0.98301329408133942, 0.9823479522156302, 0.98084554844591876,
+		0.98166359301284078, 0.98363599540757252, 0.98401059887695452, 0.99056082779181553,
+		0.98739781898136603, 0.98938441893526674, 0.98819616921995679, 0.99151088616729022,
+		0.99019900773004488, 0.99318973059462934, 0.99076492601851418, 0.995308277117813,
+		0.99323649690190507, 0.99351427416018068, 0.99730701662531807, 0.9930536622740479,
+		1.1502058559650574, 1.1526921077269359, 1.151217173559113, 1.1572687962946731,
+		1.1536555901314092, 1.1602060536434222, 1.1604238713287465, 1.1575491305440662,
+		1.1580331366250276, 1.1609559963193488, 1.1619229772530875, 1.1610026114326013,
+		1.1641038319024881, 1.1627795496778293, 1.1651701245949924, 1.168024211460535,
+		1.1701415665695274, 1.1664302577992793, 1.167017950520586, 1.1709701823380747,
+		1.1693316553083577, 1.1731370757084079, 1.1746327635536149, 1.1675585448440442,
+		1.1696483911343101, 1.1685079986750195, 1.170670994597627, 1.1671555217504355,
+		1.1712777353067674, 1.1689841127375031, 1.170611408677406, 1.1702985441197242,
+		1.1684841066464333, 1.1629180141226607, 1.1669623824646704, 1.1681338365813205,
+		1.1628829420892868, 1.1654544550135086, 1.1635552116846164, 1.1619874578641067,
+		1.1591677418124215, 1.1591438774354828, 1.1552070474905629, 1.1584714924879056,
+		1.1590973527588511, 1.1591926668629264, 1.1530314379276281, 1.1537930364987501,
+		1.1538639592916244, 1.1550032315841576, 1.1521843300224082, 1.1449327907453153,
+		1.1479311622244683, 1.1478079169483453, 1.145183777093886, 1.1435645745607945,
+		1.1417494144607441, 1.144526063575338, 1.1425807979300258, 1.1368516957552481,
+		1.1380837421235546, 1.1416569250330162, 1.1347916995390843, 1.1356291844808908,
+		1.1375924530025019, 1.1325544545073638, 1.135653529793502, 1.133549086970693,
+		1.1298411106306476, 1.1311345096905516, 1.1285568506861163, 1.1326086928406496,
+		1.131281388090279, 1.1303585731937797, 1.1321063659889763, 1.1324427313533463,
+		1.1305421452503213, 1.1311785734726452, 1.1304663689051946, 1.1326229382261568,
+		1.1305518527046317, 1.1318842006363559, 1.1306005863277304, 1.1308088405949634,
+		1.1327997996663612, 1.1300314222700174, 1.1315470937177747, 1.1358710890054331,
+		1.1362402323171059, 1.1367131217501789, 1.1376608027026913, 1.1431279439256052,
+		1.1413314541451758, 1.1413624434184808, 1.1420481068438821, 1.146196315498156,
+		1.1472711863623986, 1.1463309835195707, 1.1492157620944741, 1.1467759380126041,
+		1.1513629993920356, 1.1516907115551898, 1.1522685385755951, 1.1536489503526384,
+		1.1547704302512438, 1.1564651663068386, 1.1534793185985028, 1.1573853091828221,
+		1.158168224373064, 1.1598848163898567, 1.1600737856786014, 1.166266468496479,
+		1.1640376203586418, 1.1669656022865467, 1.165390547074945, 1.1657104493621029,
+		1.1649992931243374, 1.1702609523522862, 1.165026908653539, 1.1686931410226591,
+		1.1692155709363394, 1.1682778795247355, 1.1705746970255708, 1.1697815980427815,
+		1.1701836036916051, 1.1706629343732591, 1.1701391343527043, 1.1666647534770045,
+		1.1687400511836448, 1.1715560334992878, 1.1707684588504148, 1.1669358030115249,
+		1.1683623911354184, 1.1683138782186953, 1.1670886992772569, 1.1641747043780868,
+		1.165664409846882, 1.1677256350883689, 1.1655059885785679, 1.1637248379425296,
+		1.1587838312753125, 1.1623426067624241, 1.1570402058966034, 1.1565643020548508,
+		1.1547579904884731, 1.1595056151525511, 1.1563607239736, 1.150873030239471,
+		1.1512014258097236, 1.1496823239743446, 1.2013563335633968, 1.3493098962288292,
+		1.4516337350847515, 1.3466083202481067, 1.1956775864037745, 1.1440723476310701,
+		1.1406481676797919, 1.1446293816128821, 1.1369728314515926, 1.1378217220614799,
+		1.1384446509098236, 1.1365050917720425, 1.1376380658489154, 1.1335902150777215,
+		1.1345753367756513, 1.1366382027580055, 1.1332134384092278, 1.1325236529535836,
+		1.1354699175761083, 1.1325744764105743, 1.131327331685128, 1.1309515117968039,
+		1.1329875206151274, 1.1342957698710885, 1.1242034517289088, 1.1348018003894038,
+		1.1265838443762863, 1.1320381920002722, 1.1321345152638849, 1.131476825712902,
+		1.1324631551314317, 1.1319909110012456, 1.1321860685027918, 1.130577666053119,
+		1.1296573840155593, 1.1337017925496793, 1.1351254237264063, 1.1357949843963793,
+		1.1346262517670342, 1.1368645897368528, 1.1388651994285539, 1.1372644549638349,
+		1.1429692537448806, 1.1434233339544508, 1.1373764704823888, 1.1453342648540354,
+		1.1467864856033676, 1.1427617293182928, 1.1493144087153864, 1.1488694352893263,
+		1.1467790347596851, 1.1523424343064916, 1.1512219206569956, 1.1535681016477026,
+		1.1532330945192464, 1.1545595052222162, 1.1560538113566992, 1.1618685397802961,
+		1.1590159296500882, 1.1609570340202624, 1.1606894488582495, 1.1645066970657412,
+		1.1617293501985633, 1.1625232637991316, 1.167856694587176, 1.1685454835745896,
+		1.1634901253123133, 1.1639116256018727, 1.1694588604400822, 1.1650198593243053,
+		1.1695599140365467, 1.1728202189655388, 1.1674663139586277, 1.1679631020655508,
+		1.1718422769010186, 1.1687238316415958, 1.1700647853497026, 1.1690371309595409,
+		1.1699644053931617, 1.1681581520539046, 1.1680022785892221, 1.1693507350970602,
+		1.1674757075981257, 1.1663396524591632, 1.1673480500271582, 1.1710426900348061,
+		1.1644275949539813, 1.1651477093600326, 1.1626784343966792, 1.1651852382947878,
+		1.163546533945135, 1.1596193064945499, 1.1610137432528864, 1.1572328190120313,
+		1.1624489040604102, 1.1572473911667975, 1.1546749810465071, 1.1565916065722193,
+		1.1538750158424982, 1.1496831470535185, 1.1499091791948868, 1.1487244095161211,
+		1.1461700405536579, 1.1490548755887886, 1.1393900160987778, 1.1436566810383508,
+		1.1442076250871571, 1.1437657220032875, 1.1409854955052126, 1.1399817432782426,
+		1.1384444463560268, 1.1336432638343874, 1.1368782984024874, 1.1370513358259651,
+		1.1365284494594701, 1.1343457725019637, 1.1360704092498775, 1.1336934161986649,
+		1.1344498962059699, 1.1286297728224579, 1.1316323745874401, 1.1316734918107909,
+		1.1273865006079049, 1.1298344471574162, 1.132693923040516, 1.1307786313951325,
+		1.1285212336724173, 1.1348447955875489, 1.1305608815119801, 1.132816333822628,
+		1.1316698903873585, 1.1302093717869597, 1.1309737994507654, 1.1333875950622849,
+		1.1345723911159147, 1.1317399711787393, 1.1339365944052753, 1.1369000928284769,
+		1.1381063963064419, 1.1349030724259368, 1.1396615892884667, 1.1390438695049219,
+		1.1393128304513302, 1.1417498136854878, 1.1405985402156018, 1.1417965210644625,
+		1.1443342461421349, 1.1474011244309941, 1.1452051162812729, 1.150668150879929,
+	};
+	static constexpr double ShiftExpected[] = {
+		1.0789236257962425, 1.0830060608727325, 1.0798329062470537, 1.0808759105766863,
+		1.0823699794380635, 1.0838302809562212, 1.0843085341818095, 1.0867357762434295,
+		1.0893920286392322, 1.0887286023571441, 1.0902019537568595, 1.0910644499516835,
+		1.091955040743956, 1.0948869083714552, 1.0943336308266418, 1.0922293205159421,
+		1.0984478737220376, 1.0967674608586622, 1.0984942204746935, 1.0956104947764993,
+		1.1005787051471525, 1.0940435433278775, 1.0983733027161835, 1.0965552047108738,
+		1.0983137987474481, 1.0988135802129617, 1.0993583702688083, 1.1004501521341563,
+		1.0957442603512184, 1.0975901474439687, 1.0997469925751013, 1.0961688144741073,
+		1.0947639833200247, 1.0972409449013747, 1.0908417748196335, 1.0936078792919464,
+		1.089646457749162, 1.0991112063294057, 1.0878245582214994, 1.091712063554231,
+		1.0888060977488949, 1.0894964825081455, 1.0876968940038876, 1.0882646689064492,
+		1.0896508012079618, 1.0873861433942495, 1.0828195648291925, 1.0877340590459128,
+		1.0789250701318442, 1.0806143862318616, 1.0792605555905739, 1.0757239929346503,
+		1.0784486950866599, 1.0762122430898717, 1.0756808220910044, 1.07566839046021,
+		1.0736621110991262, 1.0723810443320776, 1.0723716543035842, 1.0698024488544602,
+		1.0698423414875735, 1.066256919431039, 1.0665559005242564, 1.0683693403380943,
+		1.0666524818205478, 1.0616755581214357, 1.0646832253514347, 1.0632369364668339,
+		1.0627882084169966, 1.0612293296816027, 1.0651974213435971, 1.0608988474318455,
+		1.0646333609524481, 1.0627217620611942, 1.0625278164061849, 1.0629560537442575,
+		1.0601748769875714, 1.0627839551597809, 1.0629339363769532, 1.0615529970000575,
+		1.0625429079416069, 1.0636253129618787, 1.063718921772804, 1.0670263982610086,
+		1.0647241246871249, 1.0628831666618925, 1.0630607378221755, 1.0667868019548175,
+		1.0683656637546863, 1.0706131072435578, 1.0681761683255049, 1.0667443297036578,
+		1.0742323536115677, 1.0744462537127277, 1.0718250723038145, 1.0752670122468748,
+		1.075653133231657, 1.0772887441611845, 1.0753005996802669, 1.0809488962275762,
+		1.0842383207184163, 1.0824209757967633, 1.0833033501233473, 1.0841303041854249,
+		1.084938842817913, 1.0863921543131123, 1.0850369814468566, 1.0901994539371904,
+		1.0924409340329411, 1.0949657002528794, 1.0894406259592806, 1.0924524749653464,
+		1.0930463138789712, 1.0927472420140845, 1.0992898239503686, 1.0948682147967912,
+		1.0950702244834232, 1.0975554719419074, 1.0971662452319046, 1.0983658837065162,
+		1.1003198967074856, 1.0968751086236754, 1.0994295071314972, 1.0992820201818421,
+		1.1010485857296783, 1.0964207675245112, 1.1008344516274904, 1.1027384985381785,
+		1.103184172361052, 1.0985667164601756, 1.1022847362735229, 1.1018735561598476,
+		1.0972123965751555, 1.1003867087770338, 1.0957207301374301, 1.0943754108445991,
+		1.0960849458701118, 1.0946070790146236, 1.0951469584722378, 1.0942520662528408,
+		1.0913581372693664, 1.0903016840993518, 1.0894895530784305, 1.0870924310191519,
+		1.0889058650634753, 1.0886314288971861, 1.0827716307051694, 1.085073359938475,
+		1.0849977315926373, 1.087008001553847, 1.0822528380207739, 1.080164273626623,
+		1.0786961124733891, 1.0800463032556151, 1.0762671163624304, 1.0767506120090664,
+		1.0734373444127687, 1.0740468826858947, 1.0741397484525423, 1.0715868021911439,
+		1.0707830403922414, 1.066946983508217, 1.0692860742793673, 1.0719013300564602,
+		1.0669131881066432, 1.0675923740673445, 1.0672023681728668, 1.0670458920830541,
+		1.0653690708985586, 1.0678222201041501, 1.0653903496664912, 1.0629173216646366,
+		1.062804011895599, 1.0626672426505845, 1.0651703233432543, 1.064675115328737,
+		1.0614651629139811, 1.066277894195188, 1.0672652506882505, 1.0636417508482405,
+		1.0675945844941401, 1.0646399485513491, 1.0672765639508188, 1.0620088341362603,
+		1.06862760332992, 1.0719677126946199, 1.0705602493950093, 1.0687076833099296,
+		1.0718110513008532, 1.0716308090214559, 1.0728483225786651, 1.0707630212074977,
+		1.0729834955625726, 1.0747602546391257, 1.0767297744633491, 1.0774701920839846,
+		1.0801485236862658, 1.0799896912615876, 1.0829057258926891, 1.0820700963443446,
+		1.0820434739305136, 1.0835153174270289, 1.088599730072882, 1.0860740830152,
+		1.0886156416656663, 1.0891772434540077, 1.0902856045027671, 1.093380708951988,
+		1.0879882665494114, 1.0946850203280869, 1.0944257905522656, 1.0942856777735701,
+		1.0979083425510305, 1.0947816952411318, 1.0991414795314787, 1.0997917728056714,
+		1.1034270550715231, 1.0966574702605982, 1.0980780688325815, 1.1012515679081063,
+		1.1018358652897637, 1.1010595148491338, 1.1019104919109184, 1.1029611298903712,
+		1.101593617007115, 1.1035790154455385, 1.1064007672085145, 1.1030044277315074,
+		1.1017303531645422, 1.1016077579484496, 1.1015991926587674, 1.101731153638825,
+		1.0999865473627934, 1.0978981349815935, 1.0951359591740484, 1.1002900223520129,
+		1.0963835559080815, 1.0968607065440286, 1.0989199341606164, 1.0974347466254173,
+		1.0901277892938659, 1.0913880519944381, 1.0911028516167414, 1.0898040549913921,
+		1.0909546416006992, 1.0890967649137995, 1.0899491199464617, 1.0883832341291011,
+		1.0838586983941383, 1.0817803648262303, 1.0837319423815857, 1.0858796256539012,
+		1.0797605484255803, 1.0804092438344146, 1.0780988198407322, 1.0750976208991836,
+		1.0811952578070594, 1.0770226051158849, 1.074831532484831, 1.0756025622611511,
+		1.0722632147183928, 1.0705569236104631, 1.0707453479450364, 1.0700316951240532,
+		1.0674977877568539, 1.0701590989875278, 1.0687008095267634, 1.066593927339647,
+		1.0680365970924788, 1.0657451875548465, 1.0657045072063571, 1.0680551583049609,
+		1.0667523183005958, 1.0668743215526784, 1.0651812038224102, 1.0655207919539229,
+		1.0673941332058172, 1.0667290483894067, 1.0661426226315627, 1.0637487455516199,
+		1.0643746275767754, 1.0687368951868836, 1.0680944978258102, 1.0666159599077991,
+		1.067461441089776, 1.0694673358849036, 1.0698795013872719, 1.0764634885440629,
+		1.0733254605927027, 1.0753347593293279, 1.0741231583180555, 1.077000734048607,
+		1.07369350721674, 1.0716531532223399, 1.0619278189579855, 1.0569717193712245,
+		1.0431880161811136, 1.0297084101322103, 1.0180643780369869, 0.99725093337631476,
+		1.1374185491433941, 1.1232517314421566, 1.1061652408489386, 1.0982230106507209,
+		1.0826250636818753, 1.07939320199043, 1.0720408311411951, 1.0637673845290625,
+		1.0619531271321865, 1.0643339826823133, 1.0652598189329618, 1.0643617079909555,
+		1.0674872257301677, 1.0661953889983773, 1.068622239867776, 1.0715084931059466,
+		1.0736521781623443, 1.0699642388032673, 1.070574846477794, 1.0745497653705374,
+		1.0729328744671507, 1.0767586538666605, 1.0782741476989448, 1.071220179229559,
+		1.0733312933104386, 1.0722131448835739, 1.0743989333395696, 1.0709063751355017,
+		1.07505156666311, 1.0727815353659991, 1.07443423714195, 1.0741502436455217,
+		1.0723698362019882, 1.0668442265941067, 1.070936147513206, 1.0721621059361259,
+		1.0669718802710615, 1.0696088965445361, 1.0677783240325605, 1.0662806938353957,
+		1.0635311324182362, 1.0635766451987148, 1.0597084152690099, 1.0630414940061512,
+		1.0637374669136255, 1.0639061743723592, 1.0578234886371711, 1.0586704674741771,
+		1.0588348716161027, 1.0600762597288509, 1.0573675874034181, 1.0502327183145557,
+		1.0533516911460077, 1.0533501947260169, 1.0508463739968075, 1.0493439577882406,
+		1.0476405282292238, 1.0505228708954586, 1.0486766597772599, 1.0430395852462979,
+		1.0443563919292291, 1.048006953642693, 1.0412116893895274, 1.0421117295503839,
+		1.0441302432837827, 1.0391404349717304, 1.0422811346645653, 1.0402125274350607,
+		1.0365356549215583, 1.0378566560940623, 1.0353043039140417, 1.0393801407089118,
+		1.0380761804942196, 1.0371764304416708, 1.0389471828257308, 1.0393064731299053,
+		1.0374288028628269, 1.0380881460035385, 1.0373988520680393, 1.0395782953811268,
+		1.0375299247764893, 1.038884472520355, 1.0376216936368661, 1.0378477276603761,
+		1.0398505868725145, 1.0370843010503492, 1.0385878105868218, 1.042881569067317,
+		1.0432004746883545, 1.0436038956065306, 1.0444663205610811, 1.0498377325962556,
+		1.0479409800754591, 1.0478725627787524, 1.0484638087078615, 1.0525252301506367,
+		1.053522114167744, 1.0525125956551828, 1.0553356235000071, 1.0528399322316746,
+		1.0573751018867878, 1.0576529766982166, 1.0581811851997405, 1.059510514649517,
+		1.0605780306449539, 1.0622149636767972, 1.0591672704066646, 1.0630082661140354,
+		1.0637252327553672, 1.0653782455129732, 1.0655098067082049, 1.0716545837892961,
+		1.0693893259359721, 1.0722926755725402, 1.0707035931994437, 1.0710180980864519,
+		1.0703080498562962, 1.0755754648192828, 1.0703503964163685, 1.0740278408297692,
+		1.0745631456073721, 1.0736397762896737, 1.0759524370147522, 1.0751769462926497,
+		1.0755985308900446, 1.0760992935150184, 1.0755981274693838, 1.0721466615202133,
+		1.0742453847587374, 1.0770899655421102, 1.076350154084351, 1.0726116379995168,
+		1.074216909734921, 1.074467468311431, 1.0736715334223161, 1.0712766067931665,
+		1.0732787116706235, 1.0757242390248469, 1.0736894392086795, 1.0719506242928858,
+		1.0670306192259853, 1.0703765613640386, 1.0635512048535163, 1.0587806021117088,
+		1.0504401172087756, 1.0470982594504061, 1.0346528957827514, 1.0192068147488822,
+		1.0096693667040593, 0.99927878243610568, 1.0440373639865288, 1.1890345014076236,
+		1.2913667319488946, 1.1877675613990188, 1.0433708694986483, 1.0011171374893304,
+		1.0089705217479068, 1.0251819822896731, 1.0297941726108206, 1.0421880743069456,
+		1.0530695642508376, 1.0597506370388761, 1.0677120159288502, 1.068307661603151,
+		1.0711595029455656, 1.0736572254775398, 1.0702881620969136, 1.0696212914144565,
+		1.07257893387443, 1.0696625134810744, 1.0683724976500988, 1.067956542891509,
+		1.0699711133764223, 1.0712783943015003, 1.0611991986891882, 1.0718175568417583,
+		1.063621969512107, 1.0690991869226418, 1.0692184248476417, 1.0685836503679658,
+		1.0695928947156335, 1.0691435567780261, 1.0693614688917441, 1.0677750345518993,
+		1.0668743852670353, 1.0709335045514863, 1.0723637063796099, 1.0730286385321048,
+		1.0718419672301129, 1.0740483810777699, 1.0760039140857611, 1.0743469558033103,
+		1.079987008660791, 1.0803703625540482, 1.0742488363610574, 1.0821294235350809,
+		1.0835026886317536, 1.0793975167667254, 1.0858682047931922, 1.0853392997365936,
+		1.0831626164235095, 1.0886371631299323, 1.0874254371660674, 1.0896788629927798,
+		1.0892510781017173, 1.0904869102590717, 1.0918955713617384, 1.0976323931011509,
+		1.0947119147157003, 1.0965965632299854, 1.0962842994987105, 1.1000681839783939,
+		1.0972677769128094, 1.0980476435361606, 1.1033746722680313, 1.1040633746974062,
+		1.0990130406092868, 1.099443684830649, 1.1050034486364402, 1.1005798304248182,
+		1.1051376791600998, 1.1084177325569573, 1.1030850284692788, 1.1036039665892765,
+		1.1075058078917628, 1.1044102363377453, 1.1057741046250358, 1.1047693722540779,
+		1.1057196470736264, 1.1039366169734621, 1.1038043900096799, 1.1051771766689169,
+		1.1033275087904058, 1.1022183145131637, 1.1032557162018528, 1.1069823403704513,
+		1.1004032201656189, 1.1011644308997435, 1.0987425898714449, 1.1013044726952417,
+		1.0997298985395312, 1.0958773378322952, 1.0973585077225292, 1.0936778874766659,
+		1.0990091185528805, 1.0939382103871935, 1.091511296697268, 1.0935861684441246,
+		1.0910367963953811, 1.0870160618976776, 1.0874115638794699, 1.0863894279599726,
+		1.0839868491549003, 1.0870101705210777, 1.0774696185601855, 1.0818468987838907,
+		1.0824961650568499, 1.0821420278419815, 1.0794406115051245, 1.0785079820144476,
+		1.0770351124684805, 1.0722925363060962, 1.0755812238709024, 1.0758038052473808,
+		1.0753270576565395, 1.0731875588227395, 1.074952555467424, 1.0726130009364521,
+		1.0734038016804592, 1.0676148065187936, 1.0706455736100664, 1.07071246309056,
+		1.0664496238412777, 1.0689208548188025, 1.0718032949839127, 1.0699109183005835,
+		1.0676764129703098, 1.0740226959211105, 1.0697610521251912, 1.0720379097035651,
+		1.0709114134423312, 1.0694685724686621, 1.0702474115809995, 1.0726713355279891,
+		1.0738612366651663, 1.0710287946451056, 1.0732211057927421, 1.0761778666373927,
+		1.0773776160841555, 1.0741706542852159, 1.0789305874711894, 1.0783203477217855,
+		1.0786025829799544, 1.0810573819501561, 1.0799268252142393, 1.0811469892579209,
+		1.0837074538102975, 1.0867972181325176, 1.0846241209705805, 1.0901100695246635,
+	};
+
+	static constexpr double DriftSamplingRate = 10.0;
+	static constexpr double DriftInput[] = {
+		0.50486105309141549, 0.5007843207768844, 0.50392924853210819, 0.50230295373792777,
+		0.49977142630906213, 0.50743409240319393, 0.50320146565198232, 0.50721808021517256,
+		0.50657276327723877, 0.50576489252791523, 0.50840392797990808, 0.50718077312902843,
+		0.51043904555766206, 0.51098671229440318, 0.51036208312409137, 0.51266646910633296,
+		0.51746881499745445, 0.5120739052932608, 0.51184959299114874, 0.51753428660034884,
+		0.51345574478472666, 0.51445051449553603, 0.51610079972458733, 0.51773210686170534,
+		0.52054884567898008, 0.51793353837488809, 0.52156603859814943, 0.5212550136005617,
+		0.5175366079600574, 0.5241364895312729, 0.52357992910321205, 0.52573783751937642,
+		0.5230557749639807, 0.52858540929629771, 0.52537190098084241, 0.52330417484775271,
+		0.5255699905380028, 0.52641957496104386, 0.52755806151890861, 0.52705505919433204,
+		0.52734171066490954, 0.53322400825502858, 0.53229178317964121, 0.53092129195215898,
+		0.53343396953174194, 0.52884978345254763, 0.53432386598338943, 0.53095049364040292,
+		0.53291106221850071, 0.53493129056487176, 0.53086810663896689, 0.53612834304432222,
+		0.53652720129173426, 0.5376857871876598, 0.53821636688430419, 0.53835094405634443,
+		0.53623996745801727, 0.5379105605420913, 0.54131890967934404, 0.53658379216673446,
+		0.53998463316906931, 0.54015990199235586, 0.53903277851392928, 0.53847879356018025,
+		0.53988826490180097, 0.54001833973305124, 0.54036983888832435, 0.54073374371132343,
+		0.54244713218789276, 0.54352637908284906, 0.54299218541178074, 0.54185832055870431,
+		0.54367874854060216, 0.54558033383125426, 0.54557513755636577, 0.54438557561298273,
+		0.54546883138556557, 0.54479249927121831, 0.54765690274307255, 0.54544713960064939,
+		0.5455065284922932, 0.54370441590326246, 0.5439001030882491, 0.54479055797021259,
+		0.54902525530315649, 0.54615194464140848, 0.54501873372304377, 0.54913871119546287,
+		0.54859475014175973, 0.54734803219351658, 0.54534757428754888, 0.54793147740810011,
+		0.54704495445041224, 0.55069043638797499, 0.54516560791166091, 0.54572145098664493,
+		0.5500458396748189, 0.55179081126505103, 0.54846636198081844, 0.54804319408013069,
+		0.54988835644420309, 0.54835031374532472, 0.55335688578947184, 0.54956495141768447,
+		0.54745761492820999, 0.55263127523825062, 0.55033524220789531, 0.55034295983901094,
+		0.55336962954522717, 0.55247562535991102, 0.55347914355762073, 0.55111395003877672,
+		0.55196754527381042, 0.55279698335117677, 0.55569890023254132, 0.55305033776576118,
+		0.55235455614634388, 0.55116154433812148, 0.5531095479467395, 0.55535472042616163,
+		0.55518445922330029, 0.55734027655463925, 0.55105866564472905, 0.55418830644488049,
+		0.5536010735805208, 0.55774647326634197, 0.55637934081570717, 0.558169661028317,
+		0.55519909106126919, 0.55613756528271585, 0.55372647104390149, 0.55878817461890251,
+		0.55702490627570844, 0.56305626822849364, 0.56124470371188584, 0.56014384941636131,
+		0.56212952670573058, 0.55772589964084107, 0.55941994926319627, 0.56188492458084771,
+		0.56264563872172302, 0.55946624499624442, 0.56158871972913582, 0.55994298486156013,
+		0.56220733737735706, 0.56325005906625325, 0.56291630026926753, 0.56218179762046638,
+		0.56266439198401053, 0.56629916739630504, 0.56438179801641652, 0.5672619188621294,
+		0.5614659972534447, 0.56796913669089144, 0.56616473829791458, 0.56759435265302005,
+		0.57151026511171732, 0.56659371032989414, 0.57247593585925238, 0.56928889213064193,
+		0.56952528591561213, 0.56903473565274831, 0.56817887523493316, 0.5747828774965722,
+		0.57393066343566213, 0.57330824618135923, 0.57336021601658405, 0.57427088492537037,
+		0.57236855646322027, 0.57604626816838778, 0.57804716772130715, 0.57956276742184376,
+		0.57882563236008799, 0.57748051992756311, 0.57982158267099548, 0.57655846522289467,
+		0.58172349174614624, 0.57959446926022429, 0.58194567711910283, 0.58395162433895342,
+		0.58432169354302843, 0.58661817897967561, 0.58681632721311572, 0.58526571803283378,
+		0.58373030602170795, 0.58754879810673144, 0.58720394213203897, 0.59038420225193533,
+		0.59089762769171972, 0.59083288108058174, 0.59507050948992934, 0.59270372551883999,
+		0.59365292791103774, 0.59559811709077481, 0.59472959057732677, 0.59867721405187047,
+		0.59714701043824192, 0.59784417225769015, 0.59551238552782926, 0.60021742318300098,
+		0.49777691864946927, 0.50064558698686612, 0.5005187856164458, 0.50416670203434444,
+		0.50254040911319942, 0.50641288783968419, 0.50257280172514185, 0.50341584125048322,
+		0.50876081696861808, 0.51066005254037472, 0.50873068145474698, 0.50947705719601855,
+		0.50813039978181684, 0.51259034549053317, 0.51357617198213745, 0.51044058043142682,
+		0.51396170719042511, 0.51614824450189489, 0.51662584556193214, 0.51926919515566006,
+		0.51581341921705515, 0.51763107939255426, 0.51855944491157713, 0.5148637071372546,
+		0.51999154697645733, 0.51870185953304215, 0.52268805539830732, 0.52490792657477392,
+		0.52157499919896666, 0.52438459239809565, 0.5217238847691561, 0.52408737545924278,
+		0.52483223559266245, 0.52603582379322433, 0.52979972838185607, 0.52585981582345687,
+		0.52534116469650893, 0.52701549823302529, 0.52531827581572998, 0.53157288347646392,
+		0.53052552003734044, 0.52785317006452503, 0.52706138077474596, 0.53122477772023458,
+		0.5340152562564886, 0.53425054095959146, 0.53440207647713633, 0.53545836797383584,
+		0.5340641653475291, 0.53487003777174835, 0.53233614712332622, 0.53467167028004337,
+		0.53487693454925123, 0.5372232492311444, 0.53791337721357657, 0.53658400384707416,
+		0.53786221316187166, 0.53665686456629202, 0.53813325603236661, 0.54064248812810622,
+		0.53764614564728919, 0.53943906278115084, 0.54170198013054471, 0.54081892608791204,
+		0.538421020552177, 0.54190296236753888, 0.54210404804649648, 0.5426181852887213,
+		0.54135288435433471, 0.545040247936042, 0.53867916510068226, 0.54155807571496084,
+		0.54269550575211456, 0.5469493232537721, 0.54267066183364532, 0.54530588994726914,
+		0.54316456814404446, 0.54665462195062342, 0.54333882449962145, 0.54384771462740311,
+		0.54640558107173676, 0.54669667449797221, 0.5497127880200644, 0.54425608386848379,
+		0.54531142489321671, 0.5481775583562325, 0.54860467446001004, 0.54698249746404315,
+		0.54702631641830501, 0.54673230780757887, 0.54680239805097297, 0.54791493224663435,
+		0.54639983577824869, 0.54613726354082148, 0.54749744446316417, 0.54994122164331638,
+		0.54552063054709599, 0.54791435235049468, 0.54879375454821111, 0.54914250212516513,
+		0.55031031858911927, 0.55046076209450112, 0.55068427982254886, 0.55050390104267244,
+		0.54820338075423547, 0.54966763207072056, 0.54945646312429608, 0.55356462716533916,
+		0.55001837065414627, 0.55287308791672485, 0.55625301493977175, 0.54955797534138195,
+		0.55229475288823515, 0.55488048647998023, 0.55343100035547121, 0.54931544503025453,
+		0.552954797902937, 0.55141681536930776, 0.552488937333937, 0.55630825619311264,
+		0.55501223554632861, 0.55628936374312432, 0.55270629439211938, 0.55764570523495649,
+		0.55594788397173156, 0.55415445889116088, 0.5560897692549136, 0.55611041323991284,
+		0.55318161583559999, 0.55902096774193388, 0.55469083883672921, 0.55843992732851788,
+		0.55827042083412803, 0.55837608519166404, 0.55454426969093396, 0.55846839943868076,
+		0.5583894122319899, 0.56083059810575508, 0.55985282627559674, 0.56193247712022576,
+		0.56144113961383735, 0.55805696018702811, 0.55737050947700983, 0.56024527948100422,
+		0.56153820550910316, 0.56386609545497479, 0.55992363737215856, 0.56591456602456569,
+		0.56258164329292382, 0.56449663471634048, 0.56479695472774472, 0.56765772151993565,
+		0.56706226753146149, 0.56825040339741206, 0.56954690758403115, 0.56815739708778978,
+		0.56501326309690225, 0.56870702817826324, 0.5727858772438128, 0.56673795919053838,
+		0.56694417242689177, 0.57221945286858844, 0.57288291382697232, 0.57435538430774336,
+		0.57225781222668981, 0.57541073730063308, 0.57239247293639905, 0.57405598664782542,
+		0.57442362316826112, 0.57697205926730233, 0.57737327638174762, 0.57730254244317925,
+		0.57943035584131064, 0.57778799395796521, 0.57818262269316245, 0.5779277964892171,
+		0.58371827880528127, 0.57878489780359332, 0.58210085994935357, 0.583359532995124,
+		0.58338947717755252, 0.58323907179590317, 0.58170802698318647, 0.58724462282292811,
+		0.59162231650237951, 0.58636302086499326, 0.58470295347120005, 0.58768199059527215,
+		0.59071845693085701, 0.58908299993647817, 0.59114262170936427, 0.59045708470169622,
+		0.59403033270552041, 0.58947060220985592, 0.59365055307827963, 0.59285047352995035,
+		0.5948547018118352, 0.597536116388663, 0.59790264152010741, 0.60124137065611649,
+		0.60157510721864638, 0.60205354499994479, 0.60225673706169713, 0.6031745432777178,
+		0.60399052697618694, 0.6038642705507844, 0.60444236309205002, 0.60535973237485696,
+		0.60787148408096292, 0.60888844792914587, 0.60758271856596113, 0.60612039759912295,
+		0.61020349024291876, 0.60918133061026358, 0.61175288435691599, 0.61181466243878191,
+		0.61094116334725934, 0.61205368323948461, 0.61400146860858862, 0.61850506573589337,
+		0.61477338011895089, 0.62061693629171999, 0.61660998222129315, 0.62193009718151981,
+		0.61728595898481309, 0.61695815132019882, 0.62033209667610079, 0.62257575490653239,
+		0.62359890787111438, 0.62052789896275096, 0.62363956922131503, 0.62078494220304503,
+		0.620587212672569, 0.62512913125854308, 0.62399032564187573, 0.62821673945031364,
+		0.62815261042387893, 0.62830606855918636, 0.62909208526096083, 0.62788424078839555,
+		0.62956728262105499, 0.62644472111779148, 0.63419671190635574, 0.63152942274870505,
+		0.63382567903501263, 0.63315219055573535, 0.63499962175717295, 0.63404393749111987,
+		0.63406626027372481, 0.63084581685633723, 0.63534248167641882, 0.63625497017034993,
+		0.63619726994324233, 0.6359526006277556, 0.63828409982590539, 0.63558520278861574,
+		0.63800470755228711, 0.64216791116087257, 0.6402699578887896, 0.63937046592839264,
+		0.63615664302876795, 0.64138252002826179, 0.63982375309562123, 0.63732459046690992,
+		0.64297648013991415, 0.64308720449607537, 0.64098267112592411, 0.64519967431706737,
+		0.64212243910902023, 0.63922973017640339, 0.63977642328683126, 0.64112200178564105,
+		0.64255293105205435, 0.64350578611482701, 0.64283175150801297, 0.64385958006855315,
+		0.64634489877858881, 0.64613487892494381, 0.64678552361550423, 0.64526416227321792,
+		0.64730992598130266, 0.64709981156657914, 0.64906822355911786, 0.64693917341467144,
+		0.64595570134252522, 0.64502825147618381, 0.64707612033595729, 0.64827684433199873,
+		0.65129574904794985, 0.64646020895568257, 0.64776384940655019, 0.64696030754532929,
+		0.64725931212707899, 0.64940102432747371, 0.65081188415573321, 0.65208499319140145,
+		0.65152582117500213, 0.65242204694979844, 0.64886243559936219, 0.6534583498267329,
+		0.65083415264727595, 0.64979299473917307, 0.64904228649552453, 0.65211945178874831,
+		0.65480680404827984, 0.65078930220476139, 0.64928490855674825, 0.65123473861853498,
+		0.65447588230711395, 0.650478023510348, 0.65300218706857649, 0.65439781914387929,
+		0.65141299374282513, 0.65046802987314523, 0.65550493732601922, 0.65428673875156385,
+		0.65339331687140456, 0.65527391882441832, 0.65215826168076396, 0.65075069833982435,
+		0.65265890720074582, 0.65517520928702322, 0.65814126513365478, 0.65238394627491847,
+		0.65259006005646081, 0.65337810151063902, 0.65593934817789201, 0.65483577278999539,
+		0.65447973795980352, 0.65577319945585799, 0.65750362781335048, 0.65427955920876346,
+		0.65986946012779002, 0.66146939356984336, 0.65589727186452995, 0.65804940319704175,
+		0.65381252310211002, 0.66404339250070532, 0.6625213929216528, 0.65940547709242947,
+		0.66329776488869019, 0.66281203392388721, 0.65904941741387424, 0.66465419583599672,
+		0.6647727081939373, 0.66252951501600121, 0.66132496213004699, 0.66285832145390977,
+		0.66413196769730443, 0.67022148830816586, 0.66539675469006776, 0.6659513207809421,
+		0.66206876758474409, 0.66930280915010354, 0.66473991993279158, 0.66567894441302955,
+		0.66892031431269883, 0.66782538682829706, 0.66901288020263994, 0.67160913826475332,
+		0.67221174588116128, 0.6680500121068117, 0.67326964969037228, 0.67043837930496764,
+		0.67123259710011074, 0.67237791080317777, 0.67381894208049353, 0.67752958139992203,
+		0.67679822506770249, 0.67662168396218214, 0.67986215864044675, 0.67400546208385981,
+		0.67681616179658532, 0.68085099323835097, 0.67638211074053811, 0.6818985520103571,
+		0.68131392614191966, 0.67949570491414024, 0.67865435313785261, 0.68385404553847207,
+		0.68630046379582466, 0.68730258885318762, 0.68539377514307864, 0.68462660511816387,
+		0.68783065796496934, 0.68848933874824125, 0.68806710113751524, 0.69197220779398216,
+		0.6894621028986897, 0.69170365575938964, 0.69305703420010645, 0.69426039037164111,
+		0.69609628658530065, 0.69533326873244983, 0.69546065181973071, 0.69694663231949305,
+		0.69520728519229791, 0.69759008760814178, 0.69709622086994827, 0.69909819855132416,
+	};
+	static constexpr double DriftExpected[] = {
+		0.5856396543250656, 0.58125782410263116, 0.58403293033642945, 0.5819860729075691,
+		0.57900538537948376, 0.58620959084813262, 0.58151777882115474, 0.58507211897830147,
+		0.58395368968886707, 0.58265517741578199, 0.58478437265585215, 0.58303624451128766,
+		0.5857624037953566, 0.58577969879963332, 0.58463335652581316, 0.58642806657843272,
+		0.59073263812004673, 0.58484940346252845, 0.58414296260820509, 0.58934869504879506,
+		0.58479187095004803, 0.58530705401202032, 0.58647500184215073, 0.5876205303074713,
+		0.58994832545535236, 0.58684211625068894, 0.58998359140534573, 0.58918346374258546,
+		0.58497973467156505, 0.5910993882265928, 0.59006816041408627, 0.59175645949427091,
+		0.58860864552253167, 0.59367501146771873, 0.58999957794152502, 0.58747047988742229,
+		0.5892749516275656, 0.58966285854710732, 0.59033913382057834, 0.58937342879463306,
+		0.58919721048012019, 0.59461694366155138, 0.59322281237168406, 0.59139113440646074,
+		0.59344317189317297, 0.58839864388173058, 0.593412453956073, 0.58957868719345685,
+		0.59107859663915374, 0.59263786831256393, 0.58811359817774778, 0.59291299068616798,
+		0.59285161915111162, 0.59355065190492051, 0.59362204446499767, 0.59329748030438079,
+		0.59072755539720512, 0.59194011305591754, 0.59489222739187986, 0.58970308944163963,
+		0.59265162771289692, 0.59237500918887498, 0.59079492447374082, 0.58978596836570119,
+		0.59073843933833259, 0.59041014144486759, 0.59030265761878031, 0.59020743019704824,
+		0.59146167631196156, 0.59208177845213106, 0.59108844093629298, 0.58949543379935876,
+		0.59085675358848877, 0.59229956468740874, 0.59183690315030679, 0.59019309536378417,
+		0.59082788394719077, 0.58971117198355549, 0.59214421969059705, 0.5895109534510482,
+		0.58915158626960384, 0.58693158126673617, 0.58670708152138085, 0.58717353585953491,
+		0.59098046798032844, 0.58767658507502485, 0.58611121876000327, 0.5897985565145667,
+		0.58882220075740777, 0.58714351264089704, 0.58471111604796533, 0.58686235345601778,
+		0.58554161820280315, 0.58875068228032068, 0.58278685403405306, 0.58290109656055,
+		0.5867815978697325, 0.58808086295604878, 0.58430928771083612, 0.58343780767523867,
+		0.58483358797788343, 0.58284518148223274, 0.58740050876374073, 0.58315656655587222,
+		0.58059661728218448, 0.58531730649728919, 0.58256831375722973, 0.58212358787320362,
+		0.5846989796761759, 0.58335564776201809, 0.58391263016203887, 0.58110443583648519,
+		0.58151903609223643, 0.58191353967969672, 0.58438408126388919, 0.58130653609530469,
+		0.58018243706331296, 0.57855991435039267, 0.58007573076108909, 0.58188513747226478,
+		0.58127506248455507, 0.58298678073702959, 0.57625679033042609, 0.57893417807103242,
+		0.5778916478731676, 0.58157971896030336, 0.57975412387545944, 0.58108547517966569,
+		0.57765578172593834, 0.57813511360723047, 0.57526487453027286, 0.57986743040755129,
+		0.5776450194590369, 0.58321724786112683, 0.58094676527213895, 0.57938804797666421,
+		0.5809184734105286, 0.57606378186604867, 0.57731152350246573, 0.57933396881894628,
+		0.57965364667151953, 0.57603192766353273, 0.57770853108442333, 0.57561241897630711,
+		0.57742232088857459, 0.57800779577733208, 0.57721537601133543, 0.57602177020912282,
+		0.5760452218590234, 0.57922077545007111, 0.5768438814173561, 0.57926398838668325,
+		0.57300752598593818, 0.57904973235674262, 0.57678426897897817, 0.57775295813026206,
+		0.58120824483183919, 0.57583136545387792, 0.58125345232873771, 0.57760627766198591,
+		0.57738231083550706, 0.57643083576816201, 0.57511304866987256, 0.58125368819044321,
+		0.57993643705128783, 0.57884741275768126, 0.57843169422343022, 0.57887443433576247,
+		0.57650499520402954, 0.57971737599485562, 0.58125516683549339, 0.58230959834358709,
+		0.58111250295687922, 0.57930795987799255, 0.58118974663906442, 0.57746732229126807,
+		0.58217265732248324, 0.57958197640122788, 0.58146345186458892, 0.58297319109031109,
+		0.58277675595431511, 0.58435447407111574, 0.58356863070811604, 0.58067997980566466,
+		0.57748325993661365, 0.57946438284741875, 0.57718672641697211, 0.57844467915161035,
+		0.57719154306850418, 0.57587603046903046, 0.57956825274816659, 0.57679414466062096,
+		0.57864255641489071, 0.58269882075979629, 0.58531499721746283, 0.59420976101390255,
+		0.59907875533993837, 0.60749691555792307, 0.61394854688548617, 0.62811989695394888,
+		0.53536223406581629, 0.54763409411098607, 0.55617179715488274, 0.56737922652798933,
+		0.57196462096166367, 0.58058774331311847, 0.58004236220109684, 0.58282600300648169,
+		0.58891714340375478, 0.59037570008639262, 0.58785565178490862, 0.58729283139619315,
+		0.58417460517068764, 0.58672652489411536, 0.58580606688447956, 0.58086763759066173,
+		0.58278802474501912, 0.58372909989085164, 0.58332073814211083, 0.58532358238397686,
+		0.58134885739152009, 0.58269221971537977, 0.58315845907282426, 0.57900306422832182,
+		0.58367164068325084, 0.58192273451091792, 0.5854496677254124, 0.58721015242825148,
+		0.58341763040316963, 0.5857673664516494, 0.58264654339265642, 0.58454972848115294,
+		0.58483419866125974, 0.58557740094335953, 0.58888093838482303, 0.58448059087854465,
+		0.58350124318051599, 0.58471431155926523, 0.58255485028182918, 0.58834583167387766,
+		0.58683320820903262, 0.58369410284109857, 0.58243477404879729, 0.58613110809567071,
+		0.58845633336783532, 0.58822882486409056, 0.58791966022841535, 0.58851640646316206,
+		0.5866630236346182, 0.58700975370398656, 0.58401673537635712, 0.5858931769397544,
+		0.58563939829701239, 0.58752668191503965, 0.58775777120793038, 0.5859693443566002,
+		0.58678848664130046, 0.58512406406674722, 0.5861413859706921, 0.58819157182697912,
+		0.58473624078274777, 0.58607029067489069, 0.58787457118737629, 0.58653327165585845,
+		0.58367770734568436, 0.58670276487618755, 0.58644785950119172, 0.58650686901368476,
+		0.58478706060850782, 0.58802010420520279, 0.58120441305226, 0.58362810343566063,
+		0.58430962766552408, 0.58810697024478864, 0.58337144943835184, 0.58554961270026784,
+		0.58295118719335648, 0.58598428396089364, 0.58221193521968828, 0.58226510388412012,
+		0.58436881688478093, 0.58420857128135373, 0.58677805880686973, 0.58088193156184076,
+		0.58150779607861269, 0.58395683412304833, 0.58398058354318283, 0.58196811685033822,
+		0.58163148735044157, 0.58096135816460626, 0.5806530893246119, 0.58137900780067564,
+		0.57946491415503332, 0.57878940202430451, 0.57972353037745117, 0.5817305147789732,
+		0.57686527868604631, 0.57880915693757484, 0.57923558017100418, 0.579129633761028,
+		0.57984194336816675, 0.57953662251722449, 0.57930445718450496, 0.57866867705348957,
+		0.57591316859642405, 0.57692300500456539, 0.57625829659358729, 0.57991432871511495,
+		0.5759181326236924, 0.57832604120812614, 0.58126308162235918, 0.57412923379732717,
+		0.57643039397540197, 0.57858178847636765, 0.5766968312971722, 0.57214259647069809,
+		0.57533905189004853, 0.57335418291346618, 0.57397645973011069, 0.57734421657254698,
+		0.57559602786853958, 0.5764212865767333, 0.57238735656544937, 0.57687739051850906,
+		0.5747317986532311, 0.57249187736406915, 0.5739812361323583, 0.5735555949455039,
+		0.57017945642989609, 0.57557003045225519, 0.57078964596630644, 0.57408717319724001,
+		0.57346504318125124, 0.57311724916343088, 0.56883133236264249, 0.57230089087263747,
+		0.57176701011893538, 0.57375304093047086, 0.5723197391185455, 0.57394317471233769,
+		0.57299458889366239, 0.5691520733576596, 0.56800661515027928, 0.57042224280317932,
+		0.57125589499055995, 0.5731236337389638, 0.5687191696640902, 0.57424582156515114,
+		0.57044693214327047, 0.57189563109602592, 0.57173078985520087, 0.57412836696252934,
+		0.57307164446139724, 0.57379979222791522, 0.5746369038740532, 0.57278819084253829,
+		0.56918489547340045, 0.57241949920046664, 0.57603915093056801, 0.56953189519535685,
+		0.5692783965008914, 0.57409326561475904, 0.57429537201397329, 0.57530552596169737,
+		0.57274484427405326, 0.57543407925761325, 0.57195170052621747, 0.57315076741705562,
+		0.57305369325030053, 0.57513722337474227, 0.57507337725333518, 0.57453736772715258,
+		0.57619949587532904, 0.57409068659645746, 0.57401762779504162, 0.5732933528514359,
+		0.57861218859121466, 0.57320474337961069, 0.57604432644461745, 0.57682479074058401,
+		0.57637553548789078, 0.57574600250566965, 0.5737369919583023, 0.57879763537863804,
+		0.58270169285480133, 0.57697067317020712, 0.57483980420024883, 0.57734757669741166,
+		0.57991049346479306, 0.57779657822943697, 0.5793687869764419, 0.57818073220087962,
+		0.58122777919663493, 0.57610790363500053, 0.57968437766616177, 0.57823320087605812,
+		0.57954360405736138, 0.581503812342412, 0.58114460517967781, 0.58377725423379445,
+		0.58344331824756601, 0.58330145688171364, 0.58293061206754204, 0.58331264921924186,
+		0.58362061280639788, 0.58300439873080001, 0.5831032700677945, 0.58354723272284481,
+		0.58558819031512621, 0.58613465663750908, 0.58435655597871272, 0.58241738905426987,
+		0.58601584621036396, 0.58449746950316284, 0.58655784000632061, 0.58609186380587497,
+		0.58467563511626475, 0.58523605658159161, 0.58663139011677168, 0.59059217604624759,
+		0.58633488862472161, 0.59167278220881236, 0.58717799711166474, 0.59202324125455519,
+		0.58691209254201959, 0.58612135440812785, 0.58903423213065842, 0.59081756078024938,
+		0.59138053544909475, 0.58784902625549573, 0.59049915372441264, 0.58718063595590186,
+		0.58651468778957128, 0.59058196039017474, 0.58896102047617072, 0.59269872174895288,
+		0.59214204620271049, 0.59180260902987669, 0.59209843042076216, 0.59040511315293787,
+		0.59160840063522158, 0.5880119856536058, 0.59529552424416454, 0.59216407826468531,
+		0.5939990099415402, 0.59286566086924464, 0.59425378578069654, 0.59283893539641641,
+		0.59240211328537895, 0.58872252673529024, 0.59276004705765628, 0.59321338428570758,
+		0.59269651854184235, 0.59199267206262773, 0.59386500048280899, 0.59070695259550809,
+		0.59266731499946279, 0.59637139158774743, 0.59401448023798376, 0.5926566050269183,
+		0.58898558521823352, 0.59375612244497444, 0.59174449719655631, 0.58879548520044322,
+		0.59400087190429052, 0.59366833219358139, 0.59112280776506876, 0.59489901891932084,
+		0.59137843986691085, 0.58803764131429859, 0.58813109821688769, 0.58901971996111258,
+		0.58999196188870962, 0.59048570108057041, 0.58935252399859139, 0.58992119862721892,
+		0.59194736580468743, 0.59127820359618211, 0.59146975557489911, 0.58948987051802604,
+		0.5910792018014267, 0.59041717176297637, 0.59194046865787997, 0.58937376601626001,
+		0.58795833736757896, 0.58660103929978979, 0.58821732833824913, 0.58898199708679888,
+		0.59155918536362129, 0.58627642954054582, 0.58712841339129695, 0.58587021046655341,
+		0.58571288913273745, 0.58739762936981266, 0.58835168753576994, 0.58916913348452726,
+		0.58815696352843894, 0.58860511538278959, 0.58460496037342669, 0.58876987592243213,
+		0.58572465838364518, 0.58427092504170841, 0.58311309970231751, 0.58578519093207859,
+		0.58806647892893205, 0.58363961600725633, 0.58172116261280349, 0.58325189210902595,
+		0.58606953300164011, 0.5816450346479034, 0.58374094511224917, 0.58470828429611066,
+		0.5812966833735721, 0.57992800572360559, 0.58454575868181691, 0.58291416404496066,
+		0.58161347837740274, 0.58309196193560398, 0.57957688839809995, 0.57776928271892125,
+		0.57927354664808028, 0.58137942209255666, 0.5839267659565841, 0.5777413552399665,
+		0.57750984387994797, 0.57785179855062485, 0.57996058501046943, 0.57840058240616343,
+		0.5775861756032582, 0.57842060082488933, 0.57969188745358213, 0.57600866378208848,
+		0.58113931234970673, 0.58227981985905752, 0.57624808535158945, 0.57794046507964358,
+		0.57324380534961827, 0.5830150183572721, 0.5810335886501945, 0.57745844176891592,
+		0.58089158124036222, 0.57994670905836077, 0.57572500693029238, 0.58087090155069876,
+		0.58053088136449071, 0.57782956878927794, 0.57616725480176545, 0.57724308699672933,
+		0.57805930710483233, 0.58369136314734538, 0.57840894455693104, 0.57850540532837857,
+		0.57416423731429134, 0.58093927918208133, 0.57591725283668993, 0.57639712560476331,
+		0.57917913887944383, 0.57762418200530152, 0.57835043964985089, 0.58048384756674853,
+		0.58062174788283472, 0.57599330753787348, 0.58074417632339004, 0.57744219865493929,
+		0.57776426926536484, 0.57843698434354707, 0.57940628647097669, 0.58264723666388696,
+		0.58144874289004922, 0.58080735375960635, 0.58358454266322979, 0.57726529752187827,
+		0.57961338572052057, 0.58318462168237239, 0.57824980427270944, 0.58329579925451991,
+		0.58223291719082249, 0.5799242274768337, 0.57857538888502902, 0.58324679077940378,
+		0.58514274349443485, 0.58557361076944958, 0.58307624349761022, 0.58170831309631166,
+		0.58430624945255405, 0.5843623254205369, 0.58335130172731486, 0.58669139370687395,
+		0.58364690678811637, 0.5853857070485996, 0.58626183945329302, 0.58700224008197854,
+		0.58837893836685695, 0.58715736424321785, 0.58683359066915064, 0.5878877974889426,
+		0.58574469510389682, 0.58775111470930219, 0.58689916203885129, 0.58855056781218096,
+	};
+
+	static constexpr double LowRateSamplingRate = 0.8;
+	static constexpr double LowRateInput[] = {
+		-0.2887064210184539, -0.29114083781544892, -0.30658430039737272, -0.30076754888619089,
+		-0.28911894639851626, -0.28870960563981335, -0.28727003297791975, -0.28971343489929807,
+		-0.28728870985207278, -0.28849635994432266, -0.28999028138975302, -0.3007373757189179,
+		-0.2812385649792688, -0.27512136642652707, -0.29754378494035794, -0.2801220100959102,
+		-0.29170854579982425, -0.29530693864605678, -0.29328323366648135, -0.27835381975703821,
+		-0.26978506291770987, -0.26874418847623477, -0.29026189274275899, -0.25116597531652213,
+		-0.27923057741647134, -0.27372760831818693, -0.26945313308161473, -0.2630678583797279,
+		-0.27021683760878445, -0.27253246422856742, -0.26954075147364359, -0.27055865988257122,
+		-0.28109410559415637, -0.26795510399734307, -0.25845062094022142, -0.26861479480801709,
+		-0.26574393984825367, -0.27029439228331859, -0.25116028212661745, -0.25918146170158307,
+		-0.24946048868602624, -0.25568451571063161, -0.25443262896279811, -0.2514120020917005,
+		-0.2630315120852928, -0.26724850544224876, -0.2281590691855708, -0.24467328493268894,
+		-0.25075797907390057, -0.24595746000812166, -0.26167165445799134, -0.24814680524899757,
+		-0.25197715938316467, -0.23507811549293273, -0.23858613394721304, -0.24304568385833655,
+		-0.24558995423182067, -0.25803803914285423, -0.24737208319258094, -0.24527926426038713,
+		-0.22727194051169705, -0.22819136541088778, -0.25520935134810457, -0.24018153301732081,
+		-0.23171689294995684, -0.24133068142751715, -0.23216214318150225, -0.21930008400754986,
+		-0.22787065596889045, -0.23075005863694381, -0.22535084045684622, -0.22757148032742852,
+		-0.23394462056611928, -0.22968712557897369, -0.23742362078632176, -0.23558002663490779,
+		-0.22393675843199451, -0.23697486894768532, -0.22706417813071139, -0.22441388666953255,
+		-0.22040319043235748, -0.21399428495605088, -0.21990626655545403, -0.20063488922015621,
+		-0.22700176690715337, -0.22057643886989869, -0.21146597927164712, -0.21079745687377488,
+		-0.2134113488195411, -0.22019094079147775, -0.21711116998765706, -0.22142689782072122,
+		-0.20261502937395587, -0.22091051066079992, -0.19779365482700212, -0.20699760501919859,
+		-0.21969344540299876, -0.20823951415742847, -0.21978279847635948, -0.19714972109915646,
+		-0.18520939978378903, -0.19423092064812789, -0.21059827038254364, -0.19387662916481971,
+		-0.20174600908646162, -0.19875517861287545, -0.19887069080359376, -0.17071488500797391,
+		-0.17766701531277473, -0.17462395421173965, -0.18871409399349831, -0.19436316150462254,
+		-0.19453631186221487, -0.18648532577775881, -0.17802492033668693, -0.19538027286725879,
+		-0.18221953117873635, -0.19293090316777264, -0.17515195180979903, -0.15341079386302398,
+		-0.10576774080829135, -0.1098028259210802, -0.08378015275977857, -0.11115577083515629,
+		-0.095981268656883612, -0.093101854574305476, -0.09228523655192622, -0.08492050820607383,
+		-0.080659100485069579, -0.088012056668864025, -0.088073142264640525, -0.11166080694987346,
+		-0.088160125206168394, -0.074295430432214316, -0.081676193237288919, -0.070076954105714351,
+		-0.089750183084180868, -0.07109834095369999, -0.093679094708951249, -0.070356847538264433,
+		-0.083858066515682117, -0.082223333152142197, -0.064403173527237512, -0.092175758947974251,
+		-0.10145236604147778, -0.076845554867553845, -0.066794564166842152, -0.07085216035005748,
+		-0.075090801067104695, -0.078239544820411566, -0.06122519167513496, -0.060644241650909758,
+		-0.070889335299284983, -0.046023432182075941, -0.078206686298622208, -0.074855027694367915,
+		-0.05567938786143567, -0.045771178400431101, -0.061338002668254732, -0.06331314275439448,
+		-0.062906086669915262, -0.063375540224187898, -0.069500474879163332, -0.062436691162293945,
+		-0.05717547586731242, -0.044834206098509244, -0.05027921127346574, -0.069952330965173004,
+		-0.056552170433055604, -0.068714391280562503, -0.03664569831265907, -0.052884282292453177,
+		-0.038258130533911305, -0.043885893928277353, -0.033947302508180954, -0.051552959372634988,
+		-0.037818481807419368, -0.054277891048911453, -0.031294116714121856, -0.056604500868258745,
+		-0.029310676093887544, -0.019382075537137833, -0.02433308494062747, -0.03607240515261706,
+		-0.028795463023311818, -0.034940952230598232, -0.042293392409490871, -0.03494521209744611,
+		-0.031884193325872001, -0.024293905568402663, -0.026270487601491255, -0.02683602224473397,
+		-0.038999479485331778, -0.033071670129262987, -0.017461081963098923, -0.0084420190742327539,
+		-0.0028105551206490942, -0.007110772430789003, -0.015957258955780595, -0.037277292959632446,
+	};
+	static constexpr double LowRateExpected[] = {
+		-0.15880501244687201, -0.16220619528330579, -0.17637704127169063, -0.17160751592426168,
+		-0.16157741669588302, -0.16215588689865121, -0.16170427621460207, -0.16511427734880718,
+		-0.1636790324982409, -0.16586900703974902, -0.16834277080762924, -0.17923940461958757,
+		-0.16392833315203234, -0.15887010693054834, -0.17599195437904552, -0.16181962345595466,
+		-0.17336543952900524, -0.17790091316830348, -0.17686570858897716, -0.16431926813142095,
+		-0.15696688122521563, -0.15691392015654029, -0.17379926086018804, -0.15932367427214977,
+		-0.17686367355169372, -0.17239712191233997, -0.16912929119207123, -0.16381469174467628,
+		-0.17166940741437428, -0.17495392459633269, -0.1729543741982402, -0.17495593396601569,
+		-0.18568494205748662, -0.17446335928642626, -0.16627006567736466, -0.17670131941288686,
+		-0.17482190363057623, -0.18027086836559969, -0.1651446467440173, -0.17377151165374624,
+		-0.16538683935555173, -0.17240193534474674, -0.1721379716105767, -0.17010969363220416,
+		-0.18168048667292255, -0.18681115253117148, -0.17233189840690052, -0.18711574795681363,
+		-0.19400265186406532, -0.19021927359750782, -0.20455018062396255, -0.19303282854141082,
+		-0.19779217097674448, -0.18393831109189479, -0.18838635131130724, -0.19374873247696403,
+		-0.19725766875234241, -0.20944257766897184, -0.20023759510217565, -0.19913340209788741,
+		-0.18461923663052082, -0.1865229101518743, -0.20412466064801338, -0.19150903345624887,
+		-0.18425152474454604, -0.19423294190895871, -0.18633904078942981, -0.17533306081221162,
+		-0.18443566189666966, -0.18827247568081837, -0.18390641304120592, -0.18709753620263131,
+		-0.19424934192731447, -0.19099820289703248, -0.19937525131755962, -0.19851990148043405,
+		-0.18849420002793821, -0.20110009132341716, -0.1925487371522476, -0.19088878554896985,
+		-0.18788057923640669, -0.18254343798550957, -0.1892708490972009, -0.174074280640554,
+		-0.19168233891417544, -0.18632953747593994, -0.17848768685619901, -0.17880706053701917,
+		-0.18238421806874328, -0.18990606573766602, -0.187819042220391, -0.19304414777525705,
+		-0.17808670245854924, -0.1937673276756163, -0.17699387709488326, -0.18663401764288939,
+		-0.19899739061970434, -0.18912837374599401, -0.20064136715446179, -0.18402306603624313,
+		-0.1737538655852662, -0.18324041840428024, -0.19794339123539728, -0.18420041143057267,
+		-0.19269434258710583, -0.19069566886216419, -0.19179838457342144, -0.1741930693881493,
+		-0.18187081350511849, -0.1798202497297261, -0.19314137562750031, -0.19962477527016204,
+		-0.20078501202487875, -0.19390689604411751, -0.18665325153487133, -0.20188017625849816,
+		-0.19064178481725974, -0.20151023567668519, -0.18712749247553787, -0.17082854218141807,
+		-0.16240470853504219, -0.16736096482204782, -0.14993050001862018, -0.16751830049090397,
+		-0.15480027333427268, -0.15291234671467333, -0.15308363933080146, -0.14684310457370528,
+		-0.14358811903758115, -0.15162519041597555, -0.15267357945648957, -0.17003206237384244,
+		-0.1531446734213153, -0.14137137179592152, -0.14943322027558004, -0.13944385280807151,
+		-0.15570739379938595, -0.14083564267623544, -0.15799416184929735, -0.14115872869763552,
+		-0.15408516760012411, -0.1534384905148195, -0.13903185255673853, -0.15659547220941167,
+		-0.16629649798499427, -0.14912664045582605, -0.14045265276064078, -0.14543052078815064,
+		-0.150581906090059, -0.1546812444384964, -0.14075606972053645, -0.14116299737693286,
+		-0.15165954482495417, -0.13443346957575381, -0.15112187067831823, -0.14876509872937158,
+		-0.13361749593579639, -0.12506831553041109, -0.13931251458870578, -0.14226183782132754,
+		-0.14284259148128289, -0.14429832322518082, -0.15122229416296781, -0.14526436430838957,
+		-0.1410321964666697, -0.13043894743848394, -0.13673197023328665, -0.15299546894043253,
+		-0.14157310088885647, -0.15354910693874158, -0.13630868068555724, -0.15093989718519135,
+		-0.13860912775140793, -0.14507269177438289, -0.13649690715310361, -0.15184896310391147,
+		-0.1401732214009383, -0.15492701068167186, -0.1381949611441135, -0.15576082030462979,
+		-0.13819442517475899, -0.12962738635160281, -0.13545614102251627, -0.14711734557382813,
+		-0.14095906516990234, -0.1479019559049051, -0.1559385673094161, -0.14971352616745373,
+		-0.14764512589284579, -0.14119395190673956, -0.1441446970470871, -0.14569616476934105,
+		-0.15767308116504117, -0.15279667607377653, -0.13977945440681921, -0.13201968474559933,
+		-0.12742889016694076, -0.13263917052294327, -0.14197741229952776, -0.15880501286031912,
+	};
+
+}
@@ -0,0 +1,48 @@
+#include "pch.h"
+#include "Core/Log.h"
+#include "NIRS/Processing.h"
+
+#include "TDDRReference.h"
+
+#include <cmath>
+#include <iterator>
+#include <vector>
+
+// CorrectMotionArtifactsTDDR against the reference output stored in TDDRReference.h
+// (Utilities/py/tddr_reference.py), one case per recording shape
+
+namespace Utils {
+
+	// The reference filters with transfer function coefficients, NVIZ with second order sections
+	static constexpr double TOLERANCE = 1e-9;
+
+	template<size_t N>
+	bool check_case(const char* name, const double (&input)[N], const double (&expected)[N], double samplingRate)
+	{
+		std::vector<double> data(std::begin(input), std::end(input));
+		NIRS::CorrectMotionArtifactsTDDR(data.data(), data.size(), samplingRate);
+
+		double worst = 0.0;
+		for (size_t i = 0; i < N; i++) {
+			worst = std::max(worst, std::abs(data[i] - expected[i]));
+		}
+		if (!(worst <= TOLERANCE)) {
+			NVIZ_ERROR("TDDR {} : max deviation from the reference {}", name, worst);
+			return false;
+		}
+		NVIZ_INFO("TDDR {} : max deviation from the reference {}", name, worst);
+		return true;
+	}
+}
+
+int main()
+{
+	Log::Init();
+
+	using namespace TDDRReference;
+	int failures = 0;
+	failures += !Utils::check_case("Shift", ShiftInput, ShiftExpected, ShiftSamplingRate);
+	failures += !Utils::check_case("Drift", DriftInput, DriftExpected, DriftSamplingRate);
+	failures += !Utils::check_case("LowRate", LowRateInput, LowRateExpected, LowRateSamplingRate);
+	return failures == 0 ? 0 : 1;
+}
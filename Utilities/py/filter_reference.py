@@ -0,0 +1,63 @@
+import sys
+import numpy as np
+import scipy
+from scipy.signal import butter, cheby1, sosfilt_zi, sosfiltfilt
+
+# Writes Tests/NIRS/FilterReference.h : for every case the second order sections of scipy's butter / cheby1
+# (output='sos'), their sosfilt_zi and the sosfiltfilt output of a test signal. The cases are repeated in
+# Tests/NIRS/FilterDesignTest.cpp as FilterSpecifications, keep both lists in the same order
+
+# name, family, type, order, low cutoff, high cutoff, ripple, sampling rate
+CASES = [
+    ("ButterBandpass78", "butter", "bandpass", 5, 0.01, 0.1, 0.0, 7.8),
+    ("ButterBandpass10", "butter", "bandpass", 5, 0.01, 0.1, 0.0, 10.0),
+    ("ButterBandpass50", "butter", "bandpass", 5, 0.01, 0.1, 0.0, 50.0),
+    ("ButterHighpass50", "butter", "highpass", 3, 0.05, 0.0, 0.0, 50.0),
+    ("Cheby1Lowpass78", "cheby1", "lowpass", 4, 0.0, 0.5, 0.5, 7.8),
+    ("Cheby1Bandpass10", "cheby1", "bandpass", 3, 0.02, 0.5, 1.0, 10.0),
+    ("Cheby1Highpass10", "cheby1", "highpass", 5, 0.01, 0.0, 0.5, 10.0),
+]
+
+NUM_SAMPLES = 500
+
+
+def design(family, btype, order, low, high, ripple, fs):
+    cutoff = {"lowpass": high, "highpass": low, "bandpass": [low, high]}[btype]
+    if family == "butter":
+        return butter(order, cutoff, btype=btype, output="sos", fs=fs)
+    return cheby1(order, ripple, cutoff, btype=btype, output="sos", fs=fs)
+
+
+def make_signal(rng, fs):
+    # Slow oscillations on a drifting offset with a baseline shift, the kind of signal the filters see
+    t = np.arange(NUM_SAMPLES) / fs
+    x = 0.5 + 0.01 * t + 0.05 * np.sin(2 * np.pi * 0.03 * t) + 0.02 * np.sin(2 * np.pi * 0.8 * t)
+    x += 0.005 * rng.standard_normal(NUM_SAMPLES)
+    x[NUM_SAMPLES * 3 // 5:] += 0.1
+    return x
+
+
+def write_array(out, name, values):
+    out.write(f"\tstatic constexpr double {name}[] = {{\n")
+    for i in range(0, len(values), 4):
+        out.write("\t\t" + " ".join(f"{v:.17g}," for v in values[i:i + 4]) + "\n")
+    out.write("\t};\n")
+
+
+if __name__ == "__main__":
+    path = sys.argv[1] if len(sys.argv) > 1 else "Tests/NIRS/FilterReference.h"
+    rng = np.random.default_rng(2011)
+    with open(path, "w", newline="\n") as out:
+        out.write("#pragma once\n\n")
+        out.write(f"// Generated by Utilities/py/filter_reference.py (scipy {scipy.__version__}), do not edit\n")
+        out.write("namespace FilterReference {\n\n")
+        for name, family, btype, order, low, high, ripple, fs in CASES:
+            sos = design(family, btype, order, low, high, ripple, fs)
+            x = make_signal(rng, fs)
+            # b0 b1 b2 a1 a2 per section, scipy already normalizes a0 to 1
+            write_array(out, f"{name}Sections", sos[:, [0, 1, 2, 4, 5]].ravel())
+            write_array(out, f"{name}InitialConditions", sosfilt_zi(sos).ravel())
+            write_array(out, f"{name}Input", x)
+            write_array(out, f"{name}Expected", sosfiltfilt(sos, x))
+            out.write("\n")
+        out.write("}\n")
@@ -0,0 +1,115 @@
+import sys
+import numpy as np
+from scipy.signal import butter, filtfilt
+
+# Writes Tests/NIRS/TDDRReference.h, the input and expected output of NIRS::CorrectMotionArtifactsTDDR.
+# The expected output comes from MNE's _TDDR, so mne has to be installed : python tddr_reference.py [header]
+# With --transcription it comes from the transcription below instead, which follows mne/preprocessing/nirs/_tddr.py
+# step by step (including the centering of the corrected part). That only checks the C++ against a second reading
+# of the same code, the header says so and should be regenerated with mne before it is committed
+
+
+def TDDR(signal, sample_rate):
+    signal = np.array(signal, dtype=np.float64)
+    filter_cutoff = 0.5
+    filter_order = 3
+    Fc = filter_cutoff * 2 / sample_rate
+    signal_mean = np.mean(signal)
+    signal -= signal_mean
+    if Fc < 1:
+        fb, fa = butter(filter_order, Fc)
+        signal_low = filtfilt(fb, fa, signal, padlen=0)
+    else:
+        signal_low = signal
+    signal_high = signal - signal_low
+
+    tune = 4.685
+    D = np.sqrt(np.finfo(signal.dtype).eps)
+    mu = np.inf
+    iter = 0
+    deriv = np.diff(signal_low)
+    w = np.ones(deriv.shape)
+    while iter < 50:
+        iter = iter + 1
+        mu0 = mu
+        mu = np.sum(w * deriv) / np.sum(w)
+        dev = np.abs(deriv - mu)
+        sigma = 1.4826 * np.median(dev)
+        r = dev / (sigma * tune)
+        w = ((1 - r**2) * (r < 1)) ** 2
+        if abs(mu - mu0) < D * max(abs(mu), abs(mu0)):
+            break
+
+    new_deriv = w * (deriv - mu)
+    signal_low_corrected = np.cumsum(np.insert(new_deriv, 0, 0.0))
+    signal_low_corrected = signal_low_corrected - np.mean(signal_low_corrected)
+    return signal_low_corrected + signal_high + signal_mean
+
+
+def reference(signal, sample_rate, transcription):
+    if transcription:
+        return TDDR(signal, sample_rate)
+    from mne.preprocessing.nirs._tddr import _TDDR
+    return _TDDR(np.array(signal, dtype=np.float64), sample_rate)
+
+
+def source_name(transcription):
+    if transcription:
+        return "transcription of MNE's _TDDR, not MNE itself"
+    import mne
+    return f"mne {mne.__version__}"
+
+
+def make_cases():
+    rng = np.random.default_rng(2019)
+    cases = []
+
+    # Hemodynamic-like oscillation with a baseline shift and a spike
+    fs = 10.0
+    t = np.arange(600) / fs
+    x = 0.02 * np.sin(2 * np.pi * 0.1 * t) + 0.002 * rng.standard_normal(t.size)
+    x[300:] += 0.15
+    x[450:455] += np.array([0.05, 0.2, 0.3, 0.2, 0.05])
+    cases.append(("Shift", fs, x + 1.0))
+
+    # Steady linear drift, the integrated low part is far from zero mean before centering
+    x = 0.0005 * np.arange(600) + 0.01 * np.sin(2 * np.pi * 0.05 * t) + 0.002 * rng.standard_normal(t.size)
+    x[200:] -= 0.1
+    cases.append(("Drift", fs, x + 0.5))
+
+    # Below 1 Hz sampling the reference skips the low-pass
+    fs = 0.8
+    t = np.arange(200) / fs
+    x = 0.001 * np.arange(200) + 0.01 * rng.standard_normal(t.size)
+    x[120:] += 0.08
+    cases.append(("LowRate", fs, x - 0.3))
+    return cases
+
+
+def write_array(out, name, values):
+    out.write(f"\tstatic constexpr double {name}[] = {{\n")
+    for i in range(0, len(values), 4):
+        out.write("\t\t" + " ".join(f"{v:.17g}," for v in values[i:i + 4]) + "\n")
+    out.write("\t};\n")
+
+
+if __name__ == "__main__":
+    args = [arg for arg in sys.argv[1:] if arg != "--transcription"]
+    transcription = len(args) != len(sys.argv) - 1
+    path = args[0] if args else "Tests/NIRS/TDDRReference.h"
+    try:
+        source = source_name(transcription)
+    except ImportError:
+        sys.exit("mne is not installed, install it or pass --transcription to use the transcription of _TDDR")
+
+    with open(path, "w", newline="\n") as out:
+        out.write("#pragma once\n\n")
+        out.write(f"// Generated by Utilities/py/tddr_reference.py ({source}), do not edit\n")
+        out.write("namespace TDDRReference {\n\n")
+        for name, fs, x in make_cases():
+            y = reference(x, fs, transcription)
+            out.write(f"\tstatic constexpr double {name}SamplingRate = {fs!r};\n")
+            write_array(out, f"{name}Input", x)
+            write_array(out, f"{name}Expected", y)
+            out.write("\n")
+        out.write("}\n")